@@ -57,3 +57,43 @@ if(PPLNN_INSTALL)
     install(FILES ${CMAKE_CURRENT_SOURCE_DIR}/pplkernelriscv-config.cmake DESTINATION lib/cmake/ppl)
     install(DIRECTORY ${CMAKE_CURRENT_SOURCE_DIR}/include/ppl/kernel/riscv DESTINATION include/ppl/kernel)
 endif()
+
+################### Test ###################
+
+if(PPLNN_BUILD_TESTS)
+    set(__PPLNN_TOOLS_DIR__ ${CMAKE_CURRENT_SOURCE_DIR}/test/riscv)
+
+    # each test compares the kernels against a plain reference and exits nonzero on mismatch
+    set(PPLKERNELRISCV_TEST_SRC
+        ${__PPLNN_TOOLS_DIR__}/test_softmax.cpp
+        ${__PPLNN_TOOLS_DIR__}/test_layernorm.cpp
+        ${__PPLNN_TOOLS_DIR__}/test_pad.cpp
+        ${__PPLNN_TOOLS_DIR__}/test_matmul.cpp
+        ${__PPLNN_TOOLS_DIR__}/test_rnn.cpp
+        ${__PPLNN_TOOLS_DIR__}/test_reorder.cpp
+        ${__PPLNN_TOOLS_DIR__}/test_transpose.cpp
+        ${__PPLNN_TOOLS_DIR__}/test_reduce.cpp
+        ${__PPLNN_TOOLS_DIR__}/test_topk.cpp
+        ${__PPLNN_TOOLS_DIR__}/test_nms.cpp
+        ${__PPLNN_TOOLS_DIR__}/test_argmax.cpp
+        ${__PPLNN_TOOLS_DIR__}/test_gather.cpp
+        ${__PPLNN_TOOLS_DIR__}/test_scatter.cpp
+        ${__PPLNN_TOOLS_DIR__}/test_concat.cpp
+    )
+
+    foreach(__PPLNN_TEST_SRC__ ${PPLKERNELRISCV_TEST_SRC})
+        get_filename_component(__PPLNN_TEST_NAME__ ${__PPLNN_TEST_SRC__} NAME_WE)
+        set(__PPLNN_TEST_NAME__ riscv_${__PPLNN_TEST_NAME__})
+        add_executable(${__PPLNN_TEST_NAME__} ${__PPLNN_TEST_SRC__})
+        target_include_directories(${__PPLNN_TEST_NAME__}
+            PUBLIC ${PPLKERNELRISCV_INCLUDE_DIRECTORIES}
+            PRIVATE ${__PPLNN_TOOLS_DIR__} ${PPLCOMMON_INCLUDES})
+        target_compile_options(${__PPLNN_TEST_NAME__} PRIVATE ${PPLKERNELRISCV_COMPILE_OPTIONS})
+        target_compile_definitions(${__PPLNN_TEST_NAME__} PRIVATE ${PPLKERNELRISCV_COMPILE_DEFINITIONS})
+        target_compile_features(${__PPLNN_TEST_NAME__} PRIVATE cxx_std_11)
+        target_link_libraries(${__PPLNN_TEST_NAME__} PRIVATE pplkernelriscv_static ${PPLKERNELRISCV_LINK_LIBRARIES})
+    endforeach()
+
+    unset(__PPLNN_TEST_NAME__)
+    unset(__PPLNN_TOOLS_DIR__)
+endif()
@@ -41,6 +41,29 @@ public:
     };
 };
 
+typedef uint32_t conv2d_pool_type_t;
+
+class conv2d_pool_type {
+public:
+    enum {
+        NONE            = 0,
+        MAX             = 1,
+        AVERAGE_EXCLUDE = 2,
+        AVERAGE_INCLUDE = 3,
+    };
+};
+
+// pooling applied on conv output before it is written, dst tensor holds the pooled result
+struct conv2d_common_pool_param {
+    conv2d_pool_type_t pool_type;
+    int64_t kernel_h;
+    int64_t kernel_w;
+    int64_t stride_h;
+    int64_t stride_w;
+    int64_t pad_h;
+    int64_t pad_w;
+};
+
 struct conv2d_common_param {
     int64_t kernel_h;
     int64_t kernel_w;
@@ -79,16 +102,18 @@ typedef uint32_t conv2d_common_algo_t;
 
 class conv2d_common_algo {
 public:
-    static const conv2d_common_algo_t unknown       = 0;
-    static const conv2d_common_algo_t naive         = 2;
-    static const conv2d_common_algo_t depthwise     = 3;
-    static const conv2d_common_algo_t tile_gemm     = 4;
-    static const conv2d_common_algo_t gemm          = 5;
-    static const conv2d_common_algo_t direct_gemm   = 6;
-    static const conv2d_common_algo_t direct        = 7;
-    static const conv2d_common_algo_t winograd_b2f3 = 32;
-    static const conv2d_common_algo_t winograd_b4f3 = 33;
-    static const conv2d_common_algo_t winograd_b6f3 = 34;
+    static const conv2d_common_algo_t unknown           = 0;
+    static const conv2d_common_algo_t naive             = 2;
+    static const conv2d_common_algo_t depthwise         = 3;
+    static const conv2d_common_algo_t tile_gemm         = 4;
+    static const conv2d_common_algo_t gemm              = 5;
+    static const conv2d_common_algo_t direct_gemm       = 6;
+    static const conv2d_common_algo_t direct            = 7;
+    static const conv2d_common_algo_t tile_gemm_fp32acc = 8;
+    static const conv2d_common_algo_t tile_gemm_fp16w   = 9;
+    static const conv2d_common_algo_t winograd_b2f3     = 32;
+    static const conv2d_common_algo_t winograd_b4f3     = 33;
+    static const conv2d_common_algo_t winograd_b6f3     = 34;
 };
 
 struct conv2d_common_algo_info {
@@ -129,6 +154,8 @@ protected:
     const ppl::common::TensorShape* dst_shape_;
     const ppl::common::TensorShape* sum_src_shape_;
 
+    const conv2d_common_pool_param* fuse_pool_param_;
+
     void* temp_buffer_;
 
 public:
@@ -142,6 +169,7 @@ public:
         , dst_shape_(nullptr)
         , sum_src_(nullptr)
         , sum_src_shape_(nullptr)
+        , fuse_pool_param_(nullptr)
         , temp_buffer_(nullptr) {}
 
     conv2d_runtime_executor(const conv2d_common_param* conv_param, const T* cvt_filter, const T* cvt_bias)
@@ -154,6 +182,7 @@ public:
         , dst_shape_(nullptr)
         , sum_src_(nullptr)
         , sum_src_shape_(nullptr)
+        , fuse_pool_param_(nullptr)
         , temp_buffer_(nullptr) {}
 
     virtual uint64_t cal_temp_buffer_size() = 0;
@@ -255,6 +284,24 @@ public:
         return sum_src_shape_;
     }
 
+    // executors supporting pooling epilogue should override it
+    virtual bool is_fuse_pool_supported() const
+    {
+        return false;
+    }
+    void set_fuse_pool_param(const conv2d_common_pool_param* fuse_pool_param)
+    {
+        fuse_pool_param_ = fuse_pool_param;
+    }
+    const conv2d_common_pool_param* fuse_pool_param() const
+    {
+        return fuse_pool_param_;
+    }
+    bool has_fuse_pool() const
+    {
+        return fuse_pool_param_ != nullptr && fuse_pool_param_->pool_type != conv2d_pool_type::NONE;
+    }
+
     void set_temp_buffer(void* temp_buffer) override
     {
         temp_buffer_ = temp_buffer;
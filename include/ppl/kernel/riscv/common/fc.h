@@ -46,8 +46,11 @@ typedef uint32_t fc_common_algo_t;
 
 class fc_common_algo {
 public:
-    static const fc_common_algo_t unknown  = 0;
-    static const fc_common_algo_t standard = 1;
+    static const fc_common_algo_t unknown          = 0;
+    static const fc_common_algo_t standard         = 1;
+    static const fc_common_algo_t standard_fp32acc = 2;
+    static const fc_common_algo_t gemv             = 3;
+    static const fc_common_algo_t gemv_fp32acc     = 4;
 };
 
 struct fc_common_algo_info {
@@ -40,6 +40,45 @@ enum {
   WG_ON_B6 = 4,
 };
 
+/** @brief fp16 gemm accumulation level */
+enum {
+  /** accumulate in fp16 */
+  FP16_ACC_FP16 = 0,
+
+  /** accumulate in fp32 and round to fp16 on store */
+  FP16_ACC_FP32 = 1,
+
+  /** accumulate in fp32 only for long reduction (k >= 1024) */
+  FP16_ACC_AUTO = 2,
+};
+
+/** @brief fp32 conv weight storage level */
+enum {
+  /** keep converted weights in fp32 */
+  FP32_WEIGHT_FP32 = 0,
+
+  /** store converted weights in fp16 and widen them in the gemm kernel, activations stay fp32 */
+  FP32_WEIGHT_FP16 = 1,
+};
+
+/** @brief scatter reduction mode */
+enum {
+  /** overwrite, the last of duplicated indices wins */
+  SCATTER_REDUCTION_NONE = 0,
+
+  /** add updates to the existing values */
+  SCATTER_REDUCTION_ADD = 1,
+
+  /** multiply the existing values by updates */
+  SCATTER_REDUCTION_MUL = 2,
+
+  /** keep the larger of existing values and updates */
+  SCATTER_REDUCTION_MAX = 3,
+
+  /** keep the smaller of existing values and updates */
+  SCATTER_REDUCTION_MIN = 4,
+};
+
 
 }}} // namespace ppl::kernel::riscv
 
@@ -24,6 +24,8 @@ namespace ppl { namespace kernel { namespace riscv {
 
 ppl::common::RetCode argmax_ndarray_fp16(const ppl::common::TensorShape* src_shape, const __fp16* src, const int64_t axis, int64_t* dst);
 
+ppl::common::RetCode argmin_ndarray_fp16(const ppl::common::TensorShape* src_shape, const __fp16* src, const int64_t axis, int64_t* dst);
+
 }}}; // namespace ppl::kernel::riscv
 
 #endif
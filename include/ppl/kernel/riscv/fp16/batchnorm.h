@@ -0,0 +1,51 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_PPL_KERNEL_RISCV_FP16_BATCHNORM_H_
+#define __ST_PPL_KERNEL_RISCV_FP16_BATCHNORM_H_
+
+#include "ppl/kernel/riscv/common/general_include.h"
+
+namespace ppl { namespace kernel { namespace riscv {
+
+// y = (x - mean) / sqrt(variance + var_eps) * scale + shift, then relu if set.
+// mean and variance may be nullptr for a plain per channel y = x * scale + shift.
+ppl::common::RetCode batchnorm_ndarray_fp16(
+    const ppl::common::TensorShape* src_shape,
+    const __fp16* src,
+    const __fp16* mean,
+    const __fp16* variance,
+    const __fp16* scale,
+    const __fp16* shift,
+    const float var_eps,
+    const bool relu,
+    __fp16* dst);
+
+ppl::common::RetCode batchnorm_n8cx_fp16(
+    const ppl::common::TensorShape* src_shape,
+    const __fp16* src,
+    const __fp16* mean,
+    const __fp16* variance,
+    const __fp16* scale,
+    const __fp16* shift,
+    const float var_eps,
+    const bool relu,
+    __fp16* dst);
+
+}}}; // namespace ppl::kernel::riscv
+
+#endif //  __ST_PPL_KERNEL_RISCV_FP16_BATCHNORM_H_
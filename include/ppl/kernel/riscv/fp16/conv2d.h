@@ -22,6 +22,7 @@
 #include <float.h>
 
 #include "ppl/kernel/riscv/common/conv2d.h"
+#include "ppl/kernel/riscv/common/options.h"
 #include "ppl/common/tensor_shape.h"
 #include "ppl/common/retcode.h"
 #include "ppl/common/allocator.h"
@@ -32,10 +33,11 @@ namespace ppl { namespace kernel { namespace riscv {
 
 class conv2d_fp16_algo_selector : public conv2d_algo_selector<__fp16> {
 public:
-    static conv2d_common_algo_info select_best_algo(const void* filter, ppl::common::TensorShape& src_shape, ppl::common::TensorShape& dst_shape, const conv2d_common_param& param, ppl::common::Allocator* allocator, uint32_t winograd_level);
+    static conv2d_common_algo_info select_best_algo(const void* filter, ppl::common::TensorShape& src_shape, ppl::common::TensorShape& dst_shape, const conv2d_common_param& param, ppl::common::Allocator* allocator, uint32_t winograd_level, uint32_t fp16_acc_level = FP16_ACC_AUTO);
     static conv2d_common_algo_info select_algo(const ppl::common::TensorShape& input_shape,
                                                const conv2d_common_param& param,
-                                               uint32_t winograd_level);
+                                               uint32_t winograd_level,
+                                               uint32_t fp16_acc_level = FP16_ACC_AUTO);
     static conv2d_offline_manager<__fp16>* gen_algo(const conv2d_common_param& param,
                                                     const conv2d_common_algo_info& algo_info,
                                                     ppl::common::Allocator* allocator);
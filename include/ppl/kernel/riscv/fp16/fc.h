@@ -22,6 +22,7 @@
 
 #include "ppl/kernel/riscv/common/general_include.h"
 #include "ppl/kernel/riscv/common/fc.h"
+#include "ppl/kernel/riscv/common/options.h"
 #include "ppl/common/generic_cpu_allocator.h"
 #include "ppl/common/sys.h"
 
@@ -29,7 +30,9 @@ namespace ppl { namespace kernel { namespace riscv {
 
 class fc_algo_selector_fp16 {
 public:
-    static fc_common_algo_info select_algo(const ppl::common::dataformat_t& src_format, const fc_common_param& param);
+    static fc_common_algo_info select_algo(const ppl::common::dataformat_t& src_format, const fc_common_param& param, uint32_t fp16_acc_level = FP16_ACC_AUTO);
+    // format and batch are read from src_shape, batch == 1 selects the gemv algo
+    static fc_common_algo_info select_algo(const ppl::common::TensorShape& src_shape, const fc_common_param& param, uint32_t fp16_acc_level = FP16_ACC_AUTO);
     static fc_manager<__fp16>* gen_algo(const fc_common_param& param, const fc_common_algo_info& algo_info, ppl::common::Allocator* allocator);
 };
 
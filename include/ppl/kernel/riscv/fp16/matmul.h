@@ -0,0 +1,57 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_PPL_KERNEL_RISCV_FP16_MATMUL_H_
+#define __ST_PPL_KERNEL_RISCV_FP16_MATMUL_H_
+
+#include "ppl/kernel/riscv/common/general_include.h"
+
+namespace ppl { namespace kernel { namespace riscv {
+
+// B packed once for matmul_ndarray_fp16 with packedB set, e.g. for constant weights
+uint64_t matmul_ndarray_get_packed_b_bytes_fp16(
+    const ppl::common::TensorShape* B_shape,
+    const bool transB);
+
+ppl::common::RetCode matmul_ndarray_pack_b_fp16(
+    const ppl::common::TensorShape* B_shape,
+    const __fp16* B,
+    const bool transB,
+    __fp16* packed_B);
+
+uint64_t matmul_ndarray_get_buffer_bytes_fp16(
+    const ppl::common::TensorShape* A_shape,
+    const ppl::common::TensorShape* B_shape,
+    const bool transA,
+    const bool transB,
+    const bool packedB);
+
+// Y = op(A) * op(B) with numpy batch broadcasting, B comes from matmul_ndarray_pack_b_fp16 when packedB is set
+ppl::common::RetCode matmul_ndarray_fp16(
+    const ppl::common::TensorShape* A_shape,
+    const ppl::common::TensorShape* B_shape,
+    const __fp16* A,
+    const __fp16* B,
+    const bool transA,
+    const bool transB,
+    const bool packedB,
+    void* temp_buffer,
+    __fp16* Y);
+
+}}}; // namespace ppl::kernel::riscv
+
+#endif //  __ST_PPL_KERNEL_RISCV_FP16_MATMUL_H_
@@ -50,6 +50,41 @@ ppl::common::RetCode reduce_sum_fp16(const __fp16* src, __fp16* dst,
                                      const int32_t* axes,
                                      const int32_t num_axes);
 
+ppl::common::RetCode reduce_prod_fp16(const __fp16* src, __fp16* dst,
+
+                                      const ppl::common::TensorShape* src_shape,
+                                      const ppl::common::TensorShape* dst_shape,
+                                      const int32_t* axes,
+                                      const int32_t num_axes);
+
+ppl::common::RetCode reduce_sum_square_fp16(const __fp16* src, __fp16* dst,
+
+                                            const ppl::common::TensorShape* src_shape,
+                                            const ppl::common::TensorShape* dst_shape,
+                                            const int32_t* axes,
+                                            const int32_t num_axes);
+
+ppl::common::RetCode reduce_l1_fp16(const __fp16* src, __fp16* dst,
+
+                                    const ppl::common::TensorShape* src_shape,
+                                    const ppl::common::TensorShape* dst_shape,
+                                    const int32_t* axes,
+                                    const int32_t num_axes);
+
+ppl::common::RetCode reduce_l2_fp16(const __fp16* src, __fp16* dst,
+
+                                    const ppl::common::TensorShape* src_shape,
+                                    const ppl::common::TensorShape* dst_shape,
+                                    const int32_t* axes,
+                                    const int32_t num_axes);
+
+ppl::common::RetCode reduce_log_sum_exp_fp16(const __fp16* src, __fp16* dst,
+
+                                             const ppl::common::TensorShape* src_shape,
+                                             const ppl::common::TensorShape* dst_shape,
+                                             const int32_t* axes,
+                                             const int32_t num_axes);
+
 }}}; // namespace ppl::kernel::riscv
 
 #endif //  __ST_PPL_KERNEL_RISCV_FP16_REDUCE_H_
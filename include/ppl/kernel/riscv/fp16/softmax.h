@@ -24,6 +24,11 @@ namespace ppl { namespace kernel { namespace riscv {
 
 ppl::common::RetCode softmax_ndarray_fp16(const ppl::common::TensorShape* shape, const int64_t axis, const __fp16* src, __fp16* dst);
 
+// opset >= 13: softmax along axis only, axis may be negative
+ppl::common::RetCode softmax13_ndarray_fp16(const ppl::common::TensorShape* shape, const int64_t axis, const __fp16* src, __fp16* dst);
+
+ppl::common::RetCode softmax13_n8cx_fp16(const ppl::common::TensorShape* shape, const int64_t axis, const __fp16* src, __fp16* dst);
+
 }}}; // namespace ppl::kernel::riscv
 
 #endif //  __ST_PPL_KERNEL_RISCV_FP16_SOFTMAX_H_
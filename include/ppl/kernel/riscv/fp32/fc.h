@@ -30,6 +30,8 @@ namespace ppl { namespace kernel { namespace riscv {
 class fc_algo_selector_fp32 {
 public:
     static fc_common_algo_info select_algo(const ppl::common::dataformat_t& src_format, const fc_common_param& param);
+    // format and batch are read from src_shape, batch == 1 selects the gemv algo
+    static fc_common_algo_info select_algo(const ppl::common::TensorShape& src_shape, const fc_common_param& param);
     static fc_manager<float>* gen_algo(const fc_common_param& param, const fc_common_algo_info& algo_info, ppl::common::Allocator* allocator);
 };
 }}}; // namespace ppl::kernel::riscv
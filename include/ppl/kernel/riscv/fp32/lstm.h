@@ -0,0 +1,79 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_PPL_KERNEL_RISCV_FP32_LSTM_H_
+#define __ST_PPL_KERNEL_RISCV_FP32_LSTM_H_
+
+#include "ppl/kernel/riscv/common/general_include.h"
+#include "ppl/kernel/riscv/common/rnn_common.h"
+
+namespace ppl { namespace kernel { namespace riscv {
+
+// W / R packed once for lstm_ndarray_fp32 with packed_W / packed_R set, e.g. for constant weights
+uint64_t lstm_ndarray_get_packed_W_bytes_fp32(
+    const rnn_direction_t direction,
+    const int64_t hidden_size,
+    const int64_t input_size);
+
+ppl::common::RetCode lstm_ndarray_pack_W_fp32(
+    const float* W,
+    const rnn_direction_t direction,
+    const int64_t hidden_size,
+    const int64_t input_size,
+    float* packed_W);
+
+uint64_t lstm_ndarray_get_packed_R_bytes_fp32(
+    const rnn_direction_t direction,
+    const int64_t hidden_size);
+
+ppl::common::RetCode lstm_ndarray_pack_R_fp32(
+    const float* R,
+    const rnn_direction_t direction,
+    const int64_t hidden_size,
+    float* packed_R);
+
+uint64_t lstm_ndarray_get_buffer_bytes_fp32(
+    const ppl::common::TensorShape* X_shape,
+    const rnn_direction_t direction,
+    const int64_t hidden_size,
+    const bool has_Y_h,
+    const bool has_Y_c,
+    const bool packed_W,
+    const bool packed_R);
+
+ppl::common::RetCode lstm_ndarray_fp32(
+    const ppl::common::TensorShape* X_shape,
+    const float* X,
+    const float* W,
+    const float* R,
+    const float* P,
+    const float* bias,
+    const int32_t* sequence_lens,
+    const float* initial_h,
+    const float* initial_c,
+    const rnn_direction_t direction,
+    const int64_t hidden_size,
+    const bool packed_W,
+    const bool packed_R,
+    void* temp_buffer,
+    float* Y,
+    float* Y_h,
+    float* Y_c);
+
+}}}; // namespace ppl::kernel::riscv
+
+#endif //  __ST_PPL_KERNEL_RISCV_FP32_LSTM_H_
@@ -50,6 +50,41 @@ ppl::common::RetCode reduce_sum_fp32(const float* src, float* dst,
                                      const int32_t* axes,
                                      const int32_t num_axes);
 
+ppl::common::RetCode reduce_prod_fp32(const float* src, float* dst,
+
+                                      const ppl::common::TensorShape* src_shape,
+                                      const ppl::common::TensorShape* dst_shape,
+                                      const int32_t* axes,
+                                      const int32_t num_axes);
+
+ppl::common::RetCode reduce_sum_square_fp32(const float* src, float* dst,
+
+                                            const ppl::common::TensorShape* src_shape,
+                                            const ppl::common::TensorShape* dst_shape,
+                                            const int32_t* axes,
+                                            const int32_t num_axes);
+
+ppl::common::RetCode reduce_l1_fp32(const float* src, float* dst,
+
+                                    const ppl::common::TensorShape* src_shape,
+                                    const ppl::common::TensorShape* dst_shape,
+                                    const int32_t* axes,
+                                    const int32_t num_axes);
+
+ppl::common::RetCode reduce_l2_fp32(const float* src, float* dst,
+
+                                    const ppl::common::TensorShape* src_shape,
+                                    const ppl::common::TensorShape* dst_shape,
+                                    const int32_t* axes,
+                                    const int32_t num_axes);
+
+ppl::common::RetCode reduce_log_sum_exp_fp32(const float* src, float* dst,
+
+                                             const ppl::common::TensorShape* src_shape,
+                                             const ppl::common::TensorShape* dst_shape,
+                                             const int32_t* axes,
+                                             const int32_t num_axes);
+
 }}}; // namespace ppl::kernel::riscv
 
 #endif //  __ST_PPL_KERNEL_RISCV_FP32_REDUCE_H_
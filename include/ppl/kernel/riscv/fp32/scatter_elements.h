@@ -0,0 +1,39 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_PPL_KERNEL_RISCV_FP32_SCATTER_ELEMENTS_H_
+#define __ST_PPL_KERNEL_RISCV_FP32_SCATTER_ELEMENTS_H_
+
+#include "ppl/kernel/riscv/common/general_include.h"
+#include "ppl/kernel/riscv/common/options.h"
+
+namespace ppl { namespace kernel { namespace riscv {
+
+// reduction is one of SCATTER_REDUCTION_*, duplicated indices are reduced in index order
+ppl::common::RetCode scatter_elements_ndarray_fp32(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *indices_shape,
+    const float *src,
+    const int64_t *indices,
+    const float *updates,
+    const int64_t axis,
+    const int32_t reduction,
+    float *dst);
+
+}}}; // namespace ppl::kernel::riscv
+
+#endif //  __ST_PPL_KERNEL_RISCV_FP32_SCATTER_ELEMENTS_H_
@@ -19,6 +19,7 @@
 #define __ST_PPL_KERNEL_RISCV_FP32_SCATTER_ND_H_
 
 #include "ppl/kernel/riscv/common/general_include.h"
+#include "ppl/kernel/riscv/common/options.h"
 
 namespace ppl { namespace kernel { namespace riscv {
 
@@ -33,6 +34,19 @@ ppl::common::RetCode scatter_nd_ndarray_fp32(
     const int64_t indices_dim,
     float *dst);
 
+// reduction is one of SCATTER_REDUCTION_*, duplicated indices are reduced in index order
+ppl::common::RetCode scatter_nd_ndarray_fp32(
+    const float *src,
+    const float *updates,
+    const int64_t *indices,
+    const int32_t *strides,
+    const int64_t src_length,
+    const int64_t inner_dim,
+    const int64_t num_indices,
+    const int64_t indices_dim,
+    const int32_t reduction,
+    float *dst);
+
 }}}; // namespace ppl::kernel::riscv
 
 #endif //  __ST_PPL_KERNEL_RISCV_FP32_SCATTER_ND_H_
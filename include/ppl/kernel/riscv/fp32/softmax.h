@@ -24,6 +24,11 @@ namespace ppl { namespace kernel { namespace riscv {
 
 ppl::common::RetCode softmax_ndarray_fp32(const ppl::common::TensorShape* shape, const int64_t axis, const float* src, float* dst);
 
+// opset >= 13: softmax along axis only, axis may be negative
+ppl::common::RetCode softmax13_ndarray_fp32(const ppl::common::TensorShape* shape, const int64_t axis, const float* src, float* dst);
+
+ppl::common::RetCode softmax13_n4cx_fp32(const ppl::common::TensorShape* shape, const int64_t axis, const float* src, float* dst);
+
 }}}; // namespace ppl::kernel::riscv
 
 #endif //  __ST_PPL_KERNEL_RISCV_FP32_SOFTMAX_H_
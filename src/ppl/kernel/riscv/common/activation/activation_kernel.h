@@ -0,0 +1,215 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_PPL_KERNEL_RISCV_COMMON_ACTIVATION_ACTIVATION_KERNEL_H_
+#define __ST_PPL_KERNEL_RISCV_COMMON_ACTIVATION_ACTIVATION_KERNEL_H_
+
+#include <riscv-vector.h>
+
+#include "ppl/kernel/riscv/common/vector_math/vector_math_kernel.h"
+
+namespace ppl { namespace kernel { namespace riscv {
+
+// Vectorized activations built on vector_math_kernel.h.
+// v_len is the register group width in bits: <float, 128> is float32xm1, <float, 256> is float32xm2.
+// <__fp16, 128> widens to <float, 256> like the vector_math fp16 functions.
+//
+//   vfgelu         0.5 * x * (1 + erf(x / sqrt(2)))
+//   vfgelu_tanh    0.5 * x * (1 + tanh(sqrt(2 / pi) * (x + 0.044715 * x^3)))
+//   vfsilu         x * sigmoid(x)
+//   vfmish         x * tanh(log(1 + exp(x))), evaluated as x * n / (n + 2) with n = e^x * (e^x + 2)
+//   vfhard_sigmoid max(0, min(1, alpha * x + beta))
+
+//
+template <typename T, int32_t v_len>
+struct activation_register_v_helper;
+
+template <typename T, int32_t v_len>
+using activation_register_v = typename activation_register_v_helper<T, v_len>::U;
+
+template <>
+struct activation_register_v_helper<float, 128> {
+    typedef float32xm1_t U;
+};
+template <>
+struct activation_register_v_helper<float, 256> {
+    typedef float32xm2_t U;
+};
+template <>
+struct activation_register_v_helper<__fp16, 128> {
+    typedef float16xm1_t U;
+};
+
+//
+template <typename T, int32_t v_len>
+inline activation_register_v<T, v_len> vfgelu(activation_register_v<T, v_len> x, uint64_t vl);
+
+template <>
+inline float32xm1_t vfgelu<float, 128>(float32xm1_t x, uint64_t vl)
+{
+    float32xm1_t e = vferf_float32xm1(vfmulvf_float32xm1(x, 0.707106781f, vl), vl);
+    return vfmulvv_float32xm1(vfmulvf_float32xm1(x, 0.5f, vl), vfaddvf_float32xm1(e, 1.0f, vl), vl);
+}
+template <>
+inline float32xm2_t vfgelu<float, 256>(float32xm2_t x, uint64_t vl)
+{
+    float32xm2_t e = vferf_float32xm2(vfmulvf_float32xm2(x, 0.707106781f, vl), vl);
+    return vfmulvv_float32xm2(vfmulvf_float32xm2(x, 0.5f, vl), vfaddvf_float32xm2(e, 1.0f, vl), vl);
+}
+template <>
+inline float16xm1_t vfgelu<__fp16, 128>(float16xm1_t x, uint64_t vl)
+{
+    float32xm2_t x_fp32 = vfwcvtffv_float32xm2_float16xm1(x, vl);
+    return vfncvtffv_float16xm1_float32xm2(vfgelu<float, 256>(x_fp32, vl), vl);
+}
+
+//
+template <typename T, int32_t v_len>
+inline activation_register_v<T, v_len> vfgelu_tanh(activation_register_v<T, v_len> x, uint64_t vl);
+
+template <>
+inline float32xm1_t vfgelu_tanh<float, 128>(float32xm1_t x, uint64_t vl)
+{
+    // 0.5 * (1 + tanh(u)) == sigmoid(2 * u), which keeps the result exact for large negative x
+    float32xm1_t x2 = vfmulvv_float32xm1(x, x, vl);
+    float32xm1_t u2 = vfmulvv_float32xm1(x, vfaddvf_float32xm1(vfmulvf_float32xm1(x2, 0.0713548162f, vl), 1.59576912f, vl), vl);
+    return vfmulvv_float32xm1(x, vfsigmoid_float32xm1(u2, vl), vl);
+}
+template <>
+inline float32xm2_t vfgelu_tanh<float, 256>(float32xm2_t x, uint64_t vl)
+{
+    // 0.5 * (1 + tanh(u)) == sigmoid(2 * u), which keeps the result exact for large negative x
+    float32xm2_t x2 = vfmulvv_float32xm2(x, x, vl);
+    float32xm2_t u2 = vfmulvv_float32xm2(x, vfaddvf_float32xm2(vfmulvf_float32xm2(x2, 0.0713548162f, vl), 1.59576912f, vl), vl);
+    return vfmulvv_float32xm2(x, vfsigmoid_float32xm2(u2, vl), vl);
+}
+template <>
+inline float16xm1_t vfgelu_tanh<__fp16, 128>(float16xm1_t x, uint64_t vl)
+{
+    float32xm2_t x_fp32 = vfwcvtffv_float32xm2_float16xm1(x, vl);
+    return vfncvtffv_float16xm1_float32xm2(vfgelu_tanh<float, 256>(x_fp32, vl), vl);
+}
+
+//
+template <typename T, int32_t v_len>
+inline activation_register_v<T, v_len> vfsilu(activation_register_v<T, v_len> x, uint64_t vl);
+
+template <>
+inline float32xm1_t vfsilu<float, 128>(float32xm1_t x, uint64_t vl)
+{
+    return vfmulvv_float32xm1(x, vfsigmoid_float32xm1(x, vl), vl);
+}
+template <>
+inline float32xm2_t vfsilu<float, 256>(float32xm2_t x, uint64_t vl)
+{
+    return vfmulvv_float32xm2(x, vfsigmoid_float32xm2(x, vl), vl);
+}
+template <>
+inline float16xm1_t vfsilu<__fp16, 128>(float16xm1_t x, uint64_t vl)
+{
+    float32xm2_t x_fp32 = vfwcvtffv_float32xm2_float16xm1(x, vl);
+    return vfncvtffv_float16xm1_float32xm2(vfsilu<float, 256>(x_fp32, vl), vl);
+}
+
+//
+template <typename T, int32_t v_len>
+inline activation_register_v<T, v_len> vfmish(activation_register_v<T, v_len> x, uint64_t vl);
+
+template <>
+inline float32xm1_t vfmish<float, 128>(float32xm1_t x, uint64_t vl)
+{
+    // n / (n + 2) rounds to 1 for x > 20, the clamp keeps n finite
+    float32xm1_t e = vfexp_float32xm1(vfminvf_float32xm1(x, 20.0f, vl), vl);
+    float32xm1_t n = vfmulvv_float32xm1(e, vfaddvf_float32xm1(e, 2.0f, vl), vl);
+    return vfmulvv_float32xm1(x, vfdivvv_float32xm1(n, vfaddvf_float32xm1(n, 2.0f, vl), vl), vl);
+}
+template <>
+inline float32xm2_t vfmish<float, 256>(float32xm2_t x, uint64_t vl)
+{
+    // n / (n + 2) rounds to 1 for x > 20, the clamp keeps n finite
+    float32xm2_t e = vfexp_float32xm2(vfminvf_float32xm2(x, 20.0f, vl), vl);
+    float32xm2_t n = vfmulvv_float32xm2(e, vfaddvf_float32xm2(e, 2.0f, vl), vl);
+    return vfmulvv_float32xm2(x, vfdivvv_float32xm2(n, vfaddvf_float32xm2(n, 2.0f, vl), vl), vl);
+}
+template <>
+inline float16xm1_t vfmish<__fp16, 128>(float16xm1_t x, uint64_t vl)
+{
+    float32xm2_t x_fp32 = vfwcvtffv_float32xm2_float16xm1(x, vl);
+    return vfncvtffv_float16xm1_float32xm2(vfmish<float, 256>(x_fp32, vl), vl);
+}
+
+//
+template <typename T, int32_t v_len>
+inline activation_register_v<T, v_len> vfhard_sigmoid(activation_register_v<T, v_len> x, float alpha, float beta, uint64_t vl);
+
+template <>
+inline float32xm1_t vfhard_sigmoid<float, 128>(float32xm1_t x, float alpha, float beta, uint64_t vl)
+{
+    float32xm1_t y = vfaddvf_float32xm1(vfmulvf_float32xm1(x, alpha, vl), beta, vl);
+    return vfminvf_float32xm1(vfmaxvf_float32xm1(y, 0.0f, vl), 1.0f, vl);
+}
+template <>
+inline float32xm2_t vfhard_sigmoid<float, 256>(float32xm2_t x, float alpha, float beta, uint64_t vl)
+{
+    float32xm2_t y = vfaddvf_float32xm2(vfmulvf_float32xm2(x, alpha, vl), beta, vl);
+    return vfminvf_float32xm2(vfmaxvf_float32xm2(y, 0.0f, vl), 1.0f, vl);
+}
+template <>
+inline float16xm1_t vfhard_sigmoid<__fp16, 128>(float16xm1_t x, float alpha, float beta, uint64_t vl)
+{
+    float32xm2_t x_fp32 = vfwcvtffv_float32xm2_float16xm1(x, vl);
+    return vfncvtffv_float16xm1_float32xm2(vfhard_sigmoid<float, 256>(x_fp32, alpha, beta, vl), vl);
+}
+
+// hard_sigmoid takes two scalars and does not fit vector_math_unary_*
+inline void activation_hard_sigmoid_fp32(const float* src, const float alpha, const float beta, float* dst, const int64_t n_elem)
+{
+    const int64_t atom_c = 4;
+    const auto vl        = vsetvli(atom_c, RVV_E32, RVV_M1);
+
+    int64_t i = 0;
+    for (; i + 4 * atom_c <= n_elem; i += 4 * atom_c) {
+        vsev_float32xm1(dst + i + 0 * atom_c, vfhard_sigmoid<float, 128>(vlev_float32xm1(src + i + 0 * atom_c, vl), alpha, beta, vl), vl);
+        vsev_float32xm1(dst + i + 1 * atom_c, vfhard_sigmoid<float, 128>(vlev_float32xm1(src + i + 1 * atom_c, vl), alpha, beta, vl), vl);
+        vsev_float32xm1(dst + i + 2 * atom_c, vfhard_sigmoid<float, 128>(vlev_float32xm1(src + i + 2 * atom_c, vl), alpha, beta, vl), vl);
+        vsev_float32xm1(dst + i + 3 * atom_c, vfhard_sigmoid<float, 128>(vlev_float32xm1(src + i + 3 * atom_c, vl), alpha, beta, vl), vl);
+    }
+    for (; i < n_elem; i += atom_c) {
+        const auto tail_vl = vsetvli(n_elem - i, RVV_E32, RVV_M1);
+        vsev_float32xm1(dst + i, vfhard_sigmoid<float, 128>(vlev_float32xm1(src + i, tail_vl), alpha, beta, tail_vl), tail_vl);
+    }
+}
+
+inline void activation_hard_sigmoid_fp16(const __fp16* src, const float alpha, const float beta, __fp16* dst, const int64_t n_elem)
+{
+    const int64_t atom_c = 8;
+    const auto vl        = vsetvli(atom_c, RVV_E16, RVV_M1);
+
+    int64_t i = 0;
+    for (; i + 2 * atom_c <= n_elem; i += 2 * atom_c) {
+        vsev_float16xm1(dst + i + 0 * atom_c, vfhard_sigmoid<__fp16, 128>(vlev_float16xm1(src + i + 0 * atom_c, vl), alpha, beta, vl), vl);
+        vsev_float16xm1(dst + i + 1 * atom_c, vfhard_sigmoid<__fp16, 128>(vlev_float16xm1(src + i + 1 * atom_c, vl), alpha, beta, vl), vl);
+    }
+    for (; i < n_elem; i += atom_c) {
+        const auto tail_vl = vsetvli(n_elem - i, RVV_E16, RVV_M1);
+        vsev_float16xm1(dst + i, vfhard_sigmoid<__fp16, 128>(vlev_float16xm1(src + i, tail_vl), alpha, beta, tail_vl), tail_vl);
+    }
+}
+
+}}}; // namespace ppl::kernel::riscv
+
+#endif //  __ST_PPL_KERNEL_RISCV_COMMON_ACTIVATION_ACTIVATION_KERNEL_H_
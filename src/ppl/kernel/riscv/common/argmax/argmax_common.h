@@ -18,22 +18,32 @@
 #ifndef __ST_PPL_KERNEL_RISCV_COMMON_ARGMAX_ARGMAX_COMMON_H_
 #define __ST_PPL_KERNEL_RISCV_COMMON_ARGMAX_ARGMAX_COMMON_H_
 
-#include <limits>
+#include <algorithm>
+
 #include "ppl/kernel/riscv/common/internal_include.h"
 
 namespace ppl { namespace kernel { namespace riscv {
 
+#define ARGMAX_INNER_BLK() 256
+
+// returns the index of the first extreme element of a contiguous line
 template <typename eT>
-ppl::common::RetCode argmax_ndarray(
+using argmax_common_line_func_t = int64_t (*)(const eT* src, const int64_t len);
+
+// writes the indices of the first extreme elements of width columns, each column strided by inner_dim,
+// width never exceeds ARGMAX_INNER_BLK()
+template <typename eT>
+using argmax_common_columns_func_t = void (*)(const eT* src, const int64_t argmax_dim, const int64_t inner_dim, const int64_t width, int64_t* dst);
+
+template <typename eT>
+ppl::common::RetCode argmax_ndarray_common(
     const ppl::common::TensorShape* src_shape,
     const eT* src,
     const int64_t axis,
+    argmax_common_line_func_t<eT> line_func,
+    argmax_common_columns_func_t<eT> columns_func,
     int64_t* dst)
 {
-    eT numeric_min = std::numeric_limits<eT>().min();
-    if (std::is_same<eT, float>().value || std::is_same<eT, double>().value || std::is_same<eT, long double>().value) {
-        numeric_min = -std::numeric_limits<eT>().max();
-    }
     const int64_t real_axis = axis < 0 ? axis + src_shape->GetDimCount() : axis;
 
     const int64_t argmax_dim = src_shape->GetDim(real_axis);
@@ -45,18 +55,29 @@ ppl::common::RetCode argmax_ndarray(
     for (uint32_t i = real_axis + 1; i < src_shape->GetDimCount(); i++) {
         inner_dim *= src_shape->GetDim(i);
     }
+    if (argmax_dim == 0) {
+        std::fill(dst, dst + outer_dim * inner_dim, 0);
+        return ppl::common::RC_SUCCESS;
+    }
 
-    for (int64_t i = 0; i < outer_dim; ++i) {
-        for (int64_t j = 0; j < inner_dim; ++j) {
-            eT max_value = numeric_min;
-            int64_t idx  = 0;
-            for (int64_t k = 0; k < argmax_dim; ++k) {
-                if (src[(i * argmax_dim + k) * inner_dim + j] > max_value) {
-                    max_value = src[(i * argmax_dim + k) * inner_dim + j];
-                    idx       = k;
-                }
-            }
-            dst[i * inner_dim + j] = idx;
+    if (inner_dim == 1) {
+        PRAGMA_OMP_PARALLEL_FOR()
+        for (int64_t i = 0; i < outer_dim; ++i) {
+            dst[i] = line_func(src + i * argmax_dim, argmax_dim);
+        }
+    } else {
+        // columns are vectorized in blocks, every line of the reduced axis is read contiguously
+        const int64_t num_blks = div_up(inner_dim, ARGMAX_INNER_BLK());
+        PRAGMA_OMP_PARALLEL_FOR()
+        for (int64_t t = 0; t < outer_dim * num_blks; ++t) {
+            const int64_t i = t / num_blks;
+            const int64_t j = (t % num_blks) * ARGMAX_INNER_BLK();
+            columns_func(
+                src + i * argmax_dim * inner_dim + j,
+                argmax_dim,
+                inner_dim,
+                min<int64_t>(inner_dim - j, ARGMAX_INNER_BLK()),
+                dst + i * inner_dim + j);
         }
     }
 
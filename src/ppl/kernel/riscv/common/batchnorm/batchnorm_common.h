@@ -0,0 +1,61 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_PPL_KERNEL_RISCV_COMMON_BATCHNORM_BATCHNORM_COMMON_H_
+#define __ST_PPL_KERNEL_RISCV_COMMON_BATCHNORM_BATCHNORM_COMMON_H_
+
+#include <math.h>
+#include <vector>
+
+#include "ppl/kernel/riscv/common/internal_include.h"
+
+namespace ppl { namespace kernel { namespace riscv {
+
+// folds batchnorm into y = x * a + b per channel. mean and variance may be nullptr, which leaves a
+// plain per channel scale-shift, scale and shift may be nullptr for 1 and 0. a and b are padded with 0
+// up to pad_c so padded channels of nbcx tensors come out as 0.
+template <typename T>
+void batchnorm_fold_param_common(
+    const T* mean,
+    const T* variance,
+    const T* scale,
+    const T* shift,
+    const float var_eps,
+    const int64_t channels,
+    const int64_t pad_c,
+    std::vector<float>& a,
+    std::vector<float>& b)
+{
+    a.assign(pad_c, 0.0f);
+    b.assign(pad_c, 0.0f);
+    for (int64_t c = 0; c < channels; c++) {
+        float ca = scale ? (float)scale[c] : 1.0f;
+        float cb = shift ? (float)shift[c] : 0.0f;
+        if (variance) {
+            ca = ca / sqrtf((float)variance[c] + var_eps);
+        }
+        if (mean) {
+            cb = cb - (float)mean[c] * ca;
+        }
+        a[c] = ca;
+        b[c] = cb;
+    }
+}
+
+}}}; // namespace ppl::kernel::riscv
+
+#endif //  __ST_PPL_KERNEL_RISCV_COMMON_BATCHNORM_BATCHNORM_COMMON_H_
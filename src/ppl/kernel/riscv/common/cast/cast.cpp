@@ -15,34 +15,216 @@
 // specific language governing permissions and limitations
 // under the License.
 
-#include "ppl/kernel/riscv/common/internal_include.h"
+#include <riscv-vector.h>
 #include <string.h>
 
+#include "ppl/kernel/riscv/common/internal_include.h"
+
 namespace ppl { namespace kernel { namespace riscv {
 
+// elements per thread task
+#define CAST_BLOCK_LEN() ((int64_t)16384)
+
 template <typename srcT, typename dstT>
-ppl::common::RetCode cast_kernel(
+using cast_block_func_t = void (*)(const srcT* src, const int64_t len, dstT* dst);
+
+template <typename srcT, typename dstT>
+static void cast_block_scalar(const srcT* src, const int64_t len, dstT* dst)
+{
+    for (int64_t i = 0; i < len; i++) {
+        dst[i] = src[i];
+    }
+}
+
+template <typename srcT>
+static void cast_block_scalar_bool(const srcT* src, const int64_t len, uint8_t* dst)
+{
+    for (int64_t i = 0; i < len; i++) {
+        dst[i] = src[i] != 0 ? 1 : 0;
+    }
+}
+
+// float -> int casts truncate toward zero like the scalar ones. rvv 0.7 only converts with the
+// dynamic rounding mode, so round to nearest and step back toward zero where that rounded away.
+// |x| >= 2^23 is already integral and passes through, which also keeps it out of the int32 range.
+inline float32xm1_t vftrunc_float32xm1(float32xm1_t x, uint64_t vl)
+{
+    float32xm1_t ax = vfsgnjxvv_float32xm1(x, x, vl);
+    float32xm1_t y  = vfcvtfxv_float32xm1_int32xm1(vfcvtxfv_int32xm1_float32xm1(x, vl), vl);
+
+    e32xm1_t away = vmfltvv_e32xm1_float32xm1(ax, vfsgnjxvv_float32xm1(y, y, vl), vl);
+    y             = vfsubvv_mask_float32xm1(y, y, vfsgnjvv_float32xm1(vfmvvf_float32xm1(1.0f, vl), x, vl), away, vl);
+
+    e32xm1_t integral = vmflevv_e32xm1_float32xm1(vfmvvf_float32xm1(8388608.0f, vl), ax, vl);
+    return vfaddvf_mask_float32xm1(y, x, 0.0f, integral, vl);
+}
+
+static void cast_block_fp32_fp16(const float* src, const int64_t len, __fp16* dst)
+{
+    const int64_t atom = 8;
+    const auto vl      = vsetvli(atom, RVV_E16, RVV_M1);
+
+    int64_t i = 0;
+    for (; i + 2 * atom <= len; i += 2 * atom) {
+        vsev_float16xm1(dst + i + 0 * atom, vfncvtffv_float16xm1_float32xm2(vlev_float32xm2(src + i + 0 * atom, vl), vl), vl);
+        vsev_float16xm1(dst + i + 1 * atom, vfncvtffv_float16xm1_float32xm2(vlev_float32xm2(src + i + 1 * atom, vl), vl), vl);
+    }
+    for (; i < len; i += atom) {
+        const auto tail_vl = vsetvli(len - i, RVV_E16, RVV_M1);
+        vsev_float16xm1(dst + i, vfncvtffv_float16xm1_float32xm2(vlev_float32xm2(src + i, tail_vl), tail_vl), tail_vl);
+    }
+}
+
+static void cast_block_fp16_fp32(const __fp16* src, const int64_t len, float* dst)
+{
+    const int64_t atom = 8;
+    const auto vl      = vsetvli(atom, RVV_E16, RVV_M1);
+
+    int64_t i = 0;
+    for (; i + 2 * atom <= len; i += 2 * atom) {
+        vsev_float32xm2(dst + i + 0 * atom, vfwcvtffv_float32xm2_float16xm1(vlev_float16xm1(src + i + 0 * atom, vl), vl), vl);
+        vsev_float32xm2(dst + i + 1 * atom, vfwcvtffv_float32xm2_float16xm1(vlev_float16xm1(src + i + 1 * atom, vl), vl), vl);
+    }
+    for (; i < len; i += atom) {
+        const auto tail_vl = vsetvli(len - i, RVV_E16, RVV_M1);
+        vsev_float32xm2(dst + i, vfwcvtffv_float32xm2_float16xm1(vlev_float16xm1(src + i, tail_vl), tail_vl), tail_vl);
+    }
+}
+
+static void cast_block_fp32_int32(const float* src, const int64_t len, int32_t* dst)
+{
+    const int64_t atom = 4;
+    const auto vl      = vsetvli(atom, RVV_E32, RVV_M1);
+
+    int64_t i = 0;
+    for (; i + 2 * atom <= len; i += 2 * atom) {
+        vsev_int32xm1(dst + i + 0 * atom, vfcvtxfv_int32xm1_float32xm1(vftrunc_float32xm1(vlev_float32xm1(src + i + 0 * atom, vl), vl), vl), vl);
+        vsev_int32xm1(dst + i + 1 * atom, vfcvtxfv_int32xm1_float32xm1(vftrunc_float32xm1(vlev_float32xm1(src + i + 1 * atom, vl), vl), vl), vl);
+    }
+    for (; i < len; i += atom) {
+        const auto tail_vl = vsetvli(len - i, RVV_E32, RVV_M1);
+        vsev_int32xm1(dst + i, vfcvtxfv_int32xm1_float32xm1(vftrunc_float32xm1(vlev_float32xm1(src + i, tail_vl), tail_vl), tail_vl), tail_vl);
+    }
+}
+
+static void cast_block_int32_fp32(const int32_t* src, const int64_t len, float* dst)
+{
+    const int64_t atom = 4;
+    const auto vl      = vsetvli(atom, RVV_E32, RVV_M1);
+
+    int64_t i = 0;
+    for (; i + 2 * atom <= len; i += 2 * atom) {
+        vsev_float32xm1(dst + i + 0 * atom, vfcvtfxv_float32xm1_int32xm1(vlev_int32xm1(src + i + 0 * atom, vl), vl), vl);
+        vsev_float32xm1(dst + i + 1 * atom, vfcvtfxv_float32xm1_int32xm1(vlev_int32xm1(src + i + 1 * atom, vl), vl), vl);
+    }
+    for (; i < len; i += atom) {
+        const auto tail_vl = vsetvli(len - i, RVV_E32, RVV_M1);
+        vsev_float32xm1(dst + i, vfcvtfxv_float32xm1_int32xm1(vlev_int32xm1(src + i, tail_vl), tail_vl), tail_vl);
+    }
+}
+
+static void cast_block_fp32_int64(const float* src, const int64_t len, int64_t* dst)
+{
+    const int64_t atom = 4;
+    const auto vl      = vsetvli(atom, RVV_E32, RVV_M1);
+
+    int64_t i = 0;
+    for (; i + 2 * atom <= len; i += 2 * atom) {
+        vsev_int64xm2(dst + i + 0 * atom, vfwcvtxfv_int64xm2_float32xm1(vftrunc_float32xm1(vlev_float32xm1(src + i + 0 * atom, vl), vl), vl), vl);
+        vsev_int64xm2(dst + i + 1 * atom, vfwcvtxfv_int64xm2_float32xm1(vftrunc_float32xm1(vlev_float32xm1(src + i + 1 * atom, vl), vl), vl), vl);
+    }
+    for (; i < len; i += atom) {
+        const auto tail_vl = vsetvli(len - i, RVV_E32, RVV_M1);
+        vsev_int64xm2(dst + i, vfwcvtxfv_int64xm2_float32xm1(vftrunc_float32xm1(vlev_float32xm1(src + i, tail_vl), tail_vl), tail_vl), tail_vl);
+    }
+}
+
+static void cast_block_int64_fp32(const int64_t* src, const int64_t len, float* dst)
+{
+    const int64_t atom = 4;
+    const auto vl      = vsetvli(atom, RVV_E32, RVV_M1);
+
+    int64_t i = 0;
+    for (; i + 2 * atom <= len; i += 2 * atom) {
+        vsev_float32xm1(dst + i + 0 * atom, vfncvtfxv_float32xm1_int64xm2(vlev_int64xm2(src + i + 0 * atom, vl), vl), vl);
+        vsev_float32xm1(dst + i + 1 * atom, vfncvtfxv_float32xm1_int64xm2(vlev_int64xm2(src + i + 1 * atom, vl), vl), vl);
+    }
+    for (; i < len; i += atom) {
+        const auto tail_vl = vsetvli(len - i, RVV_E32, RVV_M1);
+        vsev_float32xm1(dst + i, vfncvtfxv_float32xm1_int64xm2(vlev_int64xm2(src + i, tail_vl), tail_vl), tail_vl);
+    }
+}
+
+static void cast_block_int32_int64(const int32_t* src, const int64_t len, int64_t* dst)
+{
+    const int64_t atom = 4;
+    const auto vl      = vsetvli(atom, RVV_E32, RVV_M1);
+
+    int64_t i = 0;
+    for (; i + 2 * atom <= len; i += 2 * atom) {
+        vsev_int64xm2(dst + i + 0 * atom, vwaddvx_int64xm2_int32xm1(vlev_int32xm1(src + i + 0 * atom, vl), 0, vl), vl);
+        vsev_int64xm2(dst + i + 1 * atom, vwaddvx_int64xm2_int32xm1(vlev_int32xm1(src + i + 1 * atom, vl), 0, vl), vl);
+    }
+    for (; i < len; i += atom) {
+        const auto tail_vl = vsetvli(len - i, RVV_E32, RVV_M1);
+        vsev_int64xm2(dst + i, vwaddvx_int64xm2_int32xm1(vlev_int32xm1(src + i, tail_vl), 0, tail_vl), tail_vl);
+    }
+}
+
+// keeps the low 32 bits
+static void cast_block_int64_int32(const int64_t* src, const int64_t len, int32_t* dst)
+{
+    const int64_t atom = 4;
+    const auto vl      = vsetvli(atom, RVV_E32, RVV_M1);
+
+    int64_t i = 0;
+    for (; i + 2 * atom <= len; i += 2 * atom) {
+        vsev_int32xm1(dst + i + 0 * atom, vnsravx_int32xm1_int64xm2(vlev_int64xm2(src + i + 0 * atom, vl), 0, vl), vl);
+        vsev_int32xm1(dst + i + 1 * atom, vnsravx_int32xm1_int64xm2(vlev_int64xm2(src + i + 1 * atom, vl), 0, vl), vl);
+    }
+    for (; i < len; i += atom) {
+        const auto tail_vl = vsetvli(len - i, RVV_E32, RVV_M1);
+        vsev_int32xm1(dst + i, vnsravx_int32xm1_int64xm2(vlev_int64xm2(src + i, tail_vl), 0, tail_vl), tail_vl);
+    }
+}
+
+template <typename srcT, typename dstT>
+static ppl::common::RetCode cast_parallel(
     const ppl::common::TensorShape* src_shape,
-    const ppl::common::TensorShape* dst_shape,
     const srcT* src,
+    const cast_block_func_t<srcT, dstT> block_func,
     dstT* dst)
 {
-    const bool out_bool   = dst_shape->GetDataType() == ppl::common::DATATYPE_BOOL;
-    const uint64_t length = src_shape->CalcElementsIncludingPadding();
+    const int64_t length    = src_shape->CalcElementsIncludingPadding();
+    const int64_t num_block = div_up(length, CAST_BLOCK_LEN());
 
-    if (out_bool) {
-        for (uint64_t i = 0; i < length; i++) {
-            dst[i] = src[i] != 0 ? 1 : 0;
-        }
-    } else {
-        for (uint64_t i = 0; i < length; i++) {
-            dst[i] = src[i];
-        }
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t b = 0; b < num_block; b++) {
+        const int64_t beg = b * CAST_BLOCK_LEN();
+        block_func(src + beg, min(length - beg, CAST_BLOCK_LEN()), dst + beg);
     }
 
     return ppl::common::RC_SUCCESS;
 }
 
+template <typename srcT, typename dstT>
+ppl::common::RetCode cast_kernel(
+    const ppl::common::TensorShape* src_shape,
+    const srcT* src,
+    dstT* dst)
+{
+    return cast_parallel<srcT, dstT>(src_shape, src, cast_block_scalar<srcT, dstT>, dst);
+}
+
+template <typename srcT>
+ppl::common::RetCode cast_kernel_bool(
+    const ppl::common::TensorShape* src_shape,
+    const srcT* src,
+    uint8_t* dst)
+{
+    return cast_parallel<srcT, uint8_t>(src_shape, src, cast_block_scalar_bool<srcT>, dst);
+}
+
 ppl::common::RetCode cast(
     const ppl::common::TensorShape* src_shape,
     const ppl::common::TensorShape* dst_shape,
@@ -60,34 +242,55 @@ ppl::common::RetCode cast(
     }
 
     switch (MAKE_CAST_TYPE(idt, odt)) {
+        case MAKE_CAST_TYPE(ppl::common::DATATYPE_FLOAT16, ppl::common::DATATYPE_FLOAT32):
+            return cast_parallel<__fp16, float>(src_shape, (__fp16*)src, cast_block_fp16_fp32, (float*)dst);
+        case MAKE_CAST_TYPE(ppl::common::DATATYPE_FLOAT16, ppl::common::DATATYPE_INT32):
+            return cast_kernel<__fp16, int32_t>(src_shape, (__fp16*)src, (int32_t*)dst);
         case MAKE_CAST_TYPE(ppl::common::DATATYPE_FLOAT16, ppl::common::DATATYPE_INT64):
-            return cast_kernel<__fp16, int64_t>(src_shape, dst_shape, (__fp16*)src, (int64_t*)dst);
+            return cast_kernel<__fp16, int64_t>(src_shape, (__fp16*)src, (int64_t*)dst);
         case MAKE_CAST_TYPE(ppl::common::DATATYPE_FLOAT16, ppl::common::DATATYPE_BOOL):
-            return cast_kernel<__fp16, uint8_t>(src_shape, dst_shape, (__fp16*)src, (uint8_t*)dst);
+            return cast_kernel_bool<__fp16>(src_shape, (__fp16*)src, (uint8_t*)dst);
 
+        case MAKE_CAST_TYPE(ppl::common::DATATYPE_FLOAT32, ppl::common::DATATYPE_FLOAT16):
+            return cast_parallel<float, __fp16>(src_shape, (float*)src, cast_block_fp32_fp16, (__fp16*)dst);
+        case MAKE_CAST_TYPE(ppl::common::DATATYPE_FLOAT32, ppl::common::DATATYPE_INT32):
+            return cast_parallel<float, int32_t>(src_shape, (float*)src, cast_block_fp32_int32, (int32_t*)dst);
         case MAKE_CAST_TYPE(ppl::common::DATATYPE_FLOAT32, ppl::common::DATATYPE_INT64):
-            return cast_kernel<float, int64_t>(src_shape, dst_shape, (float*)src, (int64_t*)dst);
+            return cast_parallel<float, int64_t>(src_shape, (float*)src, cast_block_fp32_int64, (int64_t*)dst);
         case MAKE_CAST_TYPE(ppl::common::DATATYPE_FLOAT32, ppl::common::DATATYPE_BOOL):
-            return cast_kernel<float, uint8_t>(src_shape, dst_shape, (float*)src, (uint8_t*)dst);
+            return cast_kernel_bool<float>(src_shape, (float*)src, (uint8_t*)dst);
         case MAKE_CAST_TYPE(ppl::common::DATATYPE_FLOAT32, ppl::common::DATATYPE_FLOAT64):
-            return cast_kernel<float, double>(src_shape, dst_shape, (float*)src, (double*)dst);
+            return cast_kernel<float, double>(src_shape, (float*)src, (double*)dst);
 
         case MAKE_CAST_TYPE(ppl::common::DATATYPE_FLOAT64, ppl::common::DATATYPE_FLOAT32):
-            return cast_kernel<double, float>(src_shape, dst_shape, (double*)src, (float*)dst);
+            return cast_kernel<double, float>(src_shape, (double*)src, (float*)dst);
+
+        case MAKE_CAST_TYPE(ppl::common::DATATYPE_INT32, ppl::common::DATATYPE_FLOAT16):
+            return cast_kernel<int32_t, __fp16>(src_shape, (int32_t*)src, (__fp16*)dst);
+        case MAKE_CAST_TYPE(ppl::common::DATATYPE_INT32, ppl::common::DATATYPE_FLOAT32):
+            return cast_parallel<int32_t, float>(src_shape, (int32_t*)src, cast_block_int32_fp32, (float*)dst);
+        case MAKE_CAST_TYPE(ppl::common::DATATYPE_INT32, ppl::common::DATATYPE_INT64):
+            return cast_parallel<int32_t, int64_t>(src_shape, (int32_t*)src, cast_block_int32_int64, (int64_t*)dst);
+        case MAKE_CAST_TYPE(ppl::common::DATATYPE_INT32, ppl::common::DATATYPE_BOOL):
+            return cast_kernel_bool<int32_t>(src_shape, (int32_t*)src, (uint8_t*)dst);
 
         case MAKE_CAST_TYPE(ppl::common::DATATYPE_INT64, ppl::common::DATATYPE_FLOAT16):
-            return cast_kernel<int64_t, __fp16>(src_shape, dst_shape, (int64_t*)src, (__fp16*)dst);
+            return cast_kernel<int64_t, __fp16>(src_shape, (int64_t*)src, (__fp16*)dst);
         case MAKE_CAST_TYPE(ppl::common::DATATYPE_INT64, ppl::common::DATATYPE_FLOAT32):
-            return cast_kernel<int64_t, float>(src_shape, dst_shape, (int64_t*)src, (float*)dst);
+            return cast_parallel<int64_t, float>(src_shape, (int64_t*)src, cast_block_int64_fp32, (float*)dst);
+        case MAKE_CAST_TYPE(ppl::common::DATATYPE_INT64, ppl::common::DATATYPE_INT32):
+            return cast_parallel<int64_t, int32_t>(src_shape, (int64_t*)src, cast_block_int64_int32, (int32_t*)dst);
         case MAKE_CAST_TYPE(ppl::common::DATATYPE_INT64, ppl::common::DATATYPE_BOOL):
-            return cast_kernel<int64_t, uint8_t>(src_shape, dst_shape, (int64_t*)src, (uint8_t*)dst);
+            return cast_kernel_bool<int64_t>(src_shape, (int64_t*)src, (uint8_t*)dst);
 
         case MAKE_CAST_TYPE(ppl::common::DATATYPE_BOOL, ppl::common::DATATYPE_FLOAT16):
-            return cast_kernel<uint8_t, __fp16>(src_shape, dst_shape, (uint8_t*)src, (__fp16*)dst);
+            return cast_kernel<uint8_t, __fp16>(src_shape, (uint8_t*)src, (__fp16*)dst);
         case MAKE_CAST_TYPE(ppl::common::DATATYPE_BOOL, ppl::common::DATATYPE_FLOAT32):
-            return cast_kernel<uint8_t, float>(src_shape, dst_shape, (uint8_t*)src, (float*)dst);
+            return cast_kernel<uint8_t, float>(src_shape, (uint8_t*)src, (float*)dst);
+        case MAKE_CAST_TYPE(ppl::common::DATATYPE_BOOL, ppl::common::DATATYPE_INT32):
+            return cast_kernel<uint8_t, int32_t>(src_shape, (uint8_t*)src, (int32_t*)dst);
         case MAKE_CAST_TYPE(ppl::common::DATATYPE_BOOL, ppl::common::DATATYPE_INT64):
-            return cast_kernel<uint8_t, int64_t>(src_shape, dst_shape, (uint8_t*)src, (int64_t*)dst);
+            return cast_kernel<uint8_t, int64_t>(src_shape, (uint8_t*)src, (int64_t*)dst);
         default:
             return ppl::common::RC_UNSUPPORTED;
     }
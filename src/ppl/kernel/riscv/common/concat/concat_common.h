@@ -19,12 +19,40 @@
 #define __ST_PPL_KERNEL_RISCV_COMMON_CONCAT_COMMON_H_
 
 #include <vector>
-#include <cstring>
 
 #include "ppl/kernel/riscv/common/internal_include.h"
+#include "ppl/kernel/riscv/common/memory.h"
+#include "ppl/kernel/riscv/common/nbcx_lane.h"
 
 namespace ppl { namespace kernel { namespace riscv {
 
+// copies the contiguous run of each input, run_len[n] elements per outer row, to dst_offset[n] of every dst row
+template <typename T>
+void concat_common_copy_runs(
+    const T** src_list,
+    const int64_t* run_len,
+    const int64_t* dst_offset,
+    const int64_t dst_row_len,
+    const int64_t outer_dim,
+    const int32_t num_src,
+    T* dst)
+{
+    if (outer_dim == 1 && num_src < PPL_OMP_MAX_THREADS()) {
+        // a few long runs, memory_copy threads each of them
+        for (int32_t n = 0; n < num_src; n++) {
+            memory_copy(src_list[n], run_len[n] * sizeof(T), dst + dst_offset[n]);
+        }
+        return;
+    }
+
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t t = 0; t < outer_dim * num_src; t++) {
+        const int64_t i = t / num_src;
+        const int64_t n = t % num_src;
+        memory_copy(src_list[n] + i * run_len[n], run_len[n] * sizeof(T), dst + i * dst_row_len + dst_offset[n]);
+    }
+}
+
 template <typename T, int32_t c_blk>
 ppl::common::RetCode concat_nbcx(
     const T** src_list,
@@ -55,38 +83,18 @@ ppl::common::RetCode concat_nbcx(
         }
     }
 
+    // everything behind the concat axis is one contiguous run per outer row
+    std::vector<int64_t> run_len(num_src);
     std::vector<int64_t> dst_offset(num_src);
-    dst_offset[0]          = 0;
-    int64_t dst_concat_dim = 0;
-    if (axis == c_dim_idx) {
-        for (int32_t i = 1; i < num_src; i++) {
-            dst_offset[i] = dst_offset[i - 1] + div_up(src_shape_list[i - 1]->GetDim(axis), c_blk);
-        }
-        dst_concat_dim = dst_offset[num_src - 1] + div_up(src_shape_list[num_src - 1]->GetDim(axis), c_blk);
-    } else {
-        for (int32_t i = 1; i < num_src; i++) {
-            dst_offset[i] = dst_offset[i - 1] + src_shape_list[i - 1]->GetDim(axis);
-        }
-        dst_concat_dim = dst_offset[num_src - 1] + src_shape_list[num_src - 1]->GetDim(axis);
+    int64_t dst_row_len = 0;
+    for (int32_t n = 0; n < num_src; n++) {
+        const int64_t concat_dim = axis == c_dim_idx ? div_up(src_shape_list[n]->GetDim(axis), c_blk) : src_shape_list[n]->GetDim(axis);
+        run_len[n]               = concat_dim * inner_dim;
+        dst_offset[n]            = dst_row_len;
+        dst_row_len += run_len[n];
     }
 
-    if (axis == c_dim_idx) {
-        for (int64_t i = 0; i < outer_dim; i++) {
-            for (int64_t n = 0; n < num_src; n++) {
-                memcpy(dst + (i * dst_concat_dim + dst_offset[n]) * inner_dim,
-                       src_list[n] + i * div_up(src_shape_list[n]->GetDim(axis), c_blk) * inner_dim,
-                       div_up(src_shape_list[n]->GetDim(axis), c_blk) * inner_dim * sizeof(T));
-            }
-        }
-    } else {
-        for (int64_t i = 0; i < outer_dim; i++) {
-            for (int64_t n = 0; n < num_src; n++) {
-                memcpy(dst + (i * dst_concat_dim + dst_offset[n]) * inner_dim,
-                       src_list[n] + i * src_shape_list[n]->GetDim(axis) * inner_dim,
-                       src_shape_list[n]->GetDim(axis) * inner_dim * sizeof(T));
-            }
-        }
-    }
+    concat_common_copy_runs<T>(src_list, run_len.data(), dst_offset.data(), dst_row_len, outer_dim, num_src, dst);
 
     return ppl::common::RC_SUCCESS;
 }
@@ -112,20 +120,17 @@ ppl::common::RetCode concat_ndarray(
         inner_dim *= src_shape_list[0]->GetDim(i);
     }
 
+    // everything behind the concat axis is one contiguous run per outer row
+    std::vector<int64_t> run_len(num_src);
     std::vector<int64_t> dst_offset(num_src);
-    dst_offset[0] = 0;
-    for (int32_t i = 1; i < num_src; i++) {
-        dst_offset[i] = dst_offset[i - 1] + src_shape_list[i - 1]->GetDim(axis);
+    int64_t dst_row_len = 0;
+    for (int32_t n = 0; n < num_src; n++) {
+        run_len[n]    = src_shape_list[n]->GetDim(axis) * inner_dim;
+        dst_offset[n] = dst_row_len;
+        dst_row_len += run_len[n];
     }
-    const int64_t dst_concat_dim = dst_offset[num_src - 1] + src_shape_list[num_src - 1]->GetDim(axis);
 
-    for (int64_t i = 0; i < outer_dim; i++) {
-        for (int64_t n = 0; n < num_src; n++) {
-            memcpy(dst + (i * dst_concat_dim + dst_offset[n]) * inner_dim,
-                   src_list[n] + i * src_shape_list[n]->GetDim(axis) * inner_dim,
-                   src_shape_list[n]->GetDim(axis) * inner_dim * sizeof(T));
-        }
-    }
+    concat_common_copy_runs<T>(src_list, run_len.data(), dst_offset.data(), dst_row_len, outer_dim, num_src, dst);
 
     return ppl::common::RC_SUCCESS;
 }
@@ -158,33 +163,44 @@ ppl::common::RetCode concat_nbcx_interleave_channels(
 
     const int64_t dst_channels = dst_offset[num_src - 1] + src_shape_list[num_src - 1]->GetDim(c_dim_idx);
     const int64_t padded_oc    = round_up(dst_channels, c_blk);
-
-    for (int64_t i = 0; i < outer_dim; i++) {
+    const int64_t num_blks     = div_up(inner_dim, NBCX_INTERLEAVE_INNER_BLK());
+
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t t = 0; t < outer_dim * num_blks; t++) {
+        const int64_t i        = t / num_blks;
+        const int64_t id_start = (t % num_blks) * NBCX_INTERLEAVE_INNER_BLK();
+        const int64_t id_len   = min(inner_dim - id_start, (int64_t)NBCX_INTERLEAVE_INNER_BLK());
+        // inputs go in order, so the padding lanes one input leaves in a shared block are overwritten by the next
         for (int64_t n = 0; n < num_src; n++) {
             const int32_t src_channels = src_shape_list[n]->GetDim(c_dim_idx);
             const int32_t padded_ic    = round_up(src_channels, c_blk);
             for (int32_t ic = 0; ic < padded_ic; ic += c_blk) {
                 const int32_t oc = dst_offset[n] + ic;
-                const T* src_    = src_list[n] + i * padded_ic * inner_dim + ic * inner_dim;
-                T* dst_          = dst + i * padded_oc * inner_dim + round(oc, c_blk) * inner_dim;
+                const T* src_    = src_list[n] + i * padded_ic * inner_dim + ic * inner_dim + id_start * c_blk;
+                T* dst_          = dst + i * padded_oc * inner_dim + round(oc, c_blk) * inner_dim + id_start * c_blk;
                 if (oc % c_blk == 0) { //  no interleave on this xc
-                    memcpy(dst_, src_, inner_dim * c_blk * sizeof(T));
+                    memory_copy(src_, id_len * c_blk * sizeof(T), dst_);
                 } else { //  has interleave on this xc
                     const int32_t c_offset = c_blk - (oc % c_blk);
                     const int32_t c_end    = min(src_channels - ic, (int32_t)c_blk);
                     T* dst_next_xc         = dst_ + c_blk * inner_dim;
-                    for (int64_t id = 0; id < inner_dim; id++) {
-                        // interleave copy
-                        for (int32_t c = 0; c < c_offset; c++) {
-                            dst_[id * c_blk + c_blk - c_offset + c] = src_[id * c_blk + c];
-                        }
-                        for (int32_t c = c_offset; c < c_end; c++) {
-                            dst_next_xc[id * c_blk + c - c_offset] = src_[id * c_blk + c];
-                        }
+                    for (int32_t c = 0; c < min(c_offset, c_end); c++) {
+                        nbcx_copy_lane<T, c_blk>(src_ + c, id_len, dst_ + c_blk - c_offset + c);
+                    }
+                    for (int32_t c = c_offset; c < c_end; c++) {
+                        nbcx_copy_lane<T, c_blk>(src_ + c, id_len, dst_next_xc + c - c_offset);
                     }
                 }
             }
         }
+        // full src blocks carry their own padding lanes, so the padding of the last dst block is cleared last
+        const int32_t c_tail = dst_channels % c_blk;
+        if (c_tail != 0) {
+            T* dst_last = dst + i * padded_oc * inner_dim + (padded_oc - c_blk) * inner_dim + id_start * c_blk;
+            for (int32_t c = c_tail; c < c_blk; c++) {
+                nbcx_zero_lane<T, c_blk>(id_len, dst_last + c);
+            }
+        }
     }
 
     return ppl::common::RC_SUCCESS;
@@ -91,11 +91,9 @@ void fc_common_cvt_flt_to_nxcx(
 }
 
 
+// per thread src / flt / dst tiles, each thread buffer is aligned to a cache line
 template <typename T, int64_t atom_n, int64_t atom_k>
-uint64_t fc_common_cal_temp_buffer_size(
-    int32_t m,
-    int32_t n,
-    int32_t k,
+uint64_t fc_common_cal_thread_temp_buffer_size(
     const fc_tunning_param &tunning_param
 ) {
     fc_tunning_param pad_param = {
@@ -108,10 +106,24 @@ uint64_t fc_common_cal_temp_buffer_size(
     uint64_t src_tile_size = pad_param.m_blk * pad_param.k_blk * data_size;
     uint64_t flt_tile_size = pad_param.k_blk * pad_param.n_blk * data_size;
     uint64_t dst_tile_size = pad_param.m_blk * pad_param.n_blk * data_size;
-    
-    return src_tile_size + flt_tile_size + dst_tile_size;
+
+    return round_up(src_tile_size + flt_tile_size + dst_tile_size, 64);
 }
 
+template <typename T, int64_t atom_n, int64_t atom_k>
+uint64_t fc_common_cal_temp_buffer_size(
+    int32_t m,
+    int32_t n,
+    int32_t k,
+    const fc_tunning_param &tunning_param
+) {
+    int64_t num_thread = max(tunning_param.num_thread, (int64_t)1);
+    return fc_common_cal_thread_temp_buffer_size<T, atom_n, atom_k>(tunning_param) * num_thread;
+}
+
+// tiles are (n, m) pairs split into contiguous ranges over threads, so a thread
+// mostly walks m tiles of the same filter block. k tiles of one output tile are
+// reduced in order: first_tile_kernel_func adds bias, tile_kernel_func accumulates on dst.
 template <typename T, int64_t atom_oc, int64_t atom_ic>
 ppl::common::RetCode fc_common_blocking_execute(
     const T* src,
@@ -123,6 +135,7 @@ ppl::common::RetCode fc_common_blocking_execute(
     int32_t num_channels,
     int32_t num_outs,
     const fc_tunning_param &tunning_param,
+    const fc_common_gemm_kernel<T> first_tile_kernel_func,
     const fc_common_gemm_kernel<T> tile_kernel_func
 ) {
     fc_tunning_param pad_param = {
@@ -131,70 +144,87 @@ ppl::common::RetCode fc_common_blocking_execute(
         round_up(tunning_param.k_blk, atom_ic)
     };
 
-    T* src_tile = (T*)temp_buffer;
-    T* flt_tile = src_tile + pad_param.m_blk * pad_param.k_blk;
-    T* dst_tile = flt_tile + pad_param.k_blk * pad_param.n_blk;
-
     int64_t pad_num_channels = round_up(num_channels, atom_ic);
     int64_t pad_num_outs = round_up(num_outs, atom_oc);
 
-    for (int64_t n_tile_beg = 0; n_tile_beg < pad_num_outs; n_tile_beg += pad_param.n_blk) {
-        int64_t n_tile_len = min(pad_num_outs - n_tile_beg, pad_param.n_blk);
-        auto bias_ = bias + n_tile_beg;
-
-        for (int64_t m_tile_beg = 0; m_tile_beg < batch; m_tile_beg += pad_param.m_blk) {
-            int64_t m_tile_len = min(batch - m_tile_beg, pad_param.m_blk);
-            
-            for (int64_t k_tile_beg = 0; k_tile_beg < pad_num_channels; k_tile_beg += pad_param.k_blk) {
-                int64_t k_tile_len = min(pad_num_channels - k_tile_beg, pad_param.k_blk);
-                
-                // load src tile
-                fc_common_load_tile(
-                    src,
-                    src_tile,
+    const int64_t num_m_tile = div_up(batch, pad_param.m_blk);
+    const int64_t num_n_tile = div_up(pad_num_outs, pad_param.n_blk);
+    const int64_t num_tile = num_m_tile * num_n_tile;
+    const int64_t num_thread = max(tunning_param.num_thread, (int64_t)1);
+    const uint64_t thread_buffer_size = fc_common_cal_thread_temp_buffer_size<T, atom_oc, atom_ic>(tunning_param);
+
+    PRAGMA_OMP_PARALLEL()
+    {
+        // temp_buffer only holds num_thread buffers, extra threads stay idle
+        const int64_t thread_id = PPL_OMP_THREAD_ID();
+        const int64_t num_worker = min((int64_t)PPL_OMP_NUM_THREADS(), num_thread);
+
+        if (thread_id < num_worker) {
+            T* src_tile = (T*)((uint8_t*)temp_buffer + thread_id * thread_buffer_size);
+            T* flt_tile = src_tile + pad_param.m_blk * pad_param.k_blk;
+            T* dst_tile = flt_tile + pad_param.k_blk * pad_param.n_blk;
+
+            const int64_t tile_beg = num_tile * thread_id / num_worker;
+            const int64_t tile_end = num_tile * (thread_id + 1) / num_worker;
+            for (int64_t tile_idx = tile_beg; tile_idx < tile_end; tile_idx += 1) {
+                int64_t n_tile_beg = tile_idx / num_m_tile * pad_param.n_blk;
+                int64_t m_tile_beg = tile_idx % num_m_tile * pad_param.m_blk;
+                int64_t n_tile_len = min(pad_num_outs - n_tile_beg, pad_param.n_blk);
+                int64_t m_tile_len = min(batch - m_tile_beg, pad_param.m_blk);
+                auto bias_ = bias + n_tile_beg;
+
+                for (int64_t k_tile_beg = 0; k_tile_beg < pad_num_channels; k_tile_beg += pad_param.k_blk) {
+                    int64_t k_tile_len = min(pad_num_channels - k_tile_beg, pad_param.k_blk);
+
+                    // load src tile
+                    fc_common_load_tile(
+                        src,
+                        src_tile,
+                        batch,
+                        pad_num_channels,
+                        m_tile_beg,
+                        m_tile_len,
+                        k_tile_beg,
+                        k_tile_len
+                    );
+
+                    // load flt tile
+                    fc_common_load_tile(
+                        flt,
+                        flt_tile,
+                        pad_num_outs / atom_oc,
+                        pad_num_channels * atom_oc,
+                        n_tile_beg / atom_oc,
+                        n_tile_len / atom_oc,
+                        k_tile_beg * atom_oc,
+                        k_tile_len * atom_oc
+                    );
+
+                    // tile kernel
+                    auto kernel_func = k_tile_beg == 0 ? first_tile_kernel_func : tile_kernel_func;
+                    kernel_func(
+                        src_tile,
+                        flt_tile,
+                        bias_,
+                        dst_tile,
+                        m_tile_len,
+                        n_tile_len,
+                        k_tile_len
+                    );
+                }
+
+                // store dst tile
+                fc_common_store_tile(
+                    dst_tile,
+                    dst,
                     batch,
-                    pad_num_channels,
+                    pad_num_outs,
                     m_tile_beg,
                     m_tile_len,
-                    k_tile_beg,
-                    k_tile_len
-                );
-
-                // load flt tile
-                fc_common_load_tile(
-                    flt,
-                    flt_tile,
-                    pad_num_outs / atom_oc,
-                    pad_num_channels * atom_oc,
-                    n_tile_beg / atom_oc,
-                    n_tile_len / atom_oc,
-                    k_tile_beg * atom_oc,
-                    k_tile_len * atom_oc
+                    n_tile_beg,
+                    n_tile_len
                 );
-
-                // tile kernel
-                tile_kernel_func(
-                    src_tile,
-                    flt_tile,
-                    bias_,
-                    dst_tile,
-                    m_tile_len,
-                    n_tile_len,
-                    k_tile_len
-                );
-
             }
-            // store dst tile
-            fc_common_store_tile(
-                dst_tile,
-                dst,
-                batch,
-                pad_num_outs,
-                m_tile_beg,
-                m_tile_len,
-                n_tile_beg,
-                n_tile_len
-            );
         }
     }
 
@@ -105,11 +105,9 @@ void fc_ndarray_common_cvt_flt_to_nxcx(
 }
 
 
-template <typename T, int64_t atom_n, int64_t atom_k, int64_t flt_atom_oc>
-uint64_t fc_ndarray_common_cal_temp_buffer_size(
-    int32_t m,
-    int32_t n,
-    int32_t k,
+// per thread src / dst tiles, flt is read in place. each thread buffer is aligned to a cache line
+template <typename T, int64_t atom_k, int64_t flt_atom_oc>
+uint64_t fc_ndarray_common_cal_thread_temp_buffer_size(
     const fc_tunning_param &tunning_param
 ) {
     fc_tunning_param pad_param = {
@@ -119,14 +117,24 @@ uint64_t fc_ndarray_common_cal_temp_buffer_size(
     };
 
     uint64_t data_size = sizeof(T);
-    uint64_t src_trans_size = m * round_up(k, atom_k) * data_size;
     uint64_t src_tile_size = pad_param.m_blk * pad_param.k_blk * data_size;
-    uint64_t flt_tile_size = pad_param.n_blk * pad_param.k_blk * data_size;
     uint64_t dst_tile_size = pad_param.m_blk * pad_param.n_blk * data_size;
-    
-    return src_tile_size + dst_tile_size;
+
+    return round_up(src_tile_size + dst_tile_size, 64);
 }
 
+template <typename T, int64_t atom_n, int64_t atom_k, int64_t flt_atom_oc>
+uint64_t fc_ndarray_common_cal_temp_buffer_size(
+    int32_t m,
+    int32_t n,
+    int32_t k,
+    const fc_tunning_param &tunning_param
+) {
+    int64_t num_thread = max(tunning_param.num_thread, (int64_t)1);
+    return fc_ndarray_common_cal_thread_temp_buffer_size<T, atom_k, flt_atom_oc>(tunning_param) * num_thread;
+}
+
+// tiles are (n, m) pairs split into contiguous ranges over threads, see fc_common_blocking_execute
 template <typename T, int64_t atom_oc, int64_t atom_ic, int64_t flt_atom_oc>
 ppl::common::RetCode fc_ndarray_common_blocking_execute(
     const T* src,
@@ -150,29 +158,40 @@ ppl::common::RetCode fc_ndarray_common_blocking_execute(
     int64_t pad_num_channels = round_up(num_channels, atom_ic);
     int64_t pad_num_outs = round_up(num_outs, atom_oc);
 
-    T* src_tile = (T*)temp_buffer;
-    // T* flt_tile = src_tile + pad_param.m_blk * pad_param.k_blk;
-    // T* dst_tile = flt_tile + pad_param.n_blk * pad_param.k_blk;
-    T* dst_tile = src_tile + pad_param.m_blk * pad_param.k_blk;
-
-    // loop n
-    for (int64_t n_tile_beg = 0; n_tile_beg < pad_num_outs; n_tile_beg += pad_param.n_blk) {
-        int64_t pad_n_tile_len = min(pad_num_outs - n_tile_beg, pad_param.n_blk);
-        int64_t n_tile_len = min(num_outs - n_tile_beg, pad_param.n_blk);
-        auto bias_ = bias + n_tile_beg;
+    const int64_t num_m_tile = div_up(batch, pad_param.m_blk);
+    const int64_t num_n_tile = div_up(pad_num_outs, pad_param.n_blk);
+    const int64_t num_tile = num_m_tile * num_n_tile;
+    const int64_t num_thread = max(tunning_param.num_thread, (int64_t)1);
+    const uint64_t thread_buffer_size = fc_ndarray_common_cal_thread_temp_buffer_size<T, atom_ic, flt_atom_oc>(tunning_param);
+
+    PRAGMA_OMP_PARALLEL()
+    {
+        // temp_buffer only holds num_thread buffers, extra threads stay idle
+        const int64_t thread_id = PPL_OMP_THREAD_ID();
+        const int64_t num_worker = min((int64_t)PPL_OMP_NUM_THREADS(), num_thread);
+
+        if (thread_id < num_worker) {
+            T* src_tile = (T*)((uint8_t*)temp_buffer + thread_id * thread_buffer_size);
+            T* dst_tile = src_tile + pad_param.m_blk * pad_param.k_blk;
+
+            const int64_t tile_beg = num_tile * thread_id / num_worker;
+            const int64_t tile_end = num_tile * (thread_id + 1) / num_worker;
+            for (int64_t tile_idx = tile_beg; tile_idx < tile_end; tile_idx += 1) {
+                int64_t n_tile_beg = tile_idx / num_m_tile * pad_param.n_blk;
+                int64_t m_tile_beg = tile_idx % num_m_tile * pad_param.m_blk;
+                int64_t pad_n_tile_len = min(pad_num_outs - n_tile_beg, pad_param.n_blk);
+                int64_t n_tile_len = min(num_outs - n_tile_beg, pad_param.n_blk);
+                int64_t m_tile_len = min(batch - m_tile_beg, pad_param.m_blk);
+                auto bias_ = bias + n_tile_beg;
+
+                auto first_tile_kernel_func = first_tile_select_kernel_func(m_tile_len, n_tile_len);
+                auto tile_kernel_func = tile_select_kernel_func(m_tile_len, n_tile_len);
 
-        // loop m
-        for (int64_t m_tile_beg = 0; m_tile_beg < batch; m_tile_beg += pad_param.m_blk) {
-            int64_t m_tile_len = min(batch - m_tile_beg, pad_param.m_blk);
-            
-            // loop k
-            {
-                int64_t k_tile_beg = 0;
-                {
+                // loop k
+                for (int64_t k_tile_beg = 0; k_tile_beg < pad_num_channels; k_tile_beg += pad_param.k_blk) {
                     int64_t pad_k_tile_len = min(pad_num_channels - k_tile_beg, pad_param.k_blk);
                     int64_t k_tile_len = min(num_channels - k_tile_beg, pad_param.k_blk);
 
-                    auto first_tile_kernel_func = first_tile_select_kernel_func(m_tile_len, n_tile_len);
                     auto flt_tile = flt + n_tile_beg * pad_num_channels + k_tile_beg * flt_atom_oc;
 
                     // load src tile
@@ -190,7 +209,8 @@ ppl::common::RetCode fc_ndarray_common_blocking_execute(
                     );
 
                     // tile kernel
-                    first_tile_kernel_func(
+                    auto kernel_func = k_tile_beg == 0 ? first_tile_kernel_func : tile_kernel_func;
+                    kernel_func(
                         src_tile,
                         flt_tile,
                         bias_,
@@ -199,57 +219,22 @@ ppl::common::RetCode fc_ndarray_common_blocking_execute(
                         pad_n_tile_len,
                         pad_k_tile_len
                     );
-
-                    k_tile_beg += pad_param.k_blk;
                 }
 
-                auto tile_kernel_func = tile_select_kernel_func(m_tile_len, n_tile_len);
-                for (; k_tile_beg < pad_num_channels; k_tile_beg += pad_param.k_blk) {
-                    int64_t pad_k_tile_len = min(pad_num_channels - k_tile_beg, pad_param.k_blk);
-                    int64_t k_tile_len = min(num_channels - k_tile_beg, pad_param.k_blk);
-
-                    auto flt_tile = flt + n_tile_beg * pad_num_channels + k_tile_beg * flt_atom_oc;
-
-                    // load src tile
-                    fc_ndarray_common_load_src(
-                        src,
-                        src_tile,
-                        batch,          // src_h
-                        num_channels,   // src_w
-                        m_tile_len,     // src_tile_h
-                        pad_k_tile_len, // src_tile_w
-                        m_tile_beg,
-                        m_tile_len,
-                        k_tile_beg,
-                        k_tile_len
-                    );
-
-                    // tile kernel
-                    tile_kernel_func(
-                        src_tile,
-                        flt_tile,
-                        bias_,
-                        dst_tile,
-                        m_tile_len,
-                        pad_n_tile_len,
-                        pad_k_tile_len
-                    );
-                }
+                // store dst tile
+                fc_ndarray_common_store_dst(
+                    dst_tile,
+                    dst,
+                    batch,          // dst_h
+                    num_outs,       // dst_w
+                    m_tile_len,     // dst_tile_h
+                    pad_n_tile_len, // dst_tile_w
+                    m_tile_beg,
+                    m_tile_len,
+                    n_tile_beg,
+                    n_tile_len
+                );
             }
-
-            // store dst tile
-            fc_ndarray_common_store_dst(
-                dst_tile,
-                dst,
-                batch,          // dst_h
-                num_outs,       // dst_w
-                m_tile_len,     // dst_tile_h
-                pad_n_tile_len, // dst_tile_w
-                m_tile_beg,
-                m_tile_len,
-                n_tile_beg,
-                n_tile_len
-            );
         }
     }
 
@@ -18,11 +18,27 @@
 #ifndef __ST_PPL_KERNEL_RISCV_COMMON_GATHER_GATHER_COMMON_H_
 #define __ST_PPL_KERNEL_RISCV_COMMON_GATHER_GATHER_COMMON_H_
 
+#include <riscv-vector.h>
+
 #include "ppl/kernel/riscv/common/internal_include.h"
-#include <cstring>
 
 namespace ppl { namespace kernel { namespace riscv {
 
+// slices below this many elements are gathered element by element
+#define GATHER_BULK_MIN_INNER() 4
+
+// byte copy of one slice, slices are too small for the threaded memory_copy to pay off
+inline void gather_common_copy(const void* src, const int64_t num_bytes, void* dst)
+{
+    const uint8_t* src_p = (const uint8_t*)src;
+    uint8_t* dst_p       = (uint8_t*)dst;
+    for (int64_t i = 0; i < num_bytes;) {
+        const auto vl = vsetvli(num_bytes - i, RVV_E8, RVV_M8);
+        vsev_uint8xm8(dst_p + i, vlev_uint8xm8(src_p + i, vl), vl);
+        i += vl;
+    }
+}
+
 template <typename T>
 ppl::common::RetCode gather_ndarray_common(
     const T* src,
@@ -35,54 +51,35 @@ ppl::common::RetCode gather_ndarray_common(
     const int64_t num_indices,
     const int64_t indices_dim)
 {
-    if (inner_dim >= 4) {
-        for (int64_t o = 0; o < outer_dim; ++o) {
-            for (int64_t k = 0; k < num_indices; ++k) {
-                for (int64_t i = 0; i < indices_dim; ++i) {
-                    T* dst_l = dst + o * num_indices * indices_dim * inner_dim;
-                    dst_l += k * indices_dim * inner_dim + i * inner_dim;
-                    int64_t index  = indices[k * indices_dim + i];
-                    const T* src_l = src + o * gather_dim * inner_dim + index * inner_dim;
-                    memcpy(dst_l, src_l, inner_dim * sizeof(T));
-                }
-            }
-        }
-    } else if (inner_dim >= 2) {
-        for (int64_t o = 0; o < outer_dim; ++o) {
-            for (int64_t k = 0; k < num_indices; ++k) {
-                T* dst_l = dst + o * num_indices * indices_dim * inner_dim;
-                dst_l += k * indices_dim * inner_dim;
-                const int64_t* indices_l = indices + k * indices_dim;
-                const T* src_l           = src + o * gather_dim * inner_dim;
-                if (inner_dim == 2) {
-                    for (int64_t i = 0; i < indices_dim; ++i) {
-                        dst_l[0] = src_l[indices_l[0] * 2 + 0];
-                        dst_l[1] = src_l[indices_l[0] * 2 + 1];
-                        dst_l += inner_dim;
-                        ++indices_l;
-                    }
-                } else {
-                    for (int64_t i = 0; i < indices_dim; ++i) {
-                        dst_l[0] = src_l[indices_l[0] * 3 + 0];
-                        dst_l[1] = src_l[indices_l[0] * 3 + 1];
-                        dst_l[2] = src_l[indices_l[0] * 3 + 2];
-                        dst_l += inner_dim;
-                        ++indices_l;
-                    }
-                }
-            }
+    const int64_t total_indices = num_indices * indices_dim;
+
+    if (inner_dim >= GATHER_BULK_MIN_INNER()) {
+        // every index selects a contiguous slice of inner_dim elements
+        PRAGMA_OMP_PARALLEL_FOR()
+        for (int64_t s = 0; s < outer_dim * total_indices; ++s) {
+            const int64_t o = s / total_indices;
+            int64_t index   = indices[s % total_indices];
+            index           = index < 0 ? index + gather_dim : index;
+            gather_common_copy(src + (o * gather_dim + index) * inner_dim, inner_dim * sizeof(T), dst + s * inner_dim);
         }
     } else {
-        for (int64_t o = 0; o < outer_dim; ++o) {
-            for (int64_t k = 0; k < num_indices; ++k) {
-                T* dst_l                 = dst + o * num_indices * indices_dim + k * indices_dim;
-                const int64_t* indices_l = indices + k * indices_dim;
-                const T* src_l           = src + o * gather_dim;
-                for (int64_t i = 0; i < indices_dim; ++i) {
-                    dst_l[0] = src_l[indices_l[0]];
-                    ++dst_l;
-                    ++indices_l;
+        const int64_t blk_len  = 1024;
+        const int64_t num_blks = div_up(total_indices, blk_len);
+        PRAGMA_OMP_PARALLEL_FOR()
+        for (int64_t t = 0; t < outer_dim * num_blks; ++t) {
+            const int64_t o          = t / num_blks;
+            const int64_t i_start    = (t % num_blks) * blk_len;
+            const int64_t i_end      = min(i_start + blk_len, total_indices);
+            const T* src_l           = src + o * gather_dim * inner_dim;
+            const int64_t* indices_l = indices + i_start;
+            T* dst_l                 = dst + (o * total_indices + i_start) * inner_dim;
+            for (int64_t i = i_start; i < i_end; ++i) {
+                const int64_t index = indices_l[0] < 0 ? indices_l[0] + gather_dim : indices_l[0];
+                for (int64_t j = 0; j < inner_dim; ++j) {
+                    dst_l[j] = src_l[index * inner_dim + j];
                 }
+                dst_l += inner_dim;
+                ++indices_l;
             }
         }
     }
@@ -0,0 +1,94 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_PPL_KERNEL_RISCV_COMMON_GATHER_ELEMENTS_GATHER_ELEMENTS_COMMON_H_
+#define __ST_PPL_KERNEL_RISCV_COMMON_GATHER_ELEMENTS_GATHER_ELEMENTS_COMMON_H_
+
+#include <vector>
+
+#include "ppl/kernel/riscv/common/internal_include.h"
+
+namespace ppl { namespace kernel { namespace riscv {
+
+template <typename T>
+ppl::common::RetCode gather_elements_ndarray_common(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *indices_shape,
+    const T *src,
+    const int64_t *indices,
+    const int64_t axis,
+    T *dst)
+{
+    const int64_t dim_count = indices_shape->GetDimCount();
+    if (dim_count > PPL_RISCV_TENSOR_MAX_DIMS()) {
+        return ppl::common::RC_UNSUPPORTED;
+    }
+    const int64_t real_axis = axis < 0 ? axis + dim_count : axis;
+
+    int64_t src_strides[PPL_RISCV_TENSOR_MAX_DIMS()];
+    src_strides[dim_count - 1] = 1;
+    for (int64_t i = dim_count - 2; i >= 0; --i) {
+        src_strides[i] = src_strides[i + 1] * src_shape->GetDim(i + 1);
+    }
+
+    const int64_t axis_dim         = src_shape->GetDim(real_axis);
+    const int64_t axis_stride      = src_strides[real_axis];
+    const int64_t indices_axis_dim = indices_shape->GetDim(real_axis);
+    int64_t outer_dim              = 1;
+    int64_t inner_dim              = 1;
+    for (int64_t i = 0; i < real_axis; ++i) {
+        outer_dim *= indices_shape->GetDim(i);
+    }
+    for (int64_t i = real_axis + 1; i < dim_count; ++i) {
+        inner_dim *= indices_shape->GetDim(i);
+    }
+
+    // src offset of every inner position of indices, the identity when their inner dims match src
+    std::vector<int64_t> inner_offset(inner_dim);
+    for (int64_t j = 0; j < inner_dim; ++j) {
+        int64_t rem    = j;
+        int64_t offset = 0;
+        for (int64_t i = dim_count - 1; i > real_axis; --i) {
+            offset += (rem % indices_shape->GetDim(i)) * src_strides[i];
+            rem /= indices_shape->GetDim(i);
+        }
+        inner_offset[j] = offset;
+    }
+
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t r = 0; r < outer_dim * indices_axis_dim; ++r) {
+        int64_t rem       = r / indices_axis_dim;
+        int64_t src_outer = 0;
+        for (int64_t i = real_axis - 1; i >= 0; --i) {
+            src_outer += (rem % indices_shape->GetDim(i)) * src_strides[i];
+            rem /= indices_shape->GetDim(i);
+        }
+        const T *src_l           = src + src_outer;
+        const int64_t *indices_l = indices + r * inner_dim;
+        T *dst_l                 = dst + r * inner_dim;
+        for (int64_t j = 0; j < inner_dim; ++j) {
+            const int64_t index = indices_l[j] < 0 ? indices_l[j] + axis_dim : indices_l[j];
+            dst_l[j]            = src_l[index * axis_stride + inner_offset[j]];
+        }
+    }
+
+    return ppl::common::RC_SUCCESS;
+}
+
+}}}; //  namespace ppl::kernel::riscv
+
+#endif //  __ST_PPL_KERNEL_RISCV_COMMON_GATHER_ELEMENTS_GATHER_ELEMENTS_COMMON_H_
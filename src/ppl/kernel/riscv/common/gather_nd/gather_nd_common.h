@@ -0,0 +1,64 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_PPL_KERNEL_RISCV_COMMON_GATHER_ND_GATHER_ND_COMMON_H_
+#define __ST_PPL_KERNEL_RISCV_COMMON_GATHER_ND_GATHER_ND_COMMON_H_
+
+#include "ppl/kernel/riscv/common/gather/gather_common.h"
+
+namespace ppl { namespace kernel { namespace riscv {
+
+template <typename T>
+ppl::common::RetCode gather_nd_ndarray_common(
+    const T *src,
+    const int64_t *indices,
+    const int64_t *strides,
+    const int64_t inner_dim,
+    const int64_t num_indices,
+    const int64_t indices_dim,
+    T *dst)
+{
+    if (inner_dim >= GATHER_BULK_MIN_INNER()) {
+        PRAGMA_OMP_PARALLEL_FOR()
+        for (int64_t k = 0; k < num_indices; ++k) {
+            int64_t offset           = 0;
+            const int64_t *l_indices = indices + k * indices_dim;
+            for (int64_t i = 0; i < indices_dim; ++i) {
+                offset += l_indices[i] * strides[i];
+            }
+            gather_common_copy(src + offset, inner_dim * sizeof(T), dst + k * inner_dim);
+        }
+    } else {
+        PRAGMA_OMP_PARALLEL_FOR()
+        for (int64_t k = 0; k < num_indices; ++k) {
+            int64_t offset           = 0;
+            const int64_t *l_indices = indices + k * indices_dim;
+            for (int64_t i = 0; i < indices_dim; ++i) {
+                offset += l_indices[i] * strides[i];
+            }
+            for (int64_t j = 0; j < inner_dim; ++j) {
+                dst[k * inner_dim + j] = src[offset + j];
+            }
+        }
+    }
+
+    return ppl::common::RC_SUCCESS;
+}
+
+}}}; //  namespace ppl::kernel::riscv
+
+#endif //  __ST_PPL_KERNEL_RISCV_COMMON_GATHER_ND_GATHER_ND_COMMON_H_
@@ -0,0 +1,270 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_PPL_KERNEL_RISCV_COMMON_GRU_GRU_NDARRAY_COMMON_H_
+#define __ST_PPL_KERNEL_RISCV_COMMON_GRU_GRU_NDARRAY_COMMON_H_
+
+#include "ppl/kernel/riscv/common/rnn/rnn_ndarray_common.h"
+
+namespace ppl { namespace kernel { namespace riscv {
+
+// onnx GRU, gates in zrh order:
+//   X (seq_len, batch, input_size), W (num_direction, 3 * hidden_size, input_size), R (num_direction, 3 * hidden_size, hidden_size)
+//   bias (num_direction, 6 * hidden_size) as [Wb][Rb]
+//   Y (seq_len, num_direction, batch, hidden_size), Y_h (num_direction, batch, hidden_size)
+// R is packed per direction as [Rzr][Rh], the hidden gate gemm runs on r (.) h_{t-1} unless linear_before_reset.
+
+// r (.) h for the hidden gate gemm
+template <typename T>
+using gru_common_reset_func_t = void (*)(const T* x_gate, const T* h_gate, const T* h, const int64_t hidden_size, T* rh);
+
+// h_gate holds zr, hh the hidden gate gemm result, h is updated in place
+template <typename T>
+using gru_common_cell_func_t = void (*)(const T* x_gate, const T* h_gate, const T* hh, const int64_t hidden_size, T* h);
+
+template <typename T, int64_t atom_k, int64_t flt_atom_n>
+inline uint64_t gru_ndarray_common_packed_w_size(const rnn_direction_t direction, const int64_t hidden_size, const int64_t input_size)
+{
+    return rnn_ndarray_common_num_direction(direction) *
+        rnn_ndarray_common_packed_weight_size<T, atom_k, flt_atom_n>(rnn_num_gate::GRU * hidden_size, input_size);
+}
+
+template <typename T, int64_t atom_k, int64_t flt_atom_n>
+void gru_ndarray_common_pack_w(
+    const T* W,
+    const rnn_direction_t direction,
+    const int64_t hidden_size,
+    const int64_t input_size,
+    T* packed_W)
+{
+    const int64_t gate_size    = rnn_num_gate::GRU * hidden_size;
+    const int64_t packed_w_len = rnn_ndarray_common_packed_weight_size<T, atom_k, flt_atom_n>(gate_size, input_size) / sizeof(T);
+    for (int64_t nd = 0; nd < rnn_ndarray_common_num_direction(direction); nd++) {
+        rnn_ndarray_common_pack_weight<T, atom_k, flt_atom_n>(W + nd * gate_size * input_size, gate_size, input_size, packed_W + nd * packed_w_len);
+    }
+}
+
+template <typename T, int64_t atom_k, int64_t flt_atom_n>
+inline uint64_t gru_ndarray_common_packed_r_size(const rnn_direction_t direction, const int64_t hidden_size)
+{
+    return rnn_ndarray_common_num_direction(direction) *
+        (rnn_ndarray_common_packed_weight_size<T, atom_k, flt_atom_n>(2 * hidden_size, hidden_size) +
+         rnn_ndarray_common_packed_weight_size<T, atom_k, flt_atom_n>(hidden_size, hidden_size));
+}
+
+template <typename T, int64_t atom_k, int64_t flt_atom_n>
+void gru_ndarray_common_pack_r(
+    const T* R,
+    const rnn_direction_t direction,
+    const int64_t hidden_size,
+    T* packed_R)
+{
+    const int64_t packed_rzr_len = rnn_ndarray_common_packed_weight_size<T, atom_k, flt_atom_n>(2 * hidden_size, hidden_size) / sizeof(T);
+    const int64_t packed_rh_len  = rnn_ndarray_common_packed_weight_size<T, atom_k, flt_atom_n>(hidden_size, hidden_size) / sizeof(T);
+    for (int64_t nd = 0; nd < rnn_ndarray_common_num_direction(direction); nd++) {
+        const T* nd_R  = R + nd * rnn_num_gate::GRU * hidden_size * hidden_size;
+        T* nd_packed_R = packed_R + nd * (packed_rzr_len + packed_rh_len);
+        rnn_ndarray_common_pack_weight<T, atom_k, flt_atom_n>(nd_R, 2 * hidden_size, hidden_size, nd_packed_R);
+        rnn_ndarray_common_pack_weight<T, atom_k, flt_atom_n>(nd_R + 2 * hidden_size * hidden_size, hidden_size, hidden_size, nd_packed_R + packed_rzr_len);
+    }
+}
+
+template <typename T, int64_t atom_k, int64_t flt_atom_n>
+uint64_t gru_ndarray_common_temp_buffer_size(
+    const ppl::common::TensorShape* X_shape,
+    const rnn_direction_t direction,
+    const int64_t hidden_size,
+    const bool has_Y_h,
+    const bool packed_W,
+    const bool packed_R)
+{
+    const int64_t seq_len    = X_shape->GetDim(0);
+    const int64_t batch      = X_shape->GetDim(1);
+    const int64_t input_size = X_shape->GetDim(2);
+    const int64_t gate_size  = rnn_num_gate::GRU * hidden_size;
+
+    const uint64_t packed_w_size = packed_W ? 0 : round_up(gru_ndarray_common_packed_w_size<T, atom_k, flt_atom_n>(direction, hidden_size, input_size), 64);
+    const uint64_t packed_r_size = packed_R ? 0 : round_up(gru_ndarray_common_packed_r_size<T, atom_k, flt_atom_n>(direction, hidden_size), 64);
+    const uint64_t w_bias_size   = round_up(round_up(gate_size, flt_atom_n) * sizeof(T), 64);
+    const uint64_t rzr_bias_size = round_up(round_up(2 * hidden_size, flt_atom_n) * sizeof(T), 64);
+    const uint64_t rh_bias_size  = round_up(round_up(hidden_size, flt_atom_n) * sizeof(T), 64);
+    const uint64_t x_gate_size   = round_up(seq_len * batch * gate_size * sizeof(T), 64);
+    const uint64_t h_gate_size   = round_up(batch * 2 * hidden_size * sizeof(T), 64);
+    const uint64_t hh_size       = round_up(batch * hidden_size * sizeof(T), 64);
+    const uint64_t rh_size       = round_up(batch * hidden_size * sizeof(T), 64);
+    const uint64_t yh_size       = has_Y_h ? 0 : round_up(batch * hidden_size * sizeof(T), 64);
+    const uint64_t gemm_size     = rnn_ndarray_common_gemm_buffer_size<T, atom_k, flt_atom_n>(gate_size);
+
+    return packed_w_size + packed_r_size + w_bias_size + rzr_bias_size + rh_bias_size + x_gate_size + h_gate_size + hh_size + rh_size + yh_size + gemm_size;
+}
+
+template <typename T, int64_t atom_n, int64_t atom_k, int64_t flt_atom_n>
+ppl::common::RetCode gru_ndarray_common_execute(
+    const ppl::common::TensorShape* X_shape,
+    const T* X,
+    const T* W,
+    const T* R,
+    const T* bias,
+    const int32_t* sequence_lens,
+    const T* initial_h,
+    const rnn_direction_t direction,
+    const int64_t hidden_size,
+    const bool linear_before_reset,
+    const bool packed_W,
+    const bool packed_R,
+    void* temp_buffer,
+    const fc_common_select_gemm_kernel_func_t<T> first_tile_select_kernel_func,
+    const fc_common_select_gemm_kernel_func_t<T> tile_select_kernel_func,
+    const gru_common_reset_func_t<T> reset_func,
+    const gru_common_cell_func_t<T> cell_func,
+    T* Y,
+    T* Y_h)
+{
+    if (X_shape->GetDimCount() != 3 || hidden_size <= 0 || X_shape->GetDim(2) <= 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (!Y && !Y_h) {
+        return ppl::common::RC_SUCCESS;
+    }
+
+    const int64_t seq_len        = X_shape->GetDim(0);
+    const int64_t batch          = X_shape->GetDim(1);
+    const int64_t input_size     = X_shape->GetDim(2);
+    const int64_t num_direction  = rnn_ndarray_common_num_direction(direction);
+    const int64_t gate_size      = rnn_num_gate::GRU * hidden_size;
+    const int64_t pad_gate_size  = round_up(gate_size, flt_atom_n);
+    const int64_t pad_zr_size    = round_up(2 * hidden_size, flt_atom_n);
+    const int64_t pad_h_size     = round_up(hidden_size, flt_atom_n);
+    const int64_t packed_w_len   = rnn_ndarray_common_packed_weight_size<T, atom_k, flt_atom_n>(gate_size, input_size) / sizeof(T);
+    const int64_t packed_rzr_len = rnn_ndarray_common_packed_weight_size<T, atom_k, flt_atom_n>(2 * hidden_size, hidden_size) / sizeof(T);
+    const int64_t packed_rh_len  = rnn_ndarray_common_packed_weight_size<T, atom_k, flt_atom_n>(hidden_size, hidden_size) / sizeof(T);
+
+    const matmul_ndarray_param x_gemm_param  = rnn_ndarray_common_gemm_param(seq_len * batch, gate_size, input_size);
+    const matmul_ndarray_param zr_gemm_param = rnn_ndarray_common_gemm_param(batch, 2 * hidden_size, hidden_size);
+    const matmul_ndarray_param h_gemm_param  = rnn_ndarray_common_gemm_param(batch, hidden_size, hidden_size);
+
+    uint8_t* buffer = (uint8_t*)temp_buffer;
+    if (!packed_W) {
+        gru_ndarray_common_pack_w<T, atom_k, flt_atom_n>(W, direction, hidden_size, input_size, (T*)buffer);
+        W = (const T*)buffer;
+        buffer += round_up(gru_ndarray_common_packed_w_size<T, atom_k, flt_atom_n>(direction, hidden_size, input_size), 64);
+    }
+    if (!packed_R) {
+        gru_ndarray_common_pack_r<T, atom_k, flt_atom_n>(R, direction, hidden_size, (T*)buffer);
+        R = (const T*)buffer;
+        buffer += round_up(gru_ndarray_common_packed_r_size<T, atom_k, flt_atom_n>(direction, hidden_size), 64);
+    }
+    T* w_bias = (T*)buffer;
+    buffer += round_up(pad_gate_size * sizeof(T), 64);
+    T* rzr_bias = (T*)buffer;
+    buffer += round_up(pad_zr_size * sizeof(T), 64);
+    T* rh_bias = (T*)buffer;
+    buffer += round_up(pad_h_size * sizeof(T), 64);
+    T* x_gate = (T*)buffer;
+    buffer += round_up(seq_len * batch * gate_size * sizeof(T), 64);
+    T* h_gate = (T*)buffer;
+    buffer += round_up(batch * 2 * hidden_size * sizeof(T), 64);
+    T* hh = (T*)buffer;
+    buffer += round_up(batch * hidden_size * sizeof(T), 64);
+    T* rh = (T*)buffer;
+    buffer += round_up(batch * hidden_size * sizeof(T), 64);
+    T* h_state = Y_h;
+    if (!h_state) {
+        h_state = (T*)buffer;
+        buffer += round_up(batch * hidden_size * sizeof(T), 64);
+    }
+    void* gemm_buffer = buffer;
+
+    for (int64_t nd = 0; nd < num_direction; nd++) {
+        const bool is_reverse = nd || direction == rnn_direction::REVERSE;
+
+        const T* nd_W   = W + nd * packed_w_len;
+        const T* nd_Rzr = R + nd * (packed_rzr_len + packed_rh_len);
+        const T* nd_Rh  = nd_Rzr + packed_rzr_len;
+        const T* nd_Wb  = nullptr;
+        const T* nd_Rzb = nullptr;
+        const T* nd_Rhb = nullptr;
+        if (bias) {
+            const T* nd_bias = bias + nd * 2 * gate_size;
+            rnn_ndarray_common_pad_bias<T>(nd_bias, gate_size, pad_gate_size, w_bias);
+            rnn_ndarray_common_pad_bias<T>(nd_bias + gate_size, 2 * hidden_size, pad_zr_size, rzr_bias);
+            rnn_ndarray_common_pad_bias<T>(nd_bias + gate_size + 2 * hidden_size, hidden_size, pad_h_size, rh_bias);
+            nd_Wb  = w_bias;
+            nd_Rzb = rzr_bias;
+            nd_Rhb = rh_bias;
+        }
+
+        T* nd_Yh = Y_h ? h_state + nd * batch * hidden_size : h_state;
+        T* nd_Y  = Y ? Y + nd * batch * hidden_size : nullptr;
+        if (initial_h) {
+            memcpy(nd_Yh, initial_h + nd * batch * hidden_size, batch * hidden_size * sizeof(T));
+        } else {
+            memset(nd_Yh, 0, batch * hidden_size * sizeof(T));
+        }
+        if (seq_len == 0 || batch == 0) {
+            continue;
+        }
+
+        // X * W^T + Wb for all timesteps
+        rnn_ndarray_common_gemm<T, atom_n, atom_k, flt_atom_n>(X, nd_W, nd_Wb, x_gemm_param, gemm_buffer, first_tile_select_kernel_func, tile_select_kernel_func, x_gate);
+
+        for (int64_t seq_idx = 0; seq_idx < seq_len; seq_idx++) {
+            // h_{t-1} * Rzr^T + Rbzr
+            rnn_ndarray_common_gemm<T, atom_n, atom_k, flt_atom_n>(nd_Yh, nd_Rzr, nd_Rzb, zr_gemm_param, gemm_buffer, first_tile_select_kernel_func, tile_select_kernel_func, h_gate);
+
+            if (linear_before_reset) {
+                // h_{t-1} * Rh^T + Rbh, r is applied in the cell
+                rnn_ndarray_common_gemm<T, atom_n, atom_k, flt_atom_n>(nd_Yh, nd_Rh, nd_Rhb, h_gemm_param, gemm_buffer, first_tile_select_kernel_func, tile_select_kernel_func, hh);
+            } else {
+                PRAGMA_OMP_PARALLEL_FOR()
+                for (int64_t b = 0; b < batch; b++) {
+                    const int64_t seq_end = sequence_lens ? sequence_lens[b] : seq_len;
+                    if (seq_idx < seq_end) {
+                        const int64_t t = is_reverse ? seq_end - seq_idx - 1 : seq_idx;
+                        reset_func(x_gate + (t * batch + b) * gate_size, h_gate + b * 2 * hidden_size, nd_Yh + b * hidden_size, hidden_size, rh + b * hidden_size);
+                    } else {
+                        memset(rh + b * hidden_size, 0, hidden_size * sizeof(T));
+                    }
+                }
+                // (r (.) h_{t-1}) * Rh^T + Rbh
+                rnn_ndarray_common_gemm<T, atom_n, atom_k, flt_atom_n>(rh, nd_Rh, nd_Rhb, h_gemm_param, gemm_buffer, first_tile_select_kernel_func, tile_select_kernel_func, hh);
+            }
+
+            PRAGMA_OMP_PARALLEL_FOR()
+            for (int64_t b = 0; b < batch; b++) {
+                const int64_t seq_end = sequence_lens ? sequence_lens[b] : seq_len;
+                if (seq_idx < seq_end) {
+                    // reverse direction walks each batch from its own sequence end
+                    const int64_t t = is_reverse ? seq_end - seq_idx - 1 : seq_idx;
+                    T* Ht           = nd_Yh + b * hidden_size;
+                    cell_func(x_gate + (t * batch + b) * gate_size, h_gate + b * 2 * hidden_size, hh + b * hidden_size, hidden_size, Ht);
+                    if (nd_Y) {
+                        memcpy(nd_Y + (t * num_direction * batch + b) * hidden_size, Ht, hidden_size * sizeof(T));
+                    }
+                } else if (nd_Y) {
+                    memset(nd_Y + (seq_idx * num_direction * batch + b) * hidden_size, 0, hidden_size * sizeof(T));
+                }
+            }
+        }
+    }
+
+    return ppl::common::RC_SUCCESS;
+}
+
+}}}; // namespace ppl::kernel::riscv
+
+#endif //  __ST_PPL_KERNEL_RISCV_COMMON_GRU_GRU_NDARRAY_COMMON_H_
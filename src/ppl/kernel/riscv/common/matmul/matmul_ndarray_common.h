@@ -0,0 +1,309 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_PPL_KERNEL_RISCV_COMMON_MATMUL_MATMUL_NDARRAY_COMMON_H_
+#define __ST_PPL_KERNEL_RISCV_COMMON_MATMUL_MATMUL_NDARRAY_COMMON_H_
+
+#include <vector>
+#include <cstring>
+
+#include "ppl/kernel/riscv/common/internal_include.h"
+#include "ppl/kernel/riscv/common/fc/fc_ndarray_common.h"
+
+namespace ppl { namespace kernel { namespace riscv {
+
+// Batched Y = op(A) * op(B) on the fc ndarray gemm kernels. B is packed like an fc filter,
+// [pad_n / flt_atom_n][pad_k][flt_atom_n] per B batch, so the kernels see op(B)^T rows.
+// Tiles are (batch, n block, m block), n blocks are flt_atom_n wide because the kernels step
+// between flt_atom_n column blocks by the tile k length. bias, when given, is a row vector padded
+// with zeros to round_up(n, flt_atom_n).
+
+struct matmul_ndarray_param {
+    int64_t m;
+    int64_t n;
+    int64_t k;
+    int64_t batch;
+    int64_t b_batch;
+    std::vector<int64_t> a_batch_idx;
+    std::vector<int64_t> b_batch_idx;
+};
+
+struct matmul_ndarray_tunning_param {
+    int64_t m_blk;
+    int64_t k_blk;
+    int64_t num_thread;
+};
+
+inline matmul_ndarray_tunning_param matmul_ndarray_common_tunning_param()
+{
+    return {28, 128, PPL_OMP_MAX_THREADS()};
+}
+
+// numpy style: 1-D B is [k, 1]
+inline ppl::common::RetCode matmul_ndarray_common_parse_b(
+    const ppl::common::TensorShape* B_shape,
+    const bool transB,
+    int64_t* k,
+    int64_t* n,
+    int64_t* b_batch)
+{
+    const int64_t b_dim_count = B_shape->GetDimCount();
+    if (b_dim_count < 1) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (b_dim_count == 1) {
+        *k = B_shape->GetDim(0);
+        *n = 1;
+    } else {
+        *k = B_shape->GetDim(b_dim_count - (transB ? 1 : 2));
+        *n = B_shape->GetDim(b_dim_count - (transB ? 2 : 1));
+    }
+    *b_batch = 1;
+    for (int64_t i = 0; i < b_dim_count - 2; i++) {
+        *b_batch *= B_shape->GetDim(i);
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+// numpy style: 1-D A is [1, k], batch dims are broadcast
+inline ppl::common::RetCode matmul_ndarray_common_parse_param(
+    const ppl::common::TensorShape* A_shape,
+    const ppl::common::TensorShape* B_shape,
+    const bool transA,
+    const bool transB,
+    matmul_ndarray_param* param)
+{
+    const int64_t a_dim_count = A_shape->GetDimCount();
+    const int64_t b_dim_count = B_shape->GetDimCount();
+    if (a_dim_count < 1) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    int64_t bk;
+    auto rc = matmul_ndarray_common_parse_b(B_shape, transB, &bk, &param->n, &param->b_batch);
+    if (rc != ppl::common::RC_SUCCESS) {
+        return rc;
+    }
+    if (a_dim_count == 1) {
+        param->m = 1;
+        param->k = A_shape->GetDim(0);
+    } else {
+        param->m = A_shape->GetDim(a_dim_count - (transA ? 1 : 2));
+        param->k = A_shape->GetDim(a_dim_count - (transA ? 2 : 1));
+    }
+    if (bk != param->k) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+
+    const int64_t a_batch_dims = max(a_dim_count - 2, (int64_t)0);
+    const int64_t b_batch_dims = max(b_dim_count - 2, (int64_t)0);
+    const int64_t batch_dims   = max(a_batch_dims, b_batch_dims);
+    std::vector<int64_t> a_dims(batch_dims, 1), b_dims(batch_dims, 1), dims(batch_dims, 1);
+    for (int64_t i = 0; i < a_batch_dims; i++) {
+        a_dims[batch_dims - a_batch_dims + i] = A_shape->GetDim(i);
+    }
+    for (int64_t i = 0; i < b_batch_dims; i++) {
+        b_dims[batch_dims - b_batch_dims + i] = B_shape->GetDim(i);
+    }
+    param->batch = 1;
+    for (int64_t i = 0; i < batch_dims; i++) {
+        if (a_dims[i] != b_dims[i] && a_dims[i] != 1 && b_dims[i] != 1) {
+            return ppl::common::RC_INVALID_VALUE;
+        }
+        dims[i] = max(a_dims[i], b_dims[i]);
+        param->batch *= dims[i];
+    }
+
+    param->a_batch_idx.resize(param->batch);
+    param->b_batch_idx.resize(param->batch);
+    for (int64_t bi = 0; bi < param->batch; bi++) {
+        int64_t rem = bi, a_idx = 0, b_idx = 0, a_stride = 1, b_stride = 1;
+        for (int64_t i = batch_dims - 1; i >= 0; i--) {
+            const int64_t idx = rem % dims[i];
+            rem /= dims[i];
+            a_idx += (a_dims[i] == 1 ? 0 : idx) * a_stride;
+            b_idx += (b_dims[i] == 1 ? 0 : idx) * b_stride;
+            a_stride *= a_dims[i];
+            b_stride *= b_dims[i];
+        }
+        param->a_batch_idx[bi] = a_idx;
+        param->b_batch_idx[bi] = b_idx;
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template <typename T, int64_t atom_k, int64_t flt_atom_n>
+inline uint64_t matmul_ndarray_common_packed_b_size(const matmul_ndarray_param& param)
+{
+    return param.b_batch * round_up(param.n, flt_atom_n) * round_up(param.k, atom_k) * sizeof(T);
+}
+
+template <typename T, int64_t atom_k, int64_t flt_atom_n>
+void matmul_ndarray_common_pack_b(
+    const T* B,
+    const matmul_ndarray_param& param,
+    const bool transB,
+    T* packed_B)
+{
+    const int64_t n         = param.n;
+    const int64_t k         = param.k;
+    const int64_t pad_k     = round_up(k, atom_k);
+    const int64_t num_n_blk = div_up(n, flt_atom_n);
+
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t t = 0; t < param.b_batch * num_n_blk; t++) {
+        const int64_t b_idx = t / num_n_blk;
+        const int64_t n_beg = t % num_n_blk * flt_atom_n;
+        const int64_t n_len = min(n - n_beg, flt_atom_n);
+        const T* B_         = B + b_idx * n * k;
+        T* packed_          = packed_B + b_idx * num_n_blk * flt_atom_n * pad_k + n_beg * pad_k;
+
+        memset(packed_, 0, pad_k * flt_atom_n * sizeof(T));
+        for (int64_t ki = 0; ki < k; ki++) {
+            for (int64_t ni = 0; ni < n_len; ni++) {
+                packed_[ki * flt_atom_n + ni] = transB ? B_[(n_beg + ni) * k + ki] : B_[ki * n + n_beg + ni];
+            }
+        }
+    }
+}
+
+// per thread a / y tiles
+template <typename T, int64_t atom_k, int64_t flt_atom_n>
+inline uint64_t matmul_ndarray_common_thread_buffer_size(const matmul_ndarray_tunning_param& tunning_param)
+{
+    return round_up(tunning_param.m_blk * (round_up(tunning_param.k_blk, atom_k) + flt_atom_n) * sizeof(T), 64);
+}
+
+// [packed B unless prepacked][zero bias][thread buffers]
+template <typename T, int64_t atom_k, int64_t flt_atom_n>
+inline uint64_t matmul_ndarray_common_temp_buffer_size(
+    const matmul_ndarray_param& param,
+    const matmul_ndarray_tunning_param& tunning_param,
+    const bool packedB)
+{
+    const uint64_t packed_b_size = packedB ? 0 : round_up(matmul_ndarray_common_packed_b_size<T, atom_k, flt_atom_n>(param), 64);
+    const uint64_t bias_size     = round_up(round_up(param.n, flt_atom_n) * sizeof(T), 64);
+    return packed_b_size + bias_size +
+        matmul_ndarray_common_thread_buffer_size<T, atom_k, flt_atom_n>(tunning_param) * max(tunning_param.num_thread, (int64_t)1);
+}
+
+// rows [m_beg, m_beg + m_len) and cols [k_beg, k_beg + k_len) of op(A) into a [m_len][tile_k] tile
+template <typename T>
+inline void matmul_ndarray_common_load_a_trans(
+    const T* A,
+    T* a_tile,
+    const int64_t m,
+    const int64_t tile_k,
+    const int64_t m_beg,
+    const int64_t m_len,
+    const int64_t k_beg,
+    const int64_t k_len)
+{
+    for (int64_t mi = 0; mi < m_len; mi++) {
+        T* a_tile_ = a_tile + mi * tile_k;
+        for (int64_t ki = 0; ki < k_len; ki++) {
+            a_tile_[ki] = A[(k_beg + ki) * m + m_beg + mi];
+        }
+        memset(a_tile_ + k_len, 0, (tile_k - k_len) * sizeof(T));
+    }
+}
+
+template <typename T, int64_t atom_n, int64_t atom_k, int64_t flt_atom_n>
+ppl::common::RetCode matmul_ndarray_common_execute(
+    const T* A,
+    const T* packed_B,
+    const T* bias,
+    const matmul_ndarray_param& param,
+    const matmul_ndarray_tunning_param& tunning_param,
+    const bool transA,
+    void* temp_buffer,
+    const fc_common_select_gemm_kernel_func_t<T> first_tile_select_kernel_func,
+    const fc_common_select_gemm_kernel_func_t<T> tile_select_kernel_func,
+    T* Y)
+{
+    const int64_t m     = param.m;
+    const int64_t n     = param.n;
+    const int64_t k     = param.k;
+    const int64_t pad_k = round_up(k, atom_k);
+    const int64_t pad_n = round_up(n, atom_n);
+    const int64_t m_blk = min(tunning_param.m_blk, m);
+    const int64_t k_blk = round_up(min(tunning_param.k_blk, k), atom_k);
+
+    const int64_t num_m_tile          = div_up(m, m_blk);
+    const int64_t num_n_tile          = div_up(n, flt_atom_n);
+    const int64_t num_tile            = param.batch * num_n_tile * num_m_tile;
+    const int64_t packed_b_batch_size = num_n_tile * flt_atom_n * pad_k;
+    const int64_t num_thread          = max(tunning_param.num_thread, (int64_t)1);
+    const uint64_t thread_buffer_size = matmul_ndarray_common_thread_buffer_size<T, atom_k, flt_atom_n>(tunning_param);
+
+    uint8_t* thread_buffer = (uint8_t*)temp_buffer + round_up(num_n_tile * flt_atom_n * sizeof(T), 64);
+    if (!bias) {
+        memset(temp_buffer, 0, num_n_tile * flt_atom_n * sizeof(T));
+        bias = (const T*)temp_buffer;
+    }
+
+    PRAGMA_OMP_PARALLEL()
+    {
+        // temp_buffer only holds num_thread buffers, extra threads stay idle
+        const int64_t thread_id  = PPL_OMP_THREAD_ID();
+        const int64_t num_worker = min((int64_t)PPL_OMP_NUM_THREADS(), num_thread);
+
+        if (thread_id < num_worker) {
+            T* a_tile = (T*)(thread_buffer + thread_id * thread_buffer_size);
+            T* y_tile = a_tile + m_blk * k_blk;
+
+            const int64_t tile_beg = num_tile * thread_id / num_worker;
+            const int64_t tile_end = num_tile * (thread_id + 1) / num_worker;
+            for (int64_t tile_idx = tile_beg; tile_idx < tile_end; tile_idx += 1) {
+                const int64_t bi         = tile_idx / (num_n_tile * num_m_tile);
+                const int64_t n_tile_beg = tile_idx / num_m_tile % num_n_tile * flt_atom_n;
+                const int64_t m_tile_beg = tile_idx % num_m_tile * m_blk;
+                const int64_t pad_n_len  = min(pad_n - n_tile_beg, flt_atom_n);
+                const int64_t n_len      = min(n - n_tile_beg, flt_atom_n);
+                const int64_t m_len      = min(m - m_tile_beg, m_blk);
+
+                const T* A_ = A + param.a_batch_idx[bi] * m * k;
+                const T* B_ = packed_B + param.b_batch_idx[bi] * packed_b_batch_size + n_tile_beg * pad_k;
+                T* Y_       = Y + bi * m * n;
+
+                auto first_tile_kernel_func = first_tile_select_kernel_func(m_len, pad_n_len);
+                auto tile_kernel_func       = tile_select_kernel_func(m_len, pad_n_len);
+
+                for (int64_t k_tile_beg = 0; k_tile_beg < pad_k; k_tile_beg += k_blk) {
+                    const int64_t pad_k_len = min(pad_k - k_tile_beg, k_blk);
+                    const int64_t k_len     = min(k - k_tile_beg, k_blk);
+
+                    if (transA) {
+                        matmul_ndarray_common_load_a_trans<T>(A_, a_tile, m, pad_k_len, m_tile_beg, m_len, k_tile_beg, k_len);
+                    } else {
+                        fc_ndarray_common_load_src<T>(A_, a_tile, m, k, m_len, pad_k_len, m_tile_beg, m_len, k_tile_beg, k_len);
+                    }
+
+                    auto kernel_func = k_tile_beg == 0 ? first_tile_kernel_func : tile_kernel_func;
+                    kernel_func(a_tile, B_ + k_tile_beg * flt_atom_n, bias + n_tile_beg, y_tile, m_len, pad_n_len, pad_k_len);
+                }
+
+                fc_ndarray_common_store_dst<T>(y_tile, Y_, m, n, m_len, pad_n_len, m_tile_beg, m_len, n_tile_beg, n_len);
+            }
+        }
+    }
+
+    return ppl::common::RC_SUCCESS;
+}
+
+}}}; // namespace ppl::kernel::riscv
+
+#endif //  __ST_PPL_KERNEL_RISCV_COMMON_MATMUL_MATMUL_NDARRAY_COMMON_H_
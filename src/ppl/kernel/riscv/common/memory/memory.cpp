@@ -15,43 +15,134 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <riscv-vector.h>
 #include <string.h>
 
 #include "ppl/kernel/riscv/common/internal_include.h"
 
 namespace ppl { namespace kernel { namespace riscv {
 
+// bytes per thread task, buffers below parallel_bytes stay on the calling thread
+#define MEMORY_BLOCK_BYTES()    ((uint64_t)65536)
+#define MEMORY_PARALLEL_BYTES() ((uint64_t)262144)
+
+// LMUL=8 streaming, each vector op moves 8 registers
+static void memory_copy_block(const uint8_t* src, const uint64_t num_bytes, uint8_t* dst)
+{
+    const uint64_t atom = 128;
+    const auto vl       = vsetvli(atom, RVV_E8, RVV_M8);
+
+    uint64_t i = 0;
+    for (; i + 2 * atom <= num_bytes; i += 2 * atom) {
+        vsev_uint8xm8(dst + i + 0 * atom, vlev_uint8xm8(src + i + 0 * atom, vl), vl);
+        vsev_uint8xm8(dst + i + 1 * atom, vlev_uint8xm8(src + i + 1 * atom, vl), vl);
+    }
+    for (; i < num_bytes; i += atom) {
+        const auto tail_vl = vsetvli(num_bytes - i, RVV_E8, RVV_M8);
+        vsev_uint8xm8(dst + i, vlev_uint8xm8(src + i, tail_vl), tail_vl);
+    }
+}
+
+template <typename T>
+struct memory_fill_traits {};
+
+template <>
+struct memory_fill_traits<uint8_t> {
+    typedef uint8xm8_t vec_t;
+    static inline uint64_t vsetvl(const uint64_t n) { return vsetvli(n, RVV_E8, RVV_M8); }
+    static inline vec_t splat(const uint8_t val, const uint64_t vl) { return vmvvx_uint8xm8(val, vl); }
+    static inline void store(uint8_t* dst, const vec_t v, const uint64_t vl) { vsev_uint8xm8(dst, v, vl); }
+};
+
+template <>
+struct memory_fill_traits<uint16_t> {
+    typedef uint16xm8_t vec_t;
+    static inline uint64_t vsetvl(const uint64_t n) { return vsetvli(n, RVV_E16, RVV_M8); }
+    static inline vec_t splat(const uint16_t val, const uint64_t vl) { return vmvvx_uint16xm8(val, vl); }
+    static inline void store(uint16_t* dst, const vec_t v, const uint64_t vl) { vsev_uint16xm8(dst, v, vl); }
+};
+
+template <>
+struct memory_fill_traits<uint32_t> {
+    typedef uint32xm8_t vec_t;
+    static inline uint64_t vsetvl(const uint64_t n) { return vsetvli(n, RVV_E32, RVV_M8); }
+    static inline vec_t splat(const uint32_t val, const uint64_t vl) { return vmvvx_uint32xm8(val, vl); }
+    static inline void store(uint32_t* dst, const vec_t v, const uint64_t vl) { vsev_uint32xm8(dst, v, vl); }
+};
+
+template <>
+struct memory_fill_traits<uint64_t> {
+    typedef uint64xm8_t vec_t;
+    static inline uint64_t vsetvl(const uint64_t n) { return vsetvli(n, RVV_E64, RVV_M8); }
+    static inline vec_t splat(const uint64_t val, const uint64_t vl) { return vmvvx_uint64xm8(val, vl); }
+    static inline void store(uint64_t* dst, const vec_t v, const uint64_t vl) { vsev_uint64xm8(dst, v, vl); }
+};
+
+template <typename T>
+static void memory_fill_block(const T val, const uint64_t num_elements, T* dst)
+{
+    typedef memory_fill_traits<T> traits;
+    const uint64_t atom = 128 / sizeof(T);
+    const auto vl       = traits::vsetvl(atom);
+    const auto v        = traits::splat(val, vl);
+
+    uint64_t i = 0;
+    for (; i + 2 * atom <= num_elements; i += 2 * atom) {
+        traits::store(dst + i + 0 * atom, v, vl);
+        traits::store(dst + i + 1 * atom, v, vl);
+    }
+    for (; i < num_elements; i += atom) {
+        const auto tail_vl = traits::vsetvl(num_elements - i);
+        traits::store(dst + i, v, tail_vl);
+    }
+}
+
+template <typename T>
+static void memory_fill(const void* src, const uint64_t num_elements, T* dst)
+{
+    T val;
+    memcpy(&val, src, sizeof(val));
+
+    if (num_elements * sizeof(T) < MEMORY_PARALLEL_BYTES()) {
+        memory_fill_block<T>(val, num_elements, dst);
+        return;
+    }
+
+    const int64_t block_len = MEMORY_BLOCK_BYTES() / sizeof(T);
+    const int64_t num_block = div_up(num_elements, block_len);
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t b = 0; b < num_block; b++) {
+        const int64_t beg = b * block_len;
+        memory_fill_block<T>(val, min((int64_t)num_elements - beg, block_len), dst + beg);
+    }
+}
+
 ppl::common::RetCode memory_init(
     const void* src,
     const uint64_t sizeof_elem,
     const uint64_t num_elements,
     void* dst)
 {
+    // vector stores wider than a byte need an element aligned dst
+    const bool aligned = (uintptr_t)dst % sizeof_elem == 0;
+
     if (sizeof_elem == 1) {
-        const uint8_t val = ((uint8_t*)src)[0];
-        for (uint64_t i = 0; i < num_elements; i++) {
-            ((uint8_t*)dst)[i] = val;
-        }
-    } else if (sizeof_elem == 2) {
-        const uint16_t val = ((uint16_t*)src)[0];
-        for (uint64_t i = 0; i < num_elements; i++) {
-            ((uint16_t*)dst)[i] = val;
-        }
-    } else if (sizeof_elem == 4) {
-        const uint32_t val = ((uint32_t*)src)[0];
-        for (uint64_t i = 0; i < num_elements; i++) {
-            ((uint32_t*)dst)[i] = val;
-        }
-    } else if (sizeof_elem == 8) {
-        const uint64_t val = ((uint64_t*)src)[0];
-        for (uint64_t i = 0; i < num_elements; i++) {
-            ((uint64_t*)dst)[i] = val;
-        }
-    } else {
-        for (uint64_t i = 0; i < num_elements; i++) {
-            for (uint64_t j = 0; j < sizeof_elem; j++) {
-                ((uint8_t*)dst)[i * sizeof_elem + j] = ((uint8_t*)src)[j];
-            }
+        memory_fill<uint8_t>(src, num_elements, (uint8_t*)dst);
+    } else if (sizeof_elem == 2 && aligned) {
+        memory_fill<uint16_t>(src, num_elements, (uint16_t*)dst);
+    } else if (sizeof_elem == 4 && aligned) {
+        memory_fill<uint32_t>(src, num_elements, (uint32_t*)dst);
+    } else if (sizeof_elem == 8 && aligned) {
+        memory_fill<uint64_t>(src, num_elements, (uint64_t*)dst);
+    } else if (num_elements > 0) {
+        // write one element, then keep doubling the filled prefix
+        const uint64_t num_bytes = sizeof_elem * num_elements;
+        uint64_t filled          = sizeof_elem;
+        memcpy(dst, src, sizeof_elem);
+        while (filled < num_bytes) {
+            const uint64_t len = min(filled, num_bytes - filled);
+            memcpy((uint8_t*)dst + filled, dst, len);
+            filled += len;
         }
     }
 
@@ -63,7 +154,18 @@ ppl::common::RetCode memory_copy(
     const uint64_t num_bytes,
     void* dst)
 {
-    memcpy((uint8_t*)dst, (uint8_t*)src, num_bytes);
+    if (num_bytes < MEMORY_PARALLEL_BYTES()) {
+        memory_copy_block((const uint8_t*)src, num_bytes, (uint8_t*)dst);
+        return ppl::common::RC_SUCCESS;
+    }
+
+    const int64_t num_block = div_up(num_bytes, MEMORY_BLOCK_BYTES());
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t b = 0; b < num_block; b++) {
+        const uint64_t beg = b * MEMORY_BLOCK_BYTES();
+        memory_copy_block((const uint8_t*)src + beg, min(num_bytes - beg, MEMORY_BLOCK_BYTES()), (uint8_t*)dst + beg);
+    }
+
     return ppl::common::RC_SUCCESS;
 }
 
@@ -0,0 +1,118 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_PPL_KERNEL_RISCV_COMMON_NBCX_LANE_H_
+#define __ST_PPL_KERNEL_RISCV_COMMON_NBCX_LANE_H_
+
+#include <riscv-vector.h>
+
+#include "ppl/kernel/riscv/common/internal_include.h"
+
+namespace ppl { namespace kernel { namespace riscv {
+
+// pixels per task of the channel interleave kernels
+#define NBCX_INTERLEAVE_INNER_BLK() 256
+
+template <int32_t elem_bytes>
+struct nbcx_lane_traits {};
+
+template <>
+struct nbcx_lane_traits<2> {
+    static inline void copy(const void* src, const int64_t stride, const int64_t len, void* dst)
+    {
+        const uint16_t* src_p = (const uint16_t*)src;
+        uint16_t* dst_p       = (uint16_t*)dst;
+        for (int64_t i = 0; i < len;) {
+            const auto vl = vsetvli(len - i, RVV_E16, RVV_M2);
+            vssev_uint16xm2(dst_p + i * stride, stride * sizeof(uint16_t), vlsev_uint16xm2(src_p + i * stride, stride * sizeof(uint16_t), vl), vl);
+            i += vl;
+        }
+    }
+    static inline void zero(const int64_t stride, const int64_t len, void* dst)
+    {
+        uint16_t* dst_p = (uint16_t*)dst;
+        for (int64_t i = 0; i < len;) {
+            const auto vl = vsetvli(len - i, RVV_E16, RVV_M2);
+            vssev_uint16xm2(dst_p + i * stride, stride * sizeof(uint16_t), vmvvx_uint16xm2(0, vl), vl);
+            i += vl;
+        }
+    }
+};
+
+template <>
+struct nbcx_lane_traits<4> {
+    static inline void copy(const void* src, const int64_t stride, const int64_t len, void* dst)
+    {
+        const uint32_t* src_p = (const uint32_t*)src;
+        uint32_t* dst_p       = (uint32_t*)dst;
+        for (int64_t i = 0; i < len;) {
+            const auto vl = vsetvli(len - i, RVV_E32, RVV_M2);
+            vssev_uint32xm2(dst_p + i * stride, stride * sizeof(uint32_t), vlsev_uint32xm2(src_p + i * stride, stride * sizeof(uint32_t), vl), vl);
+            i += vl;
+        }
+    }
+    static inline void zero(const int64_t stride, const int64_t len, void* dst)
+    {
+        uint32_t* dst_p = (uint32_t*)dst;
+        for (int64_t i = 0; i < len;) {
+            const auto vl = vsetvli(len - i, RVV_E32, RVV_M2);
+            vssev_uint32xm2(dst_p + i * stride, stride * sizeof(uint32_t), vmvvx_uint32xm2(0, vl), vl);
+            i += vl;
+        }
+    }
+};
+
+template <>
+struct nbcx_lane_traits<8> {
+    static inline void copy(const void* src, const int64_t stride, const int64_t len, void* dst)
+    {
+        const uint64_t* src_p = (const uint64_t*)src;
+        uint64_t* dst_p       = (uint64_t*)dst;
+        for (int64_t i = 0; i < len;) {
+            const auto vl = vsetvli(len - i, RVV_E64, RVV_M2);
+            vssev_uint64xm2(dst_p + i * stride, stride * sizeof(uint64_t), vlsev_uint64xm2(src_p + i * stride, stride * sizeof(uint64_t), vl), vl);
+            i += vl;
+        }
+    }
+    static inline void zero(const int64_t stride, const int64_t len, void* dst)
+    {
+        uint64_t* dst_p = (uint64_t*)dst;
+        for (int64_t i = 0; i < len;) {
+            const auto vl = vsetvli(len - i, RVV_E64, RVV_M2);
+            vssev_uint64xm2(dst_p + i * stride, stride * sizeof(uint64_t), vmvvx_uint64xm2(0, vl), vl);
+            i += vl;
+        }
+    }
+};
+
+// moves one channel lane of len blocked pixels, vectorized across pixels with strided accesses
+template <typename T, int32_t c_blk>
+inline void nbcx_copy_lane(const T* src, const int64_t len, T* dst)
+{
+    nbcx_lane_traits<sizeof(T)>::copy(src, c_blk, len, dst);
+}
+
+// clears one channel lane of len blocked pixels
+template <typename T, int32_t c_blk>
+inline void nbcx_zero_lane(const int64_t len, T* dst)
+{
+    nbcx_lane_traits<sizeof(T)>::zero(c_blk, len, dst);
+}
+
+}}}; // namespace ppl::kernel::riscv
+
+#endif // __ST_PPL_KERNEL_RISCV_COMMON_NBCX_LANE_H_
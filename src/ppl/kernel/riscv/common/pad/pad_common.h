@@ -0,0 +1,217 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_PPL_KERNEL_RISCV_COMMON_PAD_PAD_COMMON_H_
+#define __ST_PPL_KERNEL_RISCV_COMMON_PAD_PAD_COMMON_H_
+
+#include <string.h> // for memcpy
+#include <vector>
+
+#include "ppl/kernel/riscv/common/internal_include.h"
+
+namespace ppl { namespace kernel { namespace riscv {
+
+enum {
+    PAD_MODE_CONSTANT = 0,
+    PAD_MODE_REFLECT  = 1,
+    PAD_MODE_EDGE     = 2,
+};
+
+// source index of padded index i on a dim of size n, -1 for a constant pad
+template <int32_t mode>
+inline int64_t pad_map_index(int64_t i, const int64_t n)
+{
+    if (i >= 0 && i < n) {
+        return i;
+    }
+    if (mode == PAD_MODE_CONSTANT) {
+        return -1;
+    }
+    if (mode == PAD_MODE_EDGE) {
+        return i < 0 ? 0 : n - 1;
+    }
+    if (n == 1) {
+        return 0;
+    }
+    const int64_t period = 2 * (n - 1);
+    i                    = (i < 0 ? -i : i) % period;
+    return i < n ? i : period - i;
+}
+
+template <typename eT, int32_t mode>
+inline void pad_fill_border(
+    const eT* src_row,
+    const int64_t j_beg,
+    const int64_t j_end,
+    const int64_t pad_w,
+    const int64_t src_w,
+    const int64_t atom,
+    const eT constant_value,
+    eT* dst_row)
+{
+    for (int64_t j = j_beg; j < j_end; j++) {
+        const int64_t s = pad_map_index<mode>(j - pad_w, src_w);
+        if (s < 0) {
+            for (int64_t k = 0; k < atom; k++) {
+                dst_row[j * atom + k] = constant_value;
+            }
+        } else {
+            memcpy(dst_row + j * atom, src_row + s * atom, atom * sizeof(eT));
+        }
+    }
+}
+
+// pads a dense tensor whose elements are `atom` contiguous eT. the interior of every dst row is
+// one bulk copy, only the border atoms are synthesized. rows are split across threads.
+template <typename eT, int32_t mode>
+void pad_rows_common(
+    const int64_t* src_dims,
+    const int64_t* dst_dims,
+    const int64_t* start_pads,
+    const int64_t dim_count,
+    const int64_t atom,
+    const eT* src,
+    const eT constant_value,
+    eT* dst)
+{
+    const int64_t src_w  = src_dims[dim_count - 1];
+    const int64_t dst_w  = dst_dims[dim_count - 1];
+    const int64_t pad_w  = start_pads[dim_count - 1];
+    const int64_t copy_l = min(max(pad_w, (int64_t)0), dst_w);
+    const int64_t copy_r = min(max(pad_w + src_w, (int64_t)0), dst_w);
+
+    int64_t num_rows = 1;
+    for (int64_t d = 0; d < dim_count - 1; d++) {
+        num_rows *= dst_dims[d];
+    }
+
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t r = 0; r < num_rows; r++) {
+        eT* dst_row = dst + r * dst_w * atom;
+
+        int64_t rem        = r;
+        int64_t src_row    = 0;
+        int64_t src_stride = 1;
+        bool is_pad_row    = false;
+        for (int64_t d = dim_count - 2; d >= 0; d--) {
+            const int64_t s = pad_map_index<mode>(rem % dst_dims[d] - start_pads[d], src_dims[d]);
+            rem /= dst_dims[d];
+            is_pad_row |= s < 0;
+            src_row += s * src_stride;
+            src_stride *= src_dims[d];
+        }
+        if (is_pad_row) {
+            for (int64_t i = 0; i < dst_w * atom; i++) {
+                dst_row[i] = constant_value;
+            }
+            continue;
+        }
+
+        const eT* src_row_ptr = src + src_row * src_w * atom;
+        if (copy_r > copy_l) {
+            memcpy(dst_row + copy_l * atom, src_row_ptr + (copy_l - pad_w) * atom, (copy_r - copy_l) * atom * sizeof(eT));
+        }
+        pad_fill_border<eT, mode>(src_row_ptr, 0, copy_l, pad_w, src_w, atom, constant_value, dst_row);
+        pad_fill_border<eT, mode>(src_row_ptr, copy_r, dst_w, pad_w, src_w, atom, constant_value, dst_row);
+    }
+}
+
+template <int32_t mode>
+static ppl::common::RetCode pad_check_dims(
+    const int64_t* src_dims,
+    const int64_t* dst_dims,
+    const int64_t* start_pads,
+    const int64_t* end_pads,
+    const int64_t dim_count)
+{
+    for (int64_t d = 0; d < dim_count; d++) {
+        if (dst_dims[d] != src_dims[d] + start_pads[d] + end_pads[d] || dst_dims[d] < 0) {
+            return ppl::common::RC_INVALID_VALUE;
+        }
+        if (mode != PAD_MODE_CONSTANT && src_dims[d] == 0 && dst_dims[d] > 0) {
+            return ppl::common::RC_INVALID_VALUE;
+        }
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template <typename eT, int32_t mode>
+ppl::common::RetCode pad_ndarray_common(
+    const ppl::common::TensorShape* src_shape,
+    const ppl::common::TensorShape* dst_shape,
+    const eT* src,
+    const int64_t* start_pads,
+    const int64_t* end_pads,
+    const eT constant_value,
+    eT* dst)
+{
+    const int64_t dim_count = src_shape->GetDimCount();
+    if (dim_count == 0 || dst_shape->GetDimCount() != dim_count) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    auto rc = pad_check_dims<mode>(src_shape->GetDims(), dst_shape->GetDims(), start_pads, end_pads, dim_count);
+    if (rc != ppl::common::RC_SUCCESS) {
+        return rc;
+    }
+    if (dst_shape->CalcElementsExcludingPadding() == 0) {
+        return ppl::common::RC_SUCCESS;
+    }
+
+    pad_rows_common<eT, mode>(src_shape->GetDims(), dst_shape->GetDims(), start_pads, dim_count, 1, src, constant_value, dst);
+    return ppl::common::RC_SUCCESS;
+}
+
+// channels are kept in lanes: c_blk lanes move as one atom of [n, c / c_blk, d2, ...]. pads on the
+// channel dim would shift lanes across blocks and are not supported.
+template <typename eT, int32_t mode>
+ppl::common::RetCode pad_nbcx_common(
+    const ppl::common::TensorShape* src_shape,
+    const ppl::common::TensorShape* dst_shape,
+    const eT* src,
+    const int64_t* start_pads,
+    const int64_t* end_pads,
+    const eT constant_value,
+    const int64_t c_blk,
+    eT* dst)
+{
+    const int64_t dim_count = src_shape->GetDimCount();
+    if (dim_count < 3 || dst_shape->GetDimCount() != dim_count) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (start_pads[1] != 0 || end_pads[1] != 0) {
+        return ppl::common::RC_UNSUPPORTED;
+    }
+    auto rc = pad_check_dims<mode>(src_shape->GetDims(), dst_shape->GetDims(), start_pads, end_pads, dim_count);
+    if (rc != ppl::common::RC_SUCCESS) {
+        return rc;
+    }
+    if (dst_shape->CalcElementsExcludingPadding() == 0) {
+        return ppl::common::RC_SUCCESS;
+    }
+
+    std::vector<int64_t> src_dims(src_shape->GetDims(), src_shape->GetDims() + dim_count);
+    std::vector<int64_t> dst_dims(dst_shape->GetDims(), dst_shape->GetDims() + dim_count);
+    src_dims[1] = div_up(src_dims[1], c_blk);
+    dst_dims[1] = src_dims[1];
+
+    pad_rows_common<eT, mode>(src_dims.data(), dst_dims.data(), start_pads, dim_count, c_blk, src, constant_value, dst);
+    return ppl::common::RC_SUCCESS;
+}
+
+}}}; // namespace ppl::kernel::riscv
+
+#endif // !__ST_PPL_KERNEL_RISCV_COMMON_PAD_PAD_COMMON_H_
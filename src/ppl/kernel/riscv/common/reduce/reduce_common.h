@@ -21,11 +21,15 @@
 namespace ppl { namespace kernel { namespace riscv {
 
 enum reduce_op_type_t {
-    REDUCE_MAX  = 0,
-    REDUCE_MIN  = 1,
-    REDUCE_SUM  = 2,
-    REDUCE_MEAN = 3,
-    REDUCE_PROD = 4,
+    REDUCE_MAX         = 0,
+    REDUCE_MIN         = 1,
+    REDUCE_SUM         = 2,
+    REDUCE_MEAN        = 3,
+    REDUCE_PROD        = 4,
+    REDUCE_SUM_SQUARE  = 5,
+    REDUCE_L1          = 6,
+    REDUCE_L2          = 7,
+    REDUCE_LOG_SUM_EXP = 8,
 };
 
 }}}; // namespace ppl::kernel::riscv
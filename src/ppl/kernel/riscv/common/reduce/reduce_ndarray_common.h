@@ -0,0 +1,439 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_PPL_KERNEL_RISCV_COMMON_REDUCE_REDUCE_NDARRAY_COMMON_H_
+#define __ST_PPL_KERNEL_RISCV_COMMON_REDUCE_REDUCE_NDARRAY_COMMON_H_
+
+#include <cfloat>
+#include <math.h>
+#include <vector>
+#include <riscv-vector.h>
+
+#include "ppl/kernel/riscv/common/reduce/reduce_common.h"
+#include "ppl/kernel/riscv/common/internal_include.h"
+#include "ppl/kernel/riscv/common/vector_math/vector_math_kernel.h"
+
+namespace ppl { namespace kernel { namespace riscv {
+
+// Every reduce accumulates in fp32, fp16 src is widened on load. A src element x is folded into an accumulator
+// by accumulate(acc, x, shift), partial accumulators are merged by combine and finalize turns an accumulator
+// into the dst value. shift is only used by log_sum_exp, which reduces max first and then sums exp(x - max).
+template <reduce_op_type_t op>
+inline float reduce_common_init_val(void)
+{
+    switch (op) {
+        case REDUCE_MAX:
+            return -FLT_MAX;
+        case REDUCE_MIN:
+            return FLT_MAX;
+        case REDUCE_PROD:
+            return 1.0f;
+        default:
+            return 0.0f;
+    }
+}
+
+template <reduce_op_type_t op>
+inline float reduce_common_accumulate(const float acc, const float x, const float shift)
+{
+    switch (op) {
+        case REDUCE_MAX:
+            return max(acc, x);
+        case REDUCE_MIN:
+            return min(acc, x);
+        case REDUCE_PROD:
+            return acc * x;
+        case REDUCE_SUM_SQUARE:
+        case REDUCE_L2:
+            return acc + x * x;
+        case REDUCE_L1:
+            return acc + fabsf(x);
+        case REDUCE_LOG_SUM_EXP:
+            return acc + expf(x - shift);
+        default:
+            return acc + x;
+    }
+}
+
+template <reduce_op_type_t op>
+inline float32xm2_t reduce_common_vaccumulate(const float32xm2_t acc, const float32xm2_t x, const float32xm2_t shift, const uint64_t vl)
+{
+    switch (op) {
+        case REDUCE_MAX:
+            return vfmaxvv_float32xm2(acc, x, vl);
+        case REDUCE_MIN:
+            return vfminvv_float32xm2(acc, x, vl);
+        case REDUCE_PROD:
+            return vfmulvv_float32xm2(acc, x, vl);
+        case REDUCE_SUM_SQUARE:
+        case REDUCE_L2:
+            return vfmaccvv_float32xm2(acc, x, x, vl);
+        case REDUCE_L1:
+            return vfaddvv_float32xm2(acc, vfsgnjxvv_float32xm2(x, x, vl), vl);
+        case REDUCE_LOG_SUM_EXP:
+            return vfaddvv_float32xm2(acc, vfexp_float32xm2(vfsubvv_float32xm2(x, shift, vl), vl), vl);
+        default:
+            return vfaddvv_float32xm2(acc, x, vl);
+    }
+}
+
+template <reduce_op_type_t op>
+inline float reduce_common_combine(const float a, const float b)
+{
+    switch (op) {
+        case REDUCE_MAX:
+            return max(a, b);
+        case REDUCE_MIN:
+            return min(a, b);
+        case REDUCE_PROD:
+            return a * b;
+        default:
+            return a + b;
+    }
+}
+
+template <reduce_op_type_t op>
+inline float reduce_common_finalize(const float acc, const float shift, const int64_t reduce_len)
+{
+    switch (op) {
+        case REDUCE_MEAN:
+            return acc / reduce_len;
+        case REDUCE_L2:
+            return sqrtf(acc);
+        case REDUCE_LOG_SUM_EXP:
+            return logf(acc) + shift;
+        default:
+            return acc;
+    }
+}
+
+template <typename T>
+inline float32xm2_t reduce_common_vload(const T* src, const uint64_t vl);
+template <>
+inline float32xm2_t reduce_common_vload<float>(const float* src, const uint64_t vl)
+{
+    return vlev_float32xm2(src, vl);
+}
+template <>
+inline float32xm2_t reduce_common_vload<__fp16>(const __fp16* src, const uint64_t vl)
+{
+    return vfwcvtffv_float32xm2_float16xm1(vlev_float16xm1(src, vl), vl);
+}
+
+// The src is viewed as [kept..., rows..., inner] or [kept..., rows..., row_len]: neighbouring dims of the
+// same kind are merged and size 1 dims dropped. If the last dim is kept it becomes inner, contiguous in src
+// and dst, and every row is an inner long vector folded element wise. Otherwise the last reduced dims become
+// row_len and every row is a contiguous run folded into one value.
+struct reduce_common_param_t {
+    int64_t outer;
+    int64_t inner;
+    int64_t row_len;
+    int64_t num_rows;
+
+    int64_t num_kept;
+    int64_t kept_dims[PPL_RISCV_TENSOR_MAX_DIMS()];
+    int64_t kept_stride[PPL_RISCV_TENSOR_MAX_DIMS()];
+    int64_t num_red;
+    int64_t red_dims[PPL_RISCV_TENSOR_MAX_DIMS()];
+    int64_t red_stride[PPL_RISCV_TENSOR_MAX_DIMS()];
+};
+
+inline void reduce_common_init_param(
+    const int64_t* src_dims,
+    const int64_t dim_count,
+    const bool* reduce_flag,
+    reduce_common_param_t* param)
+{
+    int64_t dims[PPL_RISCV_TENSOR_MAX_DIMS()];
+    bool reduced[PPL_RISCV_TENSOR_MAX_DIMS()];
+    int64_t num_dims = 0;
+    for (int64_t i = 0; i < dim_count; i++) {
+        if (src_dims[i] == 1) {
+            continue;
+        }
+        if (num_dims > 0 && reduced[num_dims - 1] == reduce_flag[i]) {
+            dims[num_dims - 1] *= src_dims[i];
+        } else {
+            dims[num_dims]    = src_dims[i];
+            reduced[num_dims] = reduce_flag[i];
+            num_dims++;
+        }
+    }
+
+    int64_t stride[PPL_RISCV_TENSOR_MAX_DIMS()];
+    int64_t s = 1;
+    for (int64_t i = num_dims - 1; i >= 0; i--) {
+        stride[i] = s;
+        s *= dims[i];
+    }
+
+    param->inner   = 1;
+    param->row_len = 1;
+    int64_t end    = num_dims;
+    if (num_dims > 0) {
+        if (reduced[num_dims - 1]) {
+            param->row_len = dims[num_dims - 1];
+        } else {
+            param->inner = dims[num_dims - 1];
+        }
+        end = num_dims - 1;
+    }
+
+    param->outer    = 1;
+    param->num_rows = 1;
+    param->num_kept = 0;
+    param->num_red  = 0;
+    for (int64_t i = 0; i < end; i++) {
+        if (reduced[i]) {
+            param->red_dims[param->num_red]   = dims[i];
+            param->red_stride[param->num_red] = stride[i];
+            param->num_rows *= dims[i];
+            param->num_red++;
+        } else {
+            param->kept_dims[param->num_kept]   = dims[i];
+            param->kept_stride[param->num_kept] = stride[i];
+            param->outer *= dims[i];
+            param->num_kept++;
+        }
+    }
+}
+
+inline int64_t reduce_common_offset(
+    int64_t idx,
+    const int64_t num_dims,
+    const int64_t* dims,
+    const int64_t* stride,
+    int64_t* pos)
+{
+    int64_t offset = 0;
+    for (int64_t i = num_dims - 1; i >= 0; i--) {
+        pos[i] = idx % dims[i];
+        idx /= dims[i];
+        offset += pos[i] * stride[i];
+    }
+    return offset;
+}
+
+inline int64_t reduce_common_next_row(
+    const reduce_common_param_t& param,
+    int64_t offset,
+    int64_t* pos)
+{
+    for (int64_t i = param.num_red - 1; i >= 0; i--) {
+        offset += param.red_stride[i];
+        if (++pos[i] < param.red_dims[i]) {
+            break;
+        }
+        offset -= param.red_stride[i] * param.red_dims[i];
+        pos[i] = 0;
+    }
+    return offset;
+}
+
+// folds rows [row_beg, row_end) of an inner_len slice into acc
+template <typename T, reduce_op_type_t op>
+void reduce_common_inner_kernel(
+    const T* src,
+    const reduce_common_param_t& param,
+    const int64_t row_beg,
+    const int64_t row_end,
+    const int64_t inner_len,
+    const float* shift,
+    float* acc)
+{
+    const uint64_t vl    = vsetvli(8, RVV_E32, RVV_M2);
+    const float init_val = reduce_common_init_val<op>();
+    for (int64_t i = 0; i < inner_len; i++) {
+        acc[i] = init_val;
+    }
+
+    int64_t pos[PPL_RISCV_TENSOR_MAX_DIMS()];
+    int64_t offset = reduce_common_offset(row_beg, param.num_red, param.red_dims, param.red_stride, pos);
+    for (int64_t r = row_beg; r < row_end; r++) {
+        const T* src_row = src + offset;
+        int64_t i        = 0;
+        for (; i + 8 <= inner_len; i += 8) {
+            const float32xm2_t v_shift = op == REDUCE_LOG_SUM_EXP ? vlev_float32xm2(shift + i, vl) : vfmvvf_float32xm2(0.0f, vl);
+            const float32xm2_t v_acc   = reduce_common_vaccumulate<op>(vlev_float32xm2(acc + i, vl), reduce_common_vload<T>(src_row + i, vl), v_shift, vl);
+            vsev_float32xm2(acc + i, v_acc, vl);
+        }
+        for (; i < inner_len; i++) {
+            acc[i] = reduce_common_accumulate<op>(acc[i], src_row[i], op == REDUCE_LOG_SUM_EXP ? shift[i] : 0.0f);
+        }
+        offset = reduce_common_next_row(param, offset, pos);
+    }
+}
+
+// folds elements [beg, end) of the rows x row_len reduce space into one value
+template <typename T, reduce_op_type_t op>
+float reduce_common_row_kernel(
+    const T* src,
+    const reduce_common_param_t& param,
+    const int64_t beg,
+    const int64_t end,
+    const float shift)
+{
+    const uint64_t vl          = vsetvli(8, RVV_E32, RVV_M2);
+    const float init_val       = reduce_common_init_val<op>();
+    const float32xm2_t v_shift = vfmvvf_float32xm2(shift, vl);
+    float32xm2_t v_acc0        = vfmvvf_float32xm2(init_val, vl);
+    float32xm2_t v_acc1        = v_acc0;
+    float acc                  = init_val;
+
+    const int64_t row_len = param.row_len;
+    int64_t pos[PPL_RISCV_TENSOR_MAX_DIMS()];
+    int64_t offset = reduce_common_offset(beg / row_len, param.num_red, param.red_dims, param.red_stride, pos);
+    int64_t l      = beg % row_len;
+    int64_t remain = end - beg;
+    while (remain > 0) {
+        const T* src_row    = src + offset;
+        const int64_t l_end = min(row_len, l + remain);
+        remain -= l_end - l;
+        for (; l + 16 <= l_end; l += 16) {
+            v_acc0 = reduce_common_vaccumulate<op>(v_acc0, reduce_common_vload<T>(src_row + l + 0, vl), v_shift, vl);
+            v_acc1 = reduce_common_vaccumulate<op>(v_acc1, reduce_common_vload<T>(src_row + l + 8, vl), v_shift, vl);
+        }
+        for (; l < l_end; l++) {
+            acc = reduce_common_accumulate<op>(acc, src_row[l], shift);
+        }
+        offset = reduce_common_next_row(param, offset, pos);
+        l      = 0;
+    }
+
+    float lanes[16];
+    vsev_float32xm2(lanes + 0, v_acc0, vl);
+    vsev_float32xm2(lanes + 8, v_acc1, vl);
+    for (int64_t i = 0; i < 16; i++) {
+        acc = reduce_common_combine<op>(acc, lanes[i]);
+    }
+    return acc;
+}
+
+// writes the unfinalized accumulator of every dst element to out. When the kept dims give fewer tasks than
+// threads the reduce space is split as well, partial accumulators are combined afterwards.
+template <typename T, reduce_op_type_t op>
+void reduce_common_accumulate_all(
+    const T* src,
+    const reduce_common_param_t& param,
+    const float* shift,
+    float* out)
+{
+    const int64_t dst_len       = param.outer * param.inner;
+    const int64_t inner_blk     = 256;
+    const int64_t num_inner_blk = div_up(param.inner, inner_blk);
+    const int64_t num_kept_task = param.outer * num_inner_blk;
+    const int64_t num_threads   = PPL_OMP_MAX_THREADS();
+
+    // the inner kernel splits over rows, the row kernel over elements, a split covers >= 4096 elements
+    const int64_t split_space = param.inner > 1 ? param.num_rows : param.num_rows * param.row_len;
+    const int64_t split_min   = param.inner > 1 ? div_up(4096, min(param.inner, inner_blk)) : 4096;
+    int64_t num_split         = 1;
+    if (num_kept_task < num_threads) {
+        num_split = max<int64_t>(min(div_up(num_threads, num_kept_task), split_space / split_min), 1);
+    }
+    const int64_t split_len = div_up(split_space, num_split);
+    num_split               = div_up(split_space, split_len);
+
+    std::vector<float> partial(num_split > 1 ? num_split * dst_len : 0);
+    float* acc_base = num_split > 1 ? partial.data() : out;
+
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t task = 0; task < num_split * num_kept_task; task++) {
+        const int64_t s     = task / num_kept_task;
+        const int64_t o     = task % num_kept_task / num_inner_blk;
+        const int64_t i_beg = task % num_inner_blk * inner_blk;
+        const int64_t beg   = s * split_len;
+        const int64_t end   = min(beg + split_len, split_space);
+
+        int64_t pos[PPL_RISCV_TENSOR_MAX_DIMS()];
+        const T* src_ = src + reduce_common_offset(o, param.num_kept, param.kept_dims, param.kept_stride, pos) + i_beg;
+        float* acc    = acc_base + s * dst_len + o * param.inner + i_beg;
+        if (param.inner > 1) {
+            const float* shift_ = shift ? shift + o * param.inner + i_beg : nullptr;
+            reduce_common_inner_kernel<T, op>(src_, param, beg, end, min(param.inner - i_beg, inner_blk), shift_, acc);
+        } else {
+            acc[0] = reduce_common_row_kernel<T, op>(src_, param, beg, end, shift ? shift[o] : 0.0f);
+        }
+    }
+
+    if (num_split > 1) {
+        PRAGMA_OMP_PARALLEL_FOR()
+        for (int64_t i = 0; i < dst_len; i++) {
+            float acc = partial[i];
+            for (int64_t s = 1; s < num_split; s++) {
+                acc = reduce_common_combine<op>(acc, partial[s * dst_len + i]);
+            }
+            out[i] = acc;
+        }
+    }
+}
+
+// axes must be non-negative. dst holds the kept dims in src order.
+template <typename T, reduce_op_type_t op>
+ppl::common::RetCode reduce_ndarray_common(
+    const T* src,
+    T* dst,
+
+    const int64_t* src_dims,
+    const int64_t dim_count,
+    const int32_t* axes,
+    const int32_t num_axes)
+{
+    if (dim_count > PPL_RISCV_TENSOR_MAX_DIMS()) {
+        return ppl::common::RC_UNSUPPORTED;
+    }
+
+    bool reduce_flag[PPL_RISCV_TENSOR_MAX_DIMS()] = {false};
+    for (int64_t i = 0; i < num_axes; i++) {
+        reduce_flag[axes[i]] = true;
+    }
+    reduce_common_param_t param;
+    reduce_common_init_param(src_dims, dim_count, reduce_flag, &param);
+
+    const int64_t dst_len    = param.outer * param.inner;
+    const int64_t reduce_len = param.num_rows * param.row_len;
+    if (dst_len == 0) {
+        return ppl::common::RC_SUCCESS;
+    }
+    if (reduce_len == 0) {
+        // an empty reduce gives the finalized init value, e.g. 0 for sum and -inf for log_sum_exp
+        const T empty_val = (T)reduce_common_finalize<op>(reduce_common_init_val<op>(), 0.0f, reduce_len);
+        for (int64_t i = 0; i < dst_len; i++) {
+            dst[i] = empty_val;
+        }
+        return ppl::common::RC_SUCCESS;
+    }
+
+    std::vector<float> shift;
+    if (op == REDUCE_LOG_SUM_EXP) {
+        shift.resize(dst_len);
+        reduce_common_accumulate_all<T, REDUCE_MAX>(src, param, nullptr, shift.data());
+    }
+    std::vector<float> out(dst_len);
+    reduce_common_accumulate_all<T, op>(src, param, shift.empty() ? nullptr : shift.data(), out.data());
+
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t i = 0; i < dst_len; i++) {
+        dst[i] = (T)reduce_common_finalize<op>(out[i], shift.empty() ? 0.0f : shift[i], reduce_len);
+    }
+
+    return ppl::common::RC_SUCCESS;
+}
+
+}}}; // namespace ppl::kernel::riscv
+
+#endif //  __ST_PPL_KERNEL_RISCV_COMMON_REDUCE_REDUCE_NDARRAY_COMMON_H_
@@ -0,0 +1,79 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_PPL_KERNEL_RISCV_COMMON_REORDER_REORDER_COMMON_H_
+#define __ST_PPL_KERNEL_RISCV_COMMON_REORDER_REORDER_COMMON_H_
+
+#include "ppl/kernel/riscv/common/internal_include.h"
+
+namespace ppl { namespace kernel { namespace riscv {
+
+// Layout reorders between ndarray (c_blk 1) and nbcx (n4cx / n8cx), optionally converting the element type
+// in the same pass. The tensor is walked in tiles of c_blk channels by inner_blk spatial elements so that
+// small channel counts, e.g. 3 channel model inputs, still spread over threads.
+//
+// A block func moves c_len (<= c_blk) channels of i_len spatial elements. src / dst point at channel c_beg,
+// spatial index i_beg of their layout, inner is the spatial size used for the channel and block strides.
+// Padded channels of an nbcx dst are written as 0.
+template <typename srcT, typename dstT>
+using reorder_common_block_func_t = void (*)(const srcT* src, const int64_t inner, const int64_t c_len, const int64_t i_len, dstT* dst);
+
+template <typename srcT, typename dstT, int64_t src_c_blk, int64_t dst_c_blk>
+ppl::common::RetCode reorder_common(
+    const ppl::common::TensorShape* src_shape,
+    const srcT* src,
+    const reorder_common_block_func_t<srcT, dstT> block_func,
+    dstT* dst)
+{
+    const int64_t dim_count = src_shape->GetDimCount();
+    if (dim_count < 2) {
+        return ppl::common::RC_UNSUPPORTED;
+    }
+    const int64_t batch    = src_shape->GetDim(0);
+    const int64_t channels = src_shape->GetDim(1);
+    int64_t inner          = 1;
+    for (int64_t i = 2; i < dim_count; i++) {
+        inner *= src_shape->GetDim(i);
+    }
+
+    const int64_t c_blk     = max(src_c_blk, dst_c_blk);
+    const int64_t inner_blk = 1024;
+    const int64_t src_pad_c = round_up(channels, src_c_blk);
+    const int64_t dst_pad_c = round_up(channels, dst_c_blk);
+    const int64_t num_c_blk = div_up(channels, c_blk);
+    const int64_t num_i_blk = div_up(inner, inner_blk);
+    const int64_t num_task  = batch * num_c_blk * num_i_blk;
+
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t task = 0; task < num_task; task++) {
+        const int64_t n     = task / (num_c_blk * num_i_blk);
+        const int64_t c_beg = task / num_i_blk % num_c_blk * c_blk;
+        const int64_t i_beg = task % num_i_blk * inner_blk;
+        const int64_t c_len = min(channels - c_beg, c_blk);
+        const int64_t i_len = min(inner - i_beg, inner_blk);
+
+        const srcT* src_ = src + (n * src_pad_c + c_beg) * inner + i_beg * src_c_blk;
+        dstT* dst_       = dst + (n * dst_pad_c + c_beg) * inner + i_beg * dst_c_blk;
+        block_func(src_, inner, c_len, i_len, dst_);
+    }
+
+    return ppl::common::RC_SUCCESS;
+}
+
+}}}; // namespace ppl::kernel::riscv
+
+#endif //  __ST_PPL_KERNEL_RISCV_COMMON_REORDER_REORDER_COMMON_H_
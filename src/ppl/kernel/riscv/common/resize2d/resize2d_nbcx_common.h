@@ -19,11 +19,13 @@
 #define __ST_PPL_KERNEL_RISCV_COMMON_RESIZE2D_RESIZE2D_NBCX_COMMON_H_
 
 #include <math.h>
+#include <algorithm>
 #include <vector>
 #include <riscv-vector.h>
 #include <type_traits>
 
 #include "ppl/kernel/riscv/common/internal_include.h"
+#include "ppl/kernel/riscv/common/resize2d/resize2d_ndarray_common.h"
 
 namespace ppl { namespace kernel { namespace riscv {
 
@@ -79,6 +81,39 @@ inline float32xm1_t vfaddvv<float32xm1_t, float>(float32xm1_t va, float32xm1_t v
     return vfaddvv_float32xm1(va, vb, n);
 }
 
+template <typename eT, typename T>
+inline eT vfmaccvf(eT vacc, T b, eT va, uint64_t n);
+template <>
+inline float16xm1_t vfmaccvf<float16xm1_t, __fp16>(float16xm1_t vacc, __fp16 b, float16xm1_t va, uint64_t n)
+{
+    return vfmaccvf_float16xm1(vacc, b, va, n);
+}
+template <>
+inline float32xm1_t vfmaccvf<float32xm1_t, float>(float32xm1_t vacc, float b, float32xm1_t va, uint64_t n)
+{
+    return vfmaccvf_float32xm1(vacc, b, va, n);
+}
+
+// Separable like the ndarray version: each src row is resized along w into a per thread two row cache,
+// vectors run along the c_blk channels of a pixel.
+template <typename eT, typename T, int32_t c_blk>
+inline void resize2d_nbcx_linear_horizontal(
+    const T* src_row,
+    const int64_t* w_idx,
+    const float* w_coeff,
+    const int64_t dst_w,
+    const uint64_t vl,
+    T* row)
+{
+    for (int64_t ow = 0; ow < dst_w; ++ow) {
+        eT v_data0 = vlev<eT, T>(src_row + w_idx[2 * ow + 0] * c_blk, vl);
+        eT v_data1 = vlev<eT, T>(src_row + w_idx[2 * ow + 1] * c_blk, vl);
+        eT v_row   = vfmulvf<eT, T>(v_data0, (T)w_coeff[2 * ow + 0], vl);
+        v_row      = vfmaccvf<eT, T>(v_row, (T)w_coeff[2 * ow + 1], v_data1, vl);
+        vsev<eT, T>(row + ow * c_blk, v_row, vl);
+    }
+}
+
 template <typename eT, typename T, int32_t c_blk>
 ppl::common::RetCode resize2d_nbcx_pytorch_linear_floor_common(
     const ppl::common::TensorShape* src_shape,
@@ -102,67 +137,58 @@ ppl::common::RetCode resize2d_nbcx_pytorch_linear_floor_common(
     const int64_t dst_h    = dst_shape->GetDim(2);
     const int64_t dst_w    = dst_shape->GetDim(3);
     const int64_t padded_c = round_up(channels, c_blk);
-    const float hscale     = 1.0f / scale_h;
-    const float wscale     = 1.0f / scale_w;
 
-    std::vector<int32_t> w0_tab(dst_w);
-    std::vector<int32_t> w1_tab(dst_w);
-    std::vector<float> w0_lambda_tab(dst_w);
-    std::vector<float> w1_lambda_tab(dst_w);
-    for (int64_t ow = 0; ow < dst_w; ow++) {
-        float iw = dst_w > 1 ? (ow + 0.5f) * wscale - 0.5f : 0;
-        if (iw < 0) {
-            w0_tab[ow]        = 0;
-            w1_tab[ow]        = 0;
-            w0_lambda_tab[ow] = 1;
-            w1_lambda_tab[ow] = 0;
-        } else {
-            w0_tab[ow]        = (int64_t)iw;
-            w1_tab[ow]        = w0_tab[ow] + (w0_tab[ow] < src_w - 1);
-            w1_lambda_tab[ow] = iw - w0_tab[ow];
-            w0_lambda_tab[ow] = 1.0f - w1_lambda_tab[ow];
-        }
-    }
+    std::vector<int64_t> w_idx(dst_w * 2);
+    std::vector<float> w_coeff(dst_w * 2);
+    std::vector<int64_t> h_idx(dst_h * 2);
+    std::vector<float> h_coeff(dst_h * 2);
+    resize2d_ndarray_linear_table(src_w, dst_w, scale_w, w_idx.data(), w_coeff.data());
+    resize2d_ndarray_linear_table(src_h, dst_h, scale_h, h_idx.data(), h_coeff.data());
+
+    const int64_t h_blk     = 16;
+    const int64_t num_h_blk = div_up(dst_h, h_blk);
+    const int64_t num_c_blk = batch * padded_c / c_blk;
+    std::vector<T> row_cache(PPL_OMP_MAX_THREADS() * 2 * dst_w * c_blk);
+
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t task = 0; task < num_c_blk * num_h_blk; ++task) {
+        const int64_t bc     = task / num_h_blk * c_blk;
+        const int64_t oh_beg = task % num_h_blk * h_blk;
+        const int64_t oh_end = min(oh_beg + h_blk, dst_h);
+        const T* src_        = src + bc * src_h * src_w;
+        T* dst_              = dst + bc * dst_h * dst_w;
 
-    for (int64_t bc = 0; bc < batch * padded_c; bc += c_blk) {
-        const T* src_ = src + bc * src_h * src_w;
-        T* dst_       = dst + bc * dst_h * dst_w;
-        for (int64_t oh = 0; oh < dst_h; ++oh) {
-            float ih = dst_h > 1 ? (oh + 0.5f) * hscale - 0.5f : 0;
-            int64_t h0, h1;
-            float h0_lambda, h1_lambda;
-            if (ih < 0) {
-                h0        = 0;
-                h1        = 0;
-                h0_lambda = 1;
-                h1_lambda = 0;
-            } else {
-                h0        = (int64_t)ih;
-                h1        = h0 + (h0 < src_h - 1);
-                h1_lambda = ih - h0;
-                h0_lambda = 1.0f - h1_lambda;
+        T* slot[2] = {
+            row_cache.data() + (PPL_OMP_THREAD_ID() * 2 + 0) * dst_w * c_blk,
+            row_cache.data() + (PPL_OMP_THREAD_ID() * 2 + 1) * dst_w * c_blk,
+        };
+        int64_t slot_row[2] = {-1, -1};
+
+        for (int64_t oh = oh_beg; oh < oh_end; ++oh) {
+            const int64_t h0 = h_idx[2 * oh + 0];
+            const int64_t h1 = h_idx[2 * oh + 1];
+            // rows only move forward, keep h0 in slot 0 and h1 in slot 1
+            if (slot_row[0] != h0) {
+                if (slot_row[1] == h0) {
+                    std::swap(slot[0], slot[1]);
+                    std::swap(slot_row[0], slot_row[1]);
+                } else {
+                    resize2d_nbcx_linear_horizontal<eT, T, c_blk>(src_ + h0 * src_w * c_blk, w_idx.data(), w_coeff.data(), dst_w, vl, slot[0]);
+                    slot_row[0] = h0;
+                }
+            }
+            if (slot_row[1] != h1) {
+                resize2d_nbcx_linear_horizontal<eT, T, c_blk>(src_ + h1 * src_w * c_blk, w_idx.data(), w_coeff.data(), dst_w, vl, slot[1]);
+                slot_row[1] = h1;
             }
+
+            const T h0_lambda = (T)h_coeff[2 * oh + 0];
+            const T h1_lambda = (T)h_coeff[2 * oh + 1];
+            T* dst_p          = dst_ + oh * dst_w * c_blk;
             for (int64_t ow = 0; ow < dst_w; ++ow) {
-                int64_t w0, w1;
-                float w0_lambda, w1_lambda;
-                w0        = w0_tab[ow];
-                w1        = w1_tab[ow];
-                w0_lambda = w0_lambda_tab[ow];
-                w1_lambda = w1_lambda_tab[ow];
-
-                eT v_data0 = vlev<eT, T>(src_ + (h0 * src_w + w0) * c_blk, vl);
-                eT v_data1 = vlev<eT, T>(src_ + (h0 * src_w + w1) * c_blk, vl);
-                eT v_data2 = vlev<eT, T>(src_ + (h1 * src_w + w0) * c_blk, vl);
-                eT v_data3 = vlev<eT, T>(src_ + (h1 * src_w + w1) * c_blk, vl);
-
-                v_data0 = vfmulvf<eT, T>(v_data0, (T)(h0_lambda * w0_lambda), vl);
-                v_data1 = vfmulvf<eT, T>(v_data1, (T)(h0_lambda * w1_lambda), vl);
-                v_data2 = vfmulvf<eT, T>(v_data2, (T)(h1_lambda * w0_lambda), vl);
-                v_data3 = vfmulvf<eT, T>(v_data3, (T)(h1_lambda * w1_lambda), vl);
-
-                eT v_dst =
-                    vfaddvv<eT, T>(vfaddvv<eT, T>(v_data0, v_data1, vl), vfaddvv<eT, T>(v_data2, v_data3, vl), vl);
-                vsev<eT, T>(dst_ + (oh * dst_w + ow) * c_blk, v_dst, vl);
+                eT v_dst = vfmulvf<eT, T>(vlev<eT, T>(slot[0] + ow * c_blk, vl), h0_lambda, vl);
+                v_dst    = vfmaccvf<eT, T>(v_dst, h1_lambda, vlev<eT, T>(slot[1] + ow * c_blk, vl), vl);
+                vsev<eT, T>(dst_p + ow * c_blk, v_dst, vl);
             }
         }
     }
@@ -200,27 +226,27 @@ ppl::common::RetCode resize2d_nbcx_asymmetric_nearest_floor_common(
         iw_list[i] = static_cast<int64_t>(i * wscale);
     }
 
-    for (int64_t bc = 0; bc < batch * padded_c; bc += c_blk) {
-        const T* src_ = src + bc * src_h * src_w;
-        T* dst_       = dst + bc * dst_h * dst_w;
-        for (int64_t oh = 0; oh < dst_h; ++oh) {
-            int64_t ih     = static_cast<int64_t>(oh * hscale);
-            const T* src_p = src_ + ih * src_w * c_blk;
-            T* dst_p       = dst_ + oh * dst_w * c_blk;
-            int64_t ow     = 0;
-            for (; ow + 8 < dst_w; ow += 8) {
-                vsev<eT, T>(dst_p + (ow + 0) * c_blk, vlev<eT, T>(src_p + iw_list[ow + 0] * c_blk, vl), vl);
-                vsev<eT, T>(dst_p + (ow + 1) * c_blk, vlev<eT, T>(src_p + iw_list[ow + 1] * c_blk, vl), vl);
-                vsev<eT, T>(dst_p + (ow + 2) * c_blk, vlev<eT, T>(src_p + iw_list[ow + 2] * c_blk, vl), vl);
-                vsev<eT, T>(dst_p + (ow + 3) * c_blk, vlev<eT, T>(src_p + iw_list[ow + 3] * c_blk, vl), vl);
-                vsev<eT, T>(dst_p + (ow + 4) * c_blk, vlev<eT, T>(src_p + iw_list[ow + 4] * c_blk, vl), vl);
-                vsev<eT, T>(dst_p + (ow + 5) * c_blk, vlev<eT, T>(src_p + iw_list[ow + 5] * c_blk, vl), vl);
-                vsev<eT, T>(dst_p + (ow + 6) * c_blk, vlev<eT, T>(src_p + iw_list[ow + 6] * c_blk, vl), vl);
-                vsev<eT, T>(dst_p + (ow + 7) * c_blk, vlev<eT, T>(src_p + iw_list[ow + 7] * c_blk, vl), vl);
-            }
-            for (; ow < dst_w; ow++) {
-                vsev<eT, T>(dst_p + ow * c_blk, vlev<eT, T>(src_p + iw_list[ow] * c_blk, vl), vl);
-            }
+    const int64_t num_c_blk = batch * padded_c / c_blk;
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t bc_oh = 0; bc_oh < num_c_blk * dst_h; ++bc_oh) {
+        const int64_t bc = bc_oh / dst_h * c_blk;
+        const int64_t oh = bc_oh % dst_h;
+        const int64_t ih = static_cast<int64_t>(oh * hscale);
+        const T* src_p   = src + bc * src_h * src_w + ih * src_w * c_blk;
+        T* dst_p         = dst + bc * dst_h * dst_w + oh * dst_w * c_blk;
+        int64_t ow       = 0;
+        for (; ow + 8 < dst_w; ow += 8) {
+            vsev<eT, T>(dst_p + (ow + 0) * c_blk, vlev<eT, T>(src_p + iw_list[ow + 0] * c_blk, vl), vl);
+            vsev<eT, T>(dst_p + (ow + 1) * c_blk, vlev<eT, T>(src_p + iw_list[ow + 1] * c_blk, vl), vl);
+            vsev<eT, T>(dst_p + (ow + 2) * c_blk, vlev<eT, T>(src_p + iw_list[ow + 2] * c_blk, vl), vl);
+            vsev<eT, T>(dst_p + (ow + 3) * c_blk, vlev<eT, T>(src_p + iw_list[ow + 3] * c_blk, vl), vl);
+            vsev<eT, T>(dst_p + (ow + 4) * c_blk, vlev<eT, T>(src_p + iw_list[ow + 4] * c_blk, vl), vl);
+            vsev<eT, T>(dst_p + (ow + 5) * c_blk, vlev<eT, T>(src_p + iw_list[ow + 5] * c_blk, vl), vl);
+            vsev<eT, T>(dst_p + (ow + 6) * c_blk, vlev<eT, T>(src_p + iw_list[ow + 6] * c_blk, vl), vl);
+            vsev<eT, T>(dst_p + (ow + 7) * c_blk, vlev<eT, T>(src_p + iw_list[ow + 7] * c_blk, vl), vl);
+        }
+        for (; ow < dst_w; ow++) {
+            vsev<eT, T>(dst_p + ow * c_blk, vlev<eT, T>(src_p + iw_list[ow] * c_blk, vl), vl);
         }
     }
 
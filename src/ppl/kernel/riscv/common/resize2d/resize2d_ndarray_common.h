@@ -25,13 +25,43 @@
 
 namespace ppl { namespace kernel { namespace riscv {
 
+// Linear and cubic resizes are separable: each src row is resized along w into a per thread row cache,
+// then every dst row is a num_taps weighted sum of cached rows. Index / weight tables hold num_taps
+// entries per dst column (x) and per dst row (y), with indices already clamped to the src.
+//
+// A vertical func writes dst[i] = sum_k coeff[k] * rows[k][i] for i < width.
 template <typename T>
-ppl::common::RetCode resize2d_ndarray_pytorch_linear_floor_common(
+using resize2d_ndarray_vertical_func_t = void (*)(const float* const* rows, const float* coeff, const int64_t num_taps, const int64_t width, T* dst);
+
+template <typename T, int64_t num_taps>
+inline void resize2d_ndarray_horizontal(
+    const T* src_row,
+    const int64_t* x_idx,
+    const float* x_coeff,
+    const int64_t dst_w,
+    float* row)
+{
+    for (int64_t ow = 0; ow < dst_w; ++ow) {
+        const int64_t* idx = x_idx + ow * num_taps;
+        const float* coeff = x_coeff + ow * num_taps;
+        float sum          = coeff[0] * src_row[idx[0]];
+        for (int64_t k = 1; k < num_taps; ++k) {
+            sum += coeff[k] * src_row[idx[k]];
+        }
+        row[ow] = sum;
+    }
+}
+
+template <typename T, int64_t num_taps>
+ppl::common::RetCode resize2d_ndarray_separable_common(
     const ppl::common::TensorShape* src_shape,
     const ppl::common::TensorShape* dst_shape,
     const T* src,
-    const float scale_h,
-    const float scale_w,
+    const int64_t* x_idx,
+    const float* x_coeff,
+    const int64_t* y_idx,
+    const float* y_coeff,
+    const resize2d_ndarray_vertical_func_t<T> vertical_func,
     T* dst)
 {
     const int64_t num_imgs = src_shape->GetDim(0) * src_shape->GetDim(1);
@@ -39,54 +69,115 @@ ppl::common::RetCode resize2d_ndarray_pytorch_linear_floor_common(
     const int64_t src_w    = src_shape->GetDim(3);
     const int64_t dst_h    = dst_shape->GetDim(2);
     const int64_t dst_w    = dst_shape->GetDim(3);
-    const float hscale     = 1.0f / scale_h;
-    const float wscale     = 1.0f / scale_w;
 
-    for (int64_t ni = 0; ni < num_imgs; ++ni) {
-        const T* src_ = src + ni * src_h * src_w;
-        T* dst_       = dst + ni * dst_h * dst_w;
-        for (int64_t oh = 0; oh < dst_h; ++oh) {
-            float ih = dst_h > 1 ? (oh + 0.5f) * hscale - 0.5f : 0;
-            int64_t h0, h1;
-            float h0_lambda, h1_lambda;
-            if (ih < 0) {
-                h0        = 0;
-                h1        = 0;
-                h0_lambda = 1;
-                h1_lambda = 0;
-            } else {
-                h0        = (int64_t)ih;
-                h1        = h0 + (h0 < src_h - 1);
-                h1_lambda = ih - h0;
-                h0_lambda = 1.0f - h1_lambda;
-            }
+    // consecutive dst rows of a block mostly share src rows, so a block reuses its row cache
+    const int64_t h_blk     = 16;
+    const int64_t num_h_blk = div_up(dst_h, h_blk);
+    std::vector<float> row_cache(PPL_OMP_MAX_THREADS() * num_taps * dst_w);
+
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t task = 0; task < num_imgs * num_h_blk; ++task) {
+        const int64_t ni     = task / num_h_blk;
+        const int64_t oh_beg = task % num_h_blk * h_blk;
+        const int64_t oh_end = min(oh_beg + h_blk, dst_h);
+        const T* src_        = src + ni * src_h * src_w;
+        T* dst_              = dst + ni * dst_h * dst_w;
+
+        float* slot[num_taps];
+        int64_t slot_row[num_taps];
+        for (int64_t s = 0; s < num_taps; ++s) {
+            slot[s]     = row_cache.data() + (PPL_OMP_THREAD_ID() * num_taps + s) * dst_w;
+            slot_row[s] = -1;
+        }
 
-            for (int64_t ow = 0; ow < dst_w; ++ow) {
-                float iw = dst_w > 1 ? (ow + 0.5f) * wscale - 0.5f : 0;
-                int64_t w0, w1;
-                float w0_lambda, w1_lambda;
-                if (iw < 0) {
-                    w0        = 0;
-                    w1        = 0;
-                    w0_lambda = 1;
-                    w1_lambda = 0;
-                } else {
-                    w0        = (int64_t)iw;
-                    w1        = w0 + (w0 < src_w - 1);
-                    w1_lambda = iw - w0;
-                    w0_lambda = 1.0f - w1_lambda;
+        for (int64_t oh = oh_beg; oh < oh_end; ++oh) {
+            const int64_t* ys = y_idx + oh * num_taps;
+            const float* rows[num_taps];
+            bool slot_used[num_taps];
+            bool slot_wanted[num_taps];
+            for (int64_t s = 0; s < num_taps; ++s) {
+                slot_used[s]   = false;
+                slot_wanted[s] = false;
+                for (int64_t k = 0; k < num_taps; ++k) {
+                    slot_wanted[s] = slot_wanted[s] || slot_row[s] == ys[k];
                 }
+            }
 
-                dst_[oh * dst_w + ow] = src_[h0 * src_w + w0] * h0_lambda * w0_lambda +
-                                        src_[h0 * src_w + w1] * h0_lambda * w1_lambda + src_[h1 * src_w + w0] * h1_lambda * w0_lambda +
-                                        src_[h1 * src_w + w1] * h1_lambda * w1_lambda;
+            for (int64_t k = 0; k < num_taps; ++k) {
+                int64_t s = 0;
+                while (s < num_taps && slot_row[s] != ys[k]) {
+                    ++s;
+                }
+                if (s == num_taps) {
+                    // evict a slot holding no row of this dst row
+                    s = 0;
+                    while (slot_used[s] || slot_wanted[s]) {
+                        ++s;
+                    }
+                    resize2d_ndarray_horizontal<T, num_taps>(src_ + ys[k] * src_w, x_idx, x_coeff, dst_w, slot[s]);
+                    slot_row[s] = ys[k];
+                }
+                slot_used[s] = true;
+                rows[k]      = slot[s];
             }
+
+            vertical_func(rows, y_coeff + oh * num_taps, num_taps, dst_w, dst_ + oh * dst_w);
         }
     }
 
     return ppl::common::RC_SUCCESS;
 }
 
+inline void resize2d_ndarray_linear_table(
+    const int64_t src_len,
+    const int64_t dst_len,
+    const float scale,
+    int64_t* idx,
+    float* coeff)
+{
+    const float rscale = 1.0f / scale;
+    for (int64_t o = 0; o < dst_len; ++o) {
+        const float i = dst_len > 1 ? (o + 0.5f) * rscale - 0.5f : 0;
+        if (i < 0) {
+            idx[2 * o + 0]   = 0;
+            idx[2 * o + 1]   = 0;
+            coeff[2 * o + 0] = 1;
+            coeff[2 * o + 1] = 0;
+        } else {
+            idx[2 * o + 0]   = (int64_t)i;
+            idx[2 * o + 1]   = idx[2 * o + 0] + (idx[2 * o + 0] < src_len - 1);
+            coeff[2 * o + 1] = i - idx[2 * o + 0];
+            coeff[2 * o + 0] = 1.0f - coeff[2 * o + 1];
+        }
+    }
+}
+
+template <typename T>
+ppl::common::RetCode resize2d_ndarray_pytorch_linear_floor_common(
+    const ppl::common::TensorShape* src_shape,
+    const ppl::common::TensorShape* dst_shape,
+    const T* src,
+    const float scale_h,
+    const float scale_w,
+    const resize2d_ndarray_vertical_func_t<T> vertical_func,
+    T* dst)
+{
+    const int64_t src_h = src_shape->GetDim(2);
+    const int64_t src_w = src_shape->GetDim(3);
+    const int64_t dst_h = dst_shape->GetDim(2);
+    const int64_t dst_w = dst_shape->GetDim(3);
+
+    std::vector<int64_t> x_idx(dst_w * 2);
+    std::vector<float> x_coeff(dst_w * 2);
+    std::vector<int64_t> y_idx(dst_h * 2);
+    std::vector<float> y_coeff(dst_h * 2);
+    resize2d_ndarray_linear_table(src_w, dst_w, scale_w, x_idx.data(), x_coeff.data());
+    resize2d_ndarray_linear_table(src_h, dst_h, scale_h, y_idx.data(), y_coeff.data());
+
+    return resize2d_ndarray_separable_common<T, 2>(
+        src_shape, dst_shape, src, x_idx.data(), x_coeff.data(), y_idx.data(), y_coeff.data(), vertical_func, dst);
+}
+
 template <typename T>
 ppl::common::RetCode resize2d_ndarray_asymmetric_nearest_floor_common(
     const ppl::common::TensorShape* src_shape,
@@ -109,27 +200,26 @@ ppl::common::RetCode resize2d_ndarray_asymmetric_nearest_floor_common(
         iw_list[i] = static_cast<int64_t>(i * wscale);
     }
 
-    for (int64_t ni = 0; ni < num_imgs; ++ni) {
-        const T* src_ = src + ni * src_h * src_w;
-        T* dst_       = dst + ni * dst_h * dst_w;
-        for (int64_t oh = 0; oh < dst_h; ++oh) {
-            int64_t ih     = static_cast<int64_t>(oh * hscale);
-            const T* src_p = src_ + ih * src_w;
-            T* dst_p       = dst_ + oh * dst_w;
-            int64_t ow     = 0;
-            for (; ow + 8 < dst_w; ow += 8) {
-                dst_p[ow + 0] = src_p[iw_list[ow + 0]];
-                dst_p[ow + 1] = src_p[iw_list[ow + 1]];
-                dst_p[ow + 2] = src_p[iw_list[ow + 2]];
-                dst_p[ow + 3] = src_p[iw_list[ow + 3]];
-                dst_p[ow + 4] = src_p[iw_list[ow + 4]];
-                dst_p[ow + 5] = src_p[iw_list[ow + 5]];
-                dst_p[ow + 6] = src_p[iw_list[ow + 6]];
-                dst_p[ow + 7] = src_p[iw_list[ow + 7]];
-            }
-            for (; ow < dst_w; ow++) {
-                dst_p[ow] = src_p[iw_list[ow]];
-            }
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t ni_oh = 0; ni_oh < num_imgs * dst_h; ++ni_oh) {
+        const int64_t ni = ni_oh / dst_h;
+        const int64_t oh = ni_oh % dst_h;
+        const int64_t ih = static_cast<int64_t>(oh * hscale);
+        const T* src_p   = src + ni * src_h * src_w + ih * src_w;
+        T* dst_p         = dst + ni * dst_h * dst_w + oh * dst_w;
+        int64_t ow       = 0;
+        for (; ow + 8 < dst_w; ow += 8) {
+            dst_p[ow + 0] = src_p[iw_list[ow + 0]];
+            dst_p[ow + 1] = src_p[iw_list[ow + 1]];
+            dst_p[ow + 2] = src_p[iw_list[ow + 2]];
+            dst_p[ow + 3] = src_p[iw_list[ow + 3]];
+            dst_p[ow + 4] = src_p[iw_list[ow + 4]];
+            dst_p[ow + 5] = src_p[iw_list[ow + 5]];
+            dst_p[ow + 6] = src_p[iw_list[ow + 6]];
+            dst_p[ow + 7] = src_p[iw_list[ow + 7]];
+        }
+        for (; ow < dst_w; ow++) {
+            dst_p[ow] = src_p[iw_list[ow]];
         }
     }
 
@@ -147,21 +237,25 @@ inline void calc_resize_cubic_coeff(
     coeff[3] = 1.0f - coeff[0] - coeff[1] - coeff[2];
 }
 
-template <typename T>
-inline T get_value_bounded(
-    const T* src,
-    const int64_t h,
-    const int64_t w,
-    const int64_t src_h,
-    const int64_t src_w)
+inline void resize2d_ndarray_cubic_table(
+    const int64_t src_len,
+    const int64_t dst_len,
+    const float scale,
+    const float cubic_coeff_a,
+    int64_t* idx,
+    float* coeff)
 {
-    int64_t h_ = max<int64_t>(min(h, src_h - 1), 0);
-    int64_t w_ = max<int64_t>(min(w, src_w - 1), 0);
-    return src[h_ * src_w + w_];
+    const float rscale = 1.0f / scale;
+    for (int64_t o = 0; o < dst_len; ++o) {
+        const float i    = dst_len > 1 ? (o + 0.5f) * rscale - 0.5f : 0;
+        const int64_t si = ::floor(i);
+        calc_resize_cubic_coeff(i - si, cubic_coeff_a, coeff + 4 * o);
+        for (int64_t k = 0; k < 4; ++k) {
+            idx[4 * o + k] = max<int64_t>(min(si - 1 + k, src_len - 1), 0);
+        }
+    }
 }
 
-#define SRC(h, w) (get_value_bounded(src_, (h), (w), src_h, src_w))
-
 template <typename T>
 ppl::common::RetCode resize2d_ndarray_pytorch_cubic_floor_common(
     const ppl::common::TensorShape* src_shape,
@@ -170,64 +264,23 @@ ppl::common::RetCode resize2d_ndarray_pytorch_cubic_floor_common(
     const float scale_h,
     const float scale_w,
     const float cubic_coeff_a,
+    const resize2d_ndarray_vertical_func_t<T> vertical_func,
     T* dst)
 {
-    const int64_t num_imgs = src_shape->GetDim(0) * src_shape->GetDim(1);
-    const int64_t src_h    = src_shape->GetDim(2);
-    const int64_t src_w    = src_shape->GetDim(3);
-    const int64_t dst_h    = dst_shape->GetDim(2);
-    const int64_t dst_w    = dst_shape->GetDim(3);
-    const float hscale     = 1.0f / scale_h;
-    const float wscale     = 1.0f / scale_w;
-
-    std::vector<int64_t> sy_tab(dst_h);
-    std::vector<float> coeff_y_tab(dst_h * 4);
-    for (int64_t oh = 0; oh < dst_h; ++oh) {
-        float ih   = dst_h > 1 ? (oh + 0.5f) * hscale - 0.5f : 0;
-        int64_t sy = ::floor(ih);
-        float fy   = ih - sy;
-        sy_tab[oh] = sy;
-
-        float* coeff_y = coeff_y_tab.data() + 4 * oh;
-        calc_resize_cubic_coeff(fy, cubic_coeff_a, coeff_y);
-    }
-
-    std::vector<int64_t> sx_tab(dst_w);
-    std::vector<float> coeff_x_tab(dst_w * 4);
-    for (int64_t ow = 0; ow < dst_w; ++ow) {
-        float iw   = dst_w > 1 ? (ow + 0.5f) * wscale - 0.5f : 0;
-        int64_t sx = ::floor(iw);
-        float fx   = iw - sx;
-        sx_tab[ow] = sx;
+    const int64_t src_h = src_shape->GetDim(2);
+    const int64_t src_w = src_shape->GetDim(3);
+    const int64_t dst_h = dst_shape->GetDim(2);
+    const int64_t dst_w = dst_shape->GetDim(3);
 
-        float* coeff_x = coeff_x_tab.data() + 4 * ow;
-        calc_resize_cubic_coeff(fx, cubic_coeff_a, coeff_x);
-    }
+    std::vector<int64_t> x_idx(dst_w * 4);
+    std::vector<float> x_coeff(dst_w * 4);
+    std::vector<int64_t> y_idx(dst_h * 4);
+    std::vector<float> y_coeff(dst_h * 4);
+    resize2d_ndarray_cubic_table(src_w, dst_w, scale_w, cubic_coeff_a, x_idx.data(), x_coeff.data());
+    resize2d_ndarray_cubic_table(src_h, dst_h, scale_h, cubic_coeff_a, y_idx.data(), y_coeff.data());
 
-    for (int64_t ni = 0; ni < num_imgs; ++ni) {
-        for (int64_t oh = 0; oh < dst_h; ++oh) {
-            const T* src_ = src + ni * src_h * src_w;
-            T* dst_       = dst + ni * dst_h * dst_w;
-
-            const int64_t sy     = sy_tab[oh];
-            const float* coeff_y = coeff_y_tab.data() + 4 * oh;
-            for (int64_t ow = 0; ow < dst_w; ++ow) {
-                const int64_t sx     = sx_tab[ow];
-                const float* coeff_x = coeff_x_tab.data() + 4 * ow;
-
-                dst_[oh * dst_w + ow] = SRC(sy - 1, sx - 1) * coeff_x[0] * coeff_y[0] +
-                                        SRC(sy, sx - 1) * coeff_x[0] * coeff_y[1] + SRC(sy + 1, sx - 1) * coeff_x[0] * coeff_y[2] +
-                                        SRC(sy + 2, sx - 1) * coeff_x[0] * coeff_y[3] + SRC(sy - 1, sx) * coeff_x[1] * coeff_y[0] +
-                                        SRC(sy, sx) * coeff_x[1] * coeff_y[1] + SRC(sy + 1, sx) * coeff_x[1] * coeff_y[2] +
-                                        SRC(sy + 2, sx) * coeff_x[1] * coeff_y[3] + SRC(sy - 1, sx + 1) * coeff_x[2] * coeff_y[0] +
-                                        SRC(sy, sx + 1) * coeff_x[2] * coeff_y[1] + SRC(sy + 1, sx + 1) * coeff_x[2] * coeff_y[2] +
-                                        SRC(sy + 2, sx + 1) * coeff_x[2] * coeff_y[3] + SRC(sy - 1, sx + 2) * coeff_x[3] * coeff_y[0] +
-                                        SRC(sy, sx + 2) * coeff_x[3] * coeff_y[1] + SRC(sy + 1, sx + 2) * coeff_x[3] * coeff_y[2] +
-                                        SRC(sy + 2, sx + 2) * coeff_x[3] * coeff_y[3];
-            }
-        }
-    }
-    return ppl::common::RC_SUCCESS;
+    return resize2d_ndarray_separable_common<T, 4>(
+        src_shape, dst_shape, src, x_idx.data(), x_coeff.data(), y_idx.data(), y_coeff.data(), vertical_func, dst);
 }
 
 }}}; // namespace ppl::kernel::riscv
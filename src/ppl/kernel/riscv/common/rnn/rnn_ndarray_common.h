@@ -0,0 +1,94 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_PPL_KERNEL_RISCV_COMMON_RNN_RNN_NDARRAY_COMMON_H_
+#define __ST_PPL_KERNEL_RISCV_COMMON_RNN_RNN_NDARRAY_COMMON_H_
+
+#include <cstring>
+
+#include "ppl/kernel/riscv/common/internal_include.h"
+#include "ppl/kernel/riscv/common/rnn_common.h"
+#include "ppl/kernel/riscv/common/matmul/matmul_ndarray_common.h"
+
+namespace ppl { namespace kernel { namespace riscv {
+
+// Shared pieces of the lstm / gru ndarray kernels. Weights are [num_direction][gate_size][k] like onnx and
+// are packed per direction into the matmul_ndarray B layout (transB), so the input gemm over all timesteps
+// and the per step recurrent gemm both run on the fc ndarray kernels.
+
+inline int64_t rnn_ndarray_common_num_direction(const rnn_direction_t direction)
+{
+    return direction == rnn_direction::BIDIRECTIONAL ? 2 : 1;
+}
+
+inline matmul_ndarray_param rnn_ndarray_common_gemm_param(const int64_t m, const int64_t n, const int64_t k)
+{
+    matmul_ndarray_param param;
+    param.m       = m;
+    param.n       = n;
+    param.k       = k;
+    param.batch   = 1;
+    param.b_batch = 1;
+    param.a_batch_idx.assign(1, 0);
+    param.b_batch_idx.assign(1, 0);
+    return param;
+}
+
+// bytes of one packed direction, always a multiple of 64
+template <typename T, int64_t atom_k, int64_t flt_atom_n>
+inline uint64_t rnn_ndarray_common_packed_weight_size(const int64_t n, const int64_t k)
+{
+    return matmul_ndarray_common_packed_b_size<T, atom_k, flt_atom_n>(rnn_ndarray_common_gemm_param(0, n, k));
+}
+
+template <typename T, int64_t atom_k, int64_t flt_atom_n>
+inline void rnn_ndarray_common_pack_weight(const T* weight, const int64_t n, const int64_t k, T* packed_weight)
+{
+    matmul_ndarray_common_pack_b<T, atom_k, flt_atom_n>(weight, rnn_ndarray_common_gemm_param(0, n, k), true, packed_weight);
+}
+
+template <typename T, int64_t atom_k, int64_t flt_atom_n>
+inline uint64_t rnn_ndarray_common_gemm_buffer_size(const int64_t n)
+{
+    return matmul_ndarray_common_temp_buffer_size<T, atom_k, flt_atom_n>(rnn_ndarray_common_gemm_param(0, n, 0), matmul_ndarray_common_tunning_param(), true);
+}
+
+template <typename T>
+inline void rnn_ndarray_common_pad_bias(const T* bias, const int64_t n, const int64_t pad_n, T* padded_bias)
+{
+    memcpy(padded_bias, bias, n * sizeof(T));
+    memset(padded_bias + n, 0, (pad_n - n) * sizeof(T));
+}
+
+template <typename T, int64_t atom_n, int64_t atom_k, int64_t flt_atom_n>
+inline void rnn_ndarray_common_gemm(
+    const T* A,
+    const T* packed_B,
+    const T* padded_bias,
+    const matmul_ndarray_param& param,
+    void* temp_buffer,
+    const fc_common_select_gemm_kernel_func_t<T> first_tile_select_kernel_func,
+    const fc_common_select_gemm_kernel_func_t<T> tile_select_kernel_func,
+    T* Y)
+{
+    matmul_ndarray_common_execute<T, atom_n, atom_k, flt_atom_n>(
+        A, packed_B, padded_bias, param, matmul_ndarray_common_tunning_param(), false, temp_buffer, first_tile_select_kernel_func, tile_select_kernel_func, Y);
+}
+
+}}}; // namespace ppl::kernel::riscv
+
+#endif //  __ST_PPL_KERNEL_RISCV_COMMON_RNN_RNN_NDARRAY_COMMON_H_
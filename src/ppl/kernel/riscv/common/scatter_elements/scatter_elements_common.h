@@ -0,0 +1,100 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_PPL_KERNEL_RISCV_COMMON_SCATTER_ELEMENTS_SCATTER_ELEMENTS_COMMON_H_
+#define __ST_PPL_KERNEL_RISCV_COMMON_SCATTER_ELEMENTS_SCATTER_ELEMENTS_COMMON_H_
+
+#include "ppl/kernel/riscv/common/scatter_nd/scatter_nd_common.h"
+
+namespace ppl { namespace kernel { namespace riscv {
+
+template <typename eT>
+ppl::common::RetCode scatter_elements_ndarray_common(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *indices_shape,
+    const eT *src,
+    const int64_t *indices,
+    const eT *updates,
+    const int64_t axis,
+    const int32_t reduction,
+    eT *dst)
+{
+    const int64_t dim_count = src_shape->GetDimCount();
+    if (dim_count > PPL_RISCV_TENSOR_MAX_DIMS()) {
+        return ppl::common::RC_UNSUPPORTED;
+    }
+    if (src != dst) {
+        memory_copy(src, src_shape->CalcBytesExcludingPadding(), dst);
+    }
+    const int64_t scatter_axis = axis < 0 ? axis + dim_count : axis;
+
+    int64_t src_strides[PPL_RISCV_TENSOR_MAX_DIMS()];
+    src_strides[dim_count - 1] = 1;
+    for (int64_t i = dim_count - 2; i >= 0; --i) {
+        src_strides[i] = src_strides[i + 1] * src_shape->GetDim(i + 1);
+    }
+
+    const int64_t src_scatter_dims     = src_shape->GetDim(scatter_axis);
+    const int64_t indices_scatter_dims = indices_shape->GetDim(scatter_axis);
+    int64_t indices_outer_dims         = 1;
+    int64_t indices_inner_dims         = 1;
+    for (int64_t i = 0; i < scatter_axis; ++i) {
+        indices_outer_dims *= indices_shape->GetDim(i);
+    }
+    for (int64_t i = scatter_axis + 1; i < dim_count; ++i) {
+        indices_inner_dims *= indices_shape->GetDim(i);
+    }
+
+    // dst offset of every inner position of indices, the identity when their inner dims match src
+    std::vector<int64_t> inner_offset(indices_inner_dims);
+    for (int64_t j = 0; j < indices_inner_dims; ++j) {
+        int64_t rem    = j;
+        int64_t offset = 0;
+        for (int64_t i = dim_count - 1; i > scatter_axis; --i) {
+            offset += (rem % indices_shape->GetDim(i)) * src_strides[i];
+            rem /= indices_shape->GetDim(i);
+        }
+        inner_offset[j] = offset;
+    }
+
+    const int64_t num_updates = indices_outer_dims * indices_scatter_dims * indices_inner_dims;
+    std::vector<int64_t> offsets(num_updates);
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t r = 0; r < indices_outer_dims * indices_scatter_dims; ++r) {
+        int64_t rem       = r / indices_scatter_dims;
+        int64_t dst_outer = 0;
+        for (int64_t i = scatter_axis - 1; i >= 0; --i) {
+            dst_outer += (rem % indices_shape->GetDim(i)) * src_strides[i];
+            rem /= indices_shape->GetDim(i);
+        }
+        const int64_t *indices_l = indices + r * indices_inner_dims;
+        int64_t *offsets_l       = offsets.data() + r * indices_inner_dims;
+        for (int64_t j = 0; j < indices_inner_dims; ++j) {
+            const int64_t index = indices_l[j] < 0 ? indices_l[j] + src_scatter_dims : indices_l[j];
+            offsets_l[j]        = dst_outer + index * src_strides[scatter_axis] + inner_offset[j];
+        }
+    }
+
+    // every update is a single element, so no slice kernel is needed
+    scatter_common_apply<eT>(offsets.data(), updates, 1, num_updates, reduction, nullptr, dst);
+
+    return ppl::common::RC_SUCCESS;
+}
+
+}}}; // namespace ppl::kernel::riscv
+
+#endif // __ST_PPL_KERNEL_RISCV_COMMON_SCATTER_ELEMENTS_SCATTER_ELEMENTS_COMMON_H_
@@ -15,11 +15,111 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#ifndef __ST_PPL_KERNEL_RISCV_COMMON_SCATTER_ND_SCATTER_ND_COMMON_H_
+#define __ST_PPL_KERNEL_RISCV_COMMON_SCATTER_ND_SCATTER_ND_COMMON_H_
+
+#include <algorithm>
+#include <vector>
+
 #include "ppl/kernel/riscv/common/internal_include.h"
-#include <string.h>
+#include "ppl/kernel/riscv/common/memory.h"
+#include "ppl/kernel/riscv/common/options.h"
 
 namespace ppl { namespace kernel { namespace riscv {
 
+// combines one slice of updates into dst with the given reduction
+template <typename eT>
+using scatter_common_apply_func_t = void (*)(const eT *updates, const int64_t len, const int32_t reduction, eT *dst);
+
+template <typename eT>
+inline eT scatter_common_reduce(const eT d, const eT u, const int32_t reduction)
+{
+    switch (reduction) {
+        case SCATTER_REDUCTION_ADD:
+            return d + u;
+        case SCATTER_REDUCTION_MUL:
+            return d * u;
+        case SCATTER_REDUCTION_MAX:
+            return d > u ? d : u;
+        case SCATTER_REDUCTION_MIN:
+            return d < u ? d : u;
+        default:
+            return u;
+    }
+}
+
+template <typename eT>
+inline void scatter_common_apply_slice(
+    const eT *updates,
+    const int64_t inner_dim,
+    const int32_t reduction,
+    scatter_common_apply_func_t<eT> apply_func,
+    eT *dst)
+{
+    if (inner_dim == 1) {
+        dst[0] = scatter_common_reduce<eT>(dst[0], updates[0], reduction);
+    } else {
+        apply_func(updates, inner_dim, reduction, dst);
+    }
+}
+
+// applies the k-th slice of updates at dst + offsets[k], slices either coincide or are disjoint.
+// coinciding slices are applied in index order, so that reductions are serialized and plain
+// scatter keeps the last update
+template <typename eT>
+void scatter_common_apply(
+    const int64_t *offsets,
+    const eT *updates,
+    const int64_t inner_dim,
+    const int64_t num_updates,
+    const int32_t reduction,
+    scatter_common_apply_func_t<eT> apply_func,
+    eT *dst)
+{
+    bool unique = true;
+    for (int64_t k = 1; k < num_updates; ++k) {
+        if (offsets[k] <= offsets[k - 1]) {
+            unique = false;
+            break;
+        }
+    }
+
+    if (unique) {
+        // strictly increasing offsets cannot collide
+        PRAGMA_OMP_PARALLEL_FOR()
+        for (int64_t k = 0; k < num_updates; ++k) {
+            scatter_common_apply_slice<eT>(updates + k * inner_dim, inner_dim, reduction, apply_func, dst + offsets[k]);
+        }
+        return;
+    }
+
+    // the stable sort groups coinciding slices and keeps each group in index order
+    std::vector<int64_t> order(num_updates);
+    for (int64_t k = 0; k < num_updates; ++k) {
+        order[k] = k;
+    }
+    std::stable_sort(order.begin(), order.end(), [offsets](const int64_t &k0, const int64_t &k1) {
+        return offsets[k0] < offsets[k1];
+    });
+    std::vector<int64_t> group_start;
+    for (int64_t i = 0; i < num_updates; ++i) {
+        if (i == 0 || offsets[order[i]] != offsets[order[i - 1]]) {
+            group_start.push_back(i);
+        }
+    }
+    group_start.push_back(num_updates);
+
+    const int64_t num_groups = group_start.size() - 1;
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t g = 0; g < num_groups; ++g) {
+        const int64_t first = reduction == SCATTER_REDUCTION_NONE ? group_start[g + 1] - 1 : group_start[g];
+        for (int64_t i = first; i < group_start[g + 1]; ++i) {
+            const int64_t k = order[i];
+            scatter_common_apply_slice<eT>(updates + k * inner_dim, inner_dim, reduction, apply_func, dst + offsets[k]);
+        }
+    }
+}
+
 template <typename eT>
 ppl::common::RetCode scatter_nd_ndarray_common(
     const eT *src,
@@ -30,44 +130,30 @@ ppl::common::RetCode scatter_nd_ndarray_common(
     const int64_t inner_dim,
     const int64_t num_indices,
     const int64_t indices_dim,
+    const int32_t reduction,
+    scatter_common_apply_func_t<eT> apply_func,
     eT *dst)
 {
-    const int64_t unroll_len  = 64;
-    const int64_t unroll_body = round(src_length, unroll_len);
-    const int64_t unroll_tail = src_length - unroll_len;
-
-    PRAGMA_OMP_PARALLEL_FOR()
-    for (int64_t i = 0; i < unroll_body; i += unroll_len) {
-        memcpy(dst + i, src + i, unroll_len * sizeof(eT));
-    }
-    if (unroll_tail) {
-        memcpy(dst + unroll_body, src + unroll_body, (src_length - unroll_body) * sizeof(eT));
+    if (src != dst) {
+        memory_copy(src, src_length * sizeof(eT), dst);
     }
 
-    if (inner_dim > 1) {
-        PRAGMA_OMP_PARALLEL_FOR()
-        for (int64_t k = 0; k < num_indices; ++k) {
-            int64_t offset           = 0;
-            const int64_t *l_indices = indices + k * indices_dim;
-            const eT *l_updates      = updates + k * inner_dim;
-            for (int64_t i = 0; i < indices_dim; ++i) {
-                offset += l_indices[i] * strides[i];
-            }
-            memcpy(dst + offset, l_updates, inner_dim * sizeof(eT));
-        }
-    } else {
-        PRAGMA_OMP_PARALLEL_FOR()
-        for (int64_t k = 0; k < num_indices; ++k) {
-            int64_t offset           = 0;
-            const int64_t *l_indices = indices + k * indices_dim;
-            for (int64_t i = 0; i < indices_dim; ++i) {
-                offset += l_indices[i] * strides[i];
-            }
-            dst[offset] = updates[k];
+    std::vector<int64_t> offsets(num_indices);
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t k = 0; k < num_indices; ++k) {
+        int64_t offset           = 0;
+        const int64_t *l_indices = indices + k * indices_dim;
+        for (int64_t i = 0; i < indices_dim; ++i) {
+            offset += l_indices[i] * strides[i];
         }
+        offsets[k] = offset;
     }
 
+    scatter_common_apply<eT>(offsets.data(), updates, inner_dim, num_indices, reduction, apply_func, dst);
+
     return ppl::common::RC_SUCCESS;
 }
 
-}}} // namespace ppl::kernel::riscv
+}}}; // namespace ppl::kernel::riscv
+
+#endif // __ST_PPL_KERNEL_RISCV_COMMON_SCATTER_ND_SCATTER_ND_COMMON_H_
@@ -20,12 +20,40 @@
 #define __ST_PPL_KERNEL_RISCV_COMMON_SPLIT_SPLIT_COMMON_H_
 
 #include <vector>
-#include <cstring>
 
 #include "ppl/kernel/riscv/common/internal_include.h"
+#include "ppl/kernel/riscv/common/memory.h"
+#include "ppl/kernel/riscv/common/nbcx_lane.h"
 
 namespace ppl { namespace kernel { namespace riscv {
 
+// copies run_len[n] elements from src_offset[n] of every src row to the n-th output
+template <typename eT>
+void split_common_copy_runs(
+    const eT* src,
+    const int64_t* run_len,
+    const int64_t* src_offset,
+    const int64_t src_row_len,
+    const int64_t outer_dims,
+    const int32_t num_dst,
+    eT** dst_list)
+{
+    if (outer_dims == 1 && num_dst < PPL_OMP_MAX_THREADS()) {
+        // a few long runs, memory_copy threads each of them
+        for (int32_t n = 0; n < num_dst; n++) {
+            memory_copy(src + src_offset[n], run_len[n] * sizeof(eT), dst_list[n]);
+        }
+        return;
+    }
+
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t t = 0; t < outer_dims * num_dst; t++) {
+        const int64_t i = t / num_dst;
+        const int64_t n = t % num_dst;
+        memory_copy(src + i * src_row_len + src_offset[n], run_len[n] * sizeof(eT), dst_list[n] + i * run_len[n]);
+    }
+}
+
 template <typename eT>
 ppl::common::RetCode split_ndarray(
     const ppl::common::TensorShape* src_shape,
@@ -48,23 +76,19 @@ ppl::common::RetCode split_ndarray(
         inner_dims *= src_shape->GetDim(i);
     }
 
-    std::vector<int64_t> src_offset;
-    src_offset.resize(num_dst);
+    // everything behind the split axis is one contiguous run per outer row
+    std::vector<int64_t> run_len(num_dst);
+    std::vector<int64_t> src_offset(num_dst);
     src_offset[0] = 0;
     for (int32_t i = 1; i < num_dst; i++) {
-        src_offset[i] = src_offset[i - 1] + dst_shape_list[i - 1]->GetDim(fixed_axis);
+        src_offset[i] = src_offset[i - 1] + dst_shape_list[i - 1]->GetDim(fixed_axis) * inner_dims;
     }
-
-    for (int32_t i = 0; i < outer_dims; i++) {
-        for (int32_t n = 0; n < num_dst; n++) {
-            const eT* p_src = src + i * src_split_dim * inner_dims + src_offset[n] * inner_dims;
-            eT* p_dst       = dst_list[n] + i * dst_shape_list[n]->GetDim(fixed_axis) * inner_dims;
-
-            const size_t size = dst_shape_list[n]->GetDim(fixed_axis) * inner_dims * sizeof(eT);
-            memcpy(p_dst, p_src, size);
-        }
+    for (int32_t n = 0; n < num_dst; n++) {
+        run_len[n] = dst_shape_list[n]->GetDim(fixed_axis) * inner_dims;
     }
 
+    split_common_copy_runs<eT>(src, run_len.data(), src_offset.data(), src_split_dim * inner_dims, outer_dims, num_dst, dst_list);
+
     return ppl::common::RC_SUCCESS;
 }
 
@@ -98,48 +122,42 @@ ppl::common::RetCode split_nxcx_interleave_channels(
 
     const int64_t src_channels = src_shape->GetDim(c_dim_idx);
     const int64_t padded_ic    = round_up(src_channels, c_blk);
+    const int64_t num_blks     = div_up(inner_dims, NBCX_INTERLEAVE_INNER_BLK());
 
-    const int64_t start_inner_dims = 0;
-    const int64_t end_inner_dims   = inner_dims;
-
-    for (int64_t i = 0; i < outer_dims; i++) {
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t t = 0; t < outer_dims * num_blks; t++) {
+        const int64_t i                = t / num_blks;
+        const int64_t start_inner_dims = (t % num_blks) * NBCX_INTERLEAVE_INNER_BLK();
+        const int64_t len_inner_dims   = min(inner_dims - start_inner_dims, (int64_t)NBCX_INTERLEAVE_INNER_BLK());
         for (int32_t n = 0; n < num_dst; n++) {
             const int32_t dst_channels = dst_shape_list[n]->GetDim(c_dim_idx);
             const int32_t padded_oc    = round_up(dst_channels, c_blk);
             for (int32_t oc = 0; oc < padded_oc; oc += c_blk) {
                 const int32_t ic = src_offset[n] + oc;
-                const eT* p_src  = src + i * padded_ic * inner_dims + round(ic, c_blk) * inner_dims;
-                eT* p_dst        = dst_list[n] + i * padded_oc * inner_dims + oc * inner_dims;
+                const eT* p_src  = src + i * padded_ic * inner_dims + round(ic, c_blk) * inner_dims + start_inner_dims * c_blk;
+                eT* p_dst        = dst_list[n] + i * padded_oc * inner_dims + oc * inner_dims + start_inner_dims * c_blk;
                 if (ic % c_blk == 0) { // no interleave on this xc
-                    memcpy(p_dst + start_inner_dims * c_blk, p_src + start_inner_dims * c_blk, (end_inner_dims - start_inner_dims) * c_blk * sizeof(eT));
+                    memory_copy(p_src, len_inner_dims * c_blk * sizeof(eT), p_dst);
                 } else { // has interleave on this xc
                     const int32_t c_offset  = c_blk - (ic % c_blk);
                     const int32_t c_end     = min(dst_channels - oc, (int32_t)c_blk);
                     const eT* p_src_next_xc = p_src + c_blk * inner_dims;
-
-                    if (oc + c_blk == padded_oc && dst_channels < padded_oc) { // last xc need to pad 0
-                        for (int64_t id = start_inner_dims; id < end_inner_dims; id++) {
-                            // interleave copy
-                            for (int32_t c = 0; c < c_offset; c++) {
-                                p_dst[id * c_blk + c] = p_src[id * c_blk + c_blk - c_offset + c];
-                            }
-                            for (int32_t c = c_offset; c < c_end; c++) {
-                                p_dst[id * c_blk + c] = p_src_next_xc[id * c_blk + c - c_offset];
-                            }
-                        }
-                    } else {
-                        for (int64_t id = start_inner_dims; id < end_inner_dims; id++) {
-                            // interleave copy
-                            for (int32_t c = 0; c < c_offset; c++) {
-                                p_dst[id * c_blk + c] = p_src[id * c_blk + c_blk - c_offset + c];
-                            }
-                            for (int32_t c = c_offset; c < c_end; c++) {
-                                p_dst[id * c_blk + c] = p_src_next_xc[id * c_blk + c - c_offset];
-                            }
-                        }
+                    for (int32_t c = 0; c < min(c_offset, c_end); c++) {
+                        nbcx_copy_lane<eT, c_blk>(p_src + c_blk - c_offset + c, len_inner_dims, p_dst + c);
+                    }
+                    for (int32_t c = c_offset; c < c_end; c++) {
+                        nbcx_copy_lane<eT, c_blk>(p_src_next_xc + c - c_offset, len_inner_dims, p_dst + c);
                     }
                 }
             }
+            // lanes past dst_channels hold the next output's channels or stale data, clear the padding
+            const int32_t c_tail = dst_channels % c_blk;
+            if (c_tail != 0) {
+                eT* p_dst_last = dst_list[n] + i * padded_oc * inner_dims + (padded_oc - c_blk) * inner_dims + start_inner_dims * c_blk;
+                for (int32_t c = c_tail; c < c_blk; c++) {
+                    nbcx_zero_lane<eT, c_blk>(len_inner_dims, p_dst_last + c);
+                }
+            }
         }
     }
 
@@ -191,43 +209,18 @@ ppl::common::RetCode split_nxcx(
         }
     }
 
-    std::vector<int64_t> src_offset;
-    src_offset.resize(num_dst);
-    src_offset[0]         = 0;
-    int64_t src_split_dim = 0;
-    if (fixed_axis == c_dim_idx) {
-        for (int32_t i = 1; i < num_dst; i++) {
-            src_offset[i] = src_offset[i - 1] + div_up(dst_shape_list[i - 1]->GetDim(fixed_axis), c_blk);
-        }
-        src_split_dim = div_up(src_shape->GetDim(fixed_axis), c_blk);
-    } else {
-        for (int32_t i = 1; i < num_dst; i++) {
-            src_offset[i] = src_offset[i - 1] + dst_shape_list[i - 1]->GetDim(fixed_axis);
-        }
-        src_split_dim = src_shape->GetDim(fixed_axis);
+    // everything behind the split axis is one contiguous run per outer row
+    std::vector<int64_t> run_len(num_dst);
+    std::vector<int64_t> src_offset(num_dst);
+    int64_t src_row_len = 0;
+    for (int32_t n = 0; n < num_dst; n++) {
+        const int64_t split_dim = fixed_axis == c_dim_idx ? div_up(dst_shape_list[n]->GetDim(fixed_axis), c_blk) : dst_shape_list[n]->GetDim(fixed_axis);
+        run_len[n]              = split_dim * inner_dims;
+        src_offset[n]           = src_row_len;
+        src_row_len += run_len[n];
     }
 
-    if (fixed_axis == c_dim_idx) {
-        for (int32_t i = 0; i < outer_dims; i++) {
-            for (int32_t n = 0; n < num_dst; n++) {
-                const eT* p_src = src + i * src_split_dim * inner_dims + src_offset[n] * inner_dims;
-                eT* p_dst       = dst_list[n] + i * div_up(dst_shape_list[n]->GetDim(fixed_axis), c_blk) * inner_dims;
-
-                const size_t size = div_up(dst_shape_list[n]->GetDim(fixed_axis), c_blk) * inner_dims * sizeof(eT);
-                memcpy(p_dst, p_src, size);
-            }
-        }
-    } else {
-        for (int32_t i = 0; i < outer_dims; i++) {
-            for (int32_t n = 0; n < num_dst; n++) {
-                const eT* p_src = src + i * src_split_dim * inner_dims + src_offset[n] * inner_dims;
-                eT* p_dst       = dst_list[n] + i * dst_shape_list[n]->GetDim(fixed_axis) * inner_dims;
-
-                const size_t size = dst_shape_list[n]->GetDim(fixed_axis) * inner_dims * sizeof(eT);
-                memcpy(p_dst, p_src, size);
-            }
-        }
-    }
+    split_common_copy_runs<eT>(src, run_len.data(), src_offset.data(), src_row_len, outer_dims, num_dst, dst_list);
 
     return ppl::common::RC_SUCCESS;
 }
@@ -44,14 +44,51 @@ struct element_t {
     }
 };
 
+// returns the offset of the first element in src[0, len) that beats thr, or len if there is none
+template <typename T>
+using topk_common_find_func_t = int64_t (*)(const T *src, const int64_t len, const T thr, const bool largest);
+
+#define TOPK_HEAP_MAX_K()         512
+#define TOPK_BUFFER_ALIGN_BYTES() 64
+
 template <typename T>
 uint64_t topk_ndarray_get_buffer_bytes(
     const ppl::common::TensorShape *src_shape,
     const int32_t axis)
 {
     const uint64_t axis_dim         = src_shape->GetDim(axis);
-    const uint64_t temp_buffer_size = axis_dim * sizeof(element_t<T, SMALLEST>);
-    return temp_buffer_size;
+    const uint64_t temp_buffer_size = round_up(axis_dim * sizeof(element_t<T, SMALLEST>), TOPK_BUFFER_ALIGN_BYTES());
+    return temp_buffer_size * PPL_OMP_MAX_THREADS();
+}
+
+// the heap top is the worst kept element, later elements only enter the heap if strictly better than it,
+// so the vectorized find skips every run that cannot change the result
+template <typename T, sort_order_t order>
+static void topk_common_heap_select(
+    const T *row,
+    const int64_t axis_dim,
+    const int64_t k,
+    topk_common_find_func_t<T> find_func,
+    element_t<T, order> *heap)
+{
+    for (int64_t i = 0; i < k; i++) {
+        heap[i].data = row[i];
+        heap[i].idx  = i;
+    }
+    std::make_heap(heap, heap + k);
+
+    int64_t i = k;
+    while (i < axis_dim) {
+        i += find_func(row + i, axis_dim - i, heap[0].data, order == LARRGEST);
+        if (i >= axis_dim) {
+            break;
+        }
+        std::pop_heap(heap, heap + k);
+        heap[k - 1].data = row[i];
+        heap[k - 1].idx  = i;
+        std::push_heap(heap, heap + k);
+        i++;
+    }
 }
 
 template <typename T, sort_order_t order, bool sorted>
@@ -62,6 +99,7 @@ ppl::common::RetCode topk_ndarray_kernel_common(
     const T *src,
     const int64_t k,
     const int32_t axis,
+    topk_common_find_func_t<T> find_func,
     void *temp_buffer,
     T *values,
     int64_t *indices)
@@ -78,14 +116,35 @@ ppl::common::RetCode topk_ndarray_kernel_common(
         inner_dim *= src_shape->GetDim(i);
     }
 
-    const uint64_t temp_buffer_size = axis_dim * sizeof(element_t<T, order>);
-
-    for (int64_t od = 0; od < outer_dim; od++) {
-        for (int64_t id = 0; id < inner_dim; id++) {
-            element_t<T, order> *l_temp = (element_t<T, order> *)temp_buffer;
-            const T *l_src              = src + od * axis_dim * inner_dim + id;
-            T *l_values                 = values + od * k * inner_dim + id;
-            int64_t *l_ind              = indices + od * k * inner_dim + id;
+    const uint64_t temp_buffer_size = round_up(axis_dim * sizeof(element_t<T, order>), TOPK_BUFFER_ALIGN_BYTES());
+    // small k keeps a size k heap, otherwise the row is partitioned with nth_element
+    const bool use_heap    = k > 0 && k <= TOPK_HEAP_MAX_K() && k * 4 <= axis_dim;
+    const int64_t num_rows = outer_dim * inner_dim;
+
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t r = 0; r < num_rows; r++) {
+        const int64_t od = r / inner_dim;
+        const int64_t id = r % inner_dim;
+
+        element_t<T, order> *l_temp = (element_t<T, order> *)((uint8_t *)temp_buffer + PPL_OMP_THREAD_ID() * temp_buffer_size);
+        const T *l_src              = src + od * axis_dim * inner_dim + id;
+        T *l_values                 = values + od * k * inner_dim + id;
+        int64_t *l_ind              = indices + od * k * inner_dim + id;
+        if (use_heap) {
+            // strided rows are gathered behind the heap, k * 4 <= axis_dim keeps both inside the buffer
+            const T *l_row = l_src;
+            if (inner_dim > 1) {
+                T *l_gather = (T *)(l_temp + k);
+                for (uint32_t i = 0; i < axis_dim; i++) {
+                    l_gather[i] = l_src[i * inner_dim];
+                }
+                l_row = l_gather;
+            }
+            topk_common_heap_select<T, order>(l_row, axis_dim, k, find_func, l_temp);
+            if (sorted) {
+                std::sort_heap(l_temp, l_temp + k);
+            }
+        } else {
             for (uint32_t i = 0; i < axis_dim; i++) {
                 l_temp[i].data = l_src[i * inner_dim];
                 l_temp[i].idx  = i;
@@ -94,10 +153,10 @@ ppl::common::RetCode topk_ndarray_kernel_common(
             if (sorted) {
                 std::sort(l_temp, l_temp + k, std::less<element_t<T, order>>());
             }
-            for (uint32_t i = 0; i < k; i++) {
-                l_values[i * inner_dim] = l_temp[i].data;
-                l_ind[i * inner_dim]    = l_temp[i].idx;
-            }
+        }
+        for (uint32_t i = 0; i < k; i++) {
+            l_values[i * inner_dim] = l_temp[i].data;
+            l_ind[i * inner_dim]    = l_temp[i].idx;
         }
     }
 
@@ -114,21 +173,22 @@ ppl::common::RetCode topk_ndarray_common(
     const int32_t axis,
     const int32_t largest,
     const int32_t sorted,
+    topk_common_find_func_t<T> find_func,
     void *temp_buffer,
     T *values,
     int64_t *indices)
 {
     if (sorted) {
         if (largest) {
-            return topk_ndarray_kernel_common<T, LARRGEST, true>(src_shape, value_shape, indices_shape, src, k, axis, temp_buffer, values, indices);
+            return topk_ndarray_kernel_common<T, LARRGEST, true>(src_shape, value_shape, indices_shape, src, k, axis, find_func, temp_buffer, values, indices);
         } else {
-            return topk_ndarray_kernel_common<T, SMALLEST, true>(src_shape, value_shape, indices_shape, src, k, axis, temp_buffer, values, indices);
+            return topk_ndarray_kernel_common<T, SMALLEST, true>(src_shape, value_shape, indices_shape, src, k, axis, find_func, temp_buffer, values, indices);
         }
     } else {
         if (largest) {
-            return topk_ndarray_kernel_common<T, LARRGEST, false>(src_shape, value_shape, indices_shape, src, k, axis, temp_buffer, values, indices);
+            return topk_ndarray_kernel_common<T, LARRGEST, false>(src_shape, value_shape, indices_shape, src, k, axis, find_func, temp_buffer, values, indices);
         } else {
-            return topk_ndarray_kernel_common<T, SMALLEST, false>(src_shape, value_shape, indices_shape, src, k, axis, temp_buffer, values, indices);
+            return topk_ndarray_kernel_common<T, SMALLEST, false>(src_shape, value_shape, indices_shape, src, k, axis, find_func, temp_buffer, values, indices);
         }
     }
 }
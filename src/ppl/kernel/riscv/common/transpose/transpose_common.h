@@ -24,141 +24,89 @@
 
 namespace ppl { namespace kernel { namespace riscv {
 
+// A tile func transposes a rows x cols tile, dst[c * dst_ld + r] = src[r * src_ld + c].
 template <typename T>
-ppl::common::RetCode transpose2d_ndarray(
+using transpose_common_tile_func_t = void (*)(const T* src, const int64_t src_ld, const int64_t rows, const int64_t cols, const int64_t dst_ld, T* dst);
+
+template <typename T>
+void transpose_common_tile_scalar(
     const T* src,
-    T* dst,
-    const ppl::common::TensorShape* src_shape)
+    const int64_t src_ld,
+    const int64_t rows,
+    const int64_t cols,
+    const int64_t dst_ld,
+    T* dst)
 {
-    const int32_t src_h = src_shape->GetDim(0);
-    const int32_t src_w = src_shape->GetDim(1);
-
-    for (int32_t i = 0; i < src_h; ++i) {
-        for (int32_t j = 0; j < src_w; ++j) {
-            dst[j * src_h + i] = src[i * src_w + j];
+    for (int64_t c = 0; c < cols; c++) {
+        for (int64_t r = 0; r < rows; r++) {
+            dst[c * dst_ld + r] = src[r * src_ld + c];
         }
     }
-    return ppl::common::RC_SUCCESS;
 }
 
-template <typename T>
-ppl::common::RetCode transpose3d_ndarray(
-    const T* src,
-    T* dst,
-
+// Drops size 1 dims and merges src dims that stay adjacent in dst. 2-D, NCHW <-> NHWC and last two axes
+// transposes all reduce to at most 3 dims. Returns the reduced dim count, 0 means a plain copy.
+inline int64_t transpose_common_coalesce(
+    const int64_t* src_dims,
     const int32_t* perm,
-    const ppl::common::TensorShape* src_shape)
+    const int64_t dim_count,
+    int64_t* out_dims,
+    int64_t* out_perm)
 {
-    const int32_t channels = src_shape->GetDim(0);
-    const int32_t src_h    = src_shape->GetDim(1);
-    const int32_t src_w    = src_shape->GetDim(2);
-    int64_t src_dims[3]    = {channels, src_h, src_w};
-
-    int32_t dst_channels = src_dims[perm[0]];
-    int32_t dst_src_h    = src_dims[perm[1]];
-    int32_t dst_src_w    = src_dims[perm[2]];
-
-    int64_t src_stride[3] = {int64_t(src_h) * src_w, src_w, 1};
-    int64_t dst_stride[3] = {int64_t(dst_src_h) * dst_src_w, dst_src_w, 1};
-    int64_t axis_stride[3];
-    for (int32_t i = 0; i < 3; ++i) {
-        axis_stride[perm[i]] = dst_stride[i];
-    }
-
-    for (int32_t c = 0; c < channels; ++c) {
-        int64_t channels_in_offset  = c * src_stride[0];
-        int64_t channels_out_offset = c * axis_stride[0];
-        for (int32_t h = 0; h < src_h; ++h) {
-            int64_t height_in_offset  = h * src_stride[1];
-            int64_t height_out_offset = h * axis_stride[1];
-            for (int32_t w = 0; w < src_w; ++w) {
-                dst[channels_out_offset + height_out_offset + w * axis_stride[2]] =
-                    src[channels_in_offset + height_in_offset + w * 1];
-            }
+    int64_t new_axis[PPL_RISCV_TENSOR_MAX_DIMS()];
+    int64_t num_dims = 0;
+    for (int64_t i = 0; i < dim_count; i++) {
+        new_axis[i] = src_dims[i] == 1 ? -1 : num_dims++;
+    }
+
+    int64_t squeezed_perm[PPL_RISCV_TENSOR_MAX_DIMS()];
+    int64_t num_perm = 0;
+    for (int64_t i = 0; i < dim_count; i++) {
+        const int64_t axis = perm[i] < 0 ? perm[i] + dim_count : perm[i];
+        if (new_axis[axis] >= 0) {
+            squeezed_perm[num_perm++] = new_axis[axis];
         }
     }
-    return ppl::common::RC_SUCCESS;
-}
 
-template <typename T>
-ppl::common::RetCode transpose4d_ndarray(
-    const T* src,
-    T* dst,
+    // group_of[a]: merged group of squeezed src axis a, groups start where dst breaks src adjacency
+    int64_t group_start[PPL_RISCV_TENSOR_MAX_DIMS()];
+    for (int64_t i = 0; i < num_perm; i++) {
+        group_start[squeezed_perm[i]] = i == 0 || squeezed_perm[i] != squeezed_perm[i - 1] + 1;
+    }
 
-    const int32_t* perm,
-    const ppl::common::TensorShape* src_shape)
-{
-    const int32_t batch    = src_shape->GetDim(0);
-    const int32_t channels = src_shape->GetDim(1);
-    const int32_t src_h    = src_shape->GetDim(2);
-    const int32_t src_w    = src_shape->GetDim(3);
-    int64_t src_dims[4]    = {batch, channels, src_h, src_w};
-
-    int32_t dst_batch    = src_dims[perm[0]];
-    int32_t dst_channels = src_dims[perm[1]];
-    int32_t dst_src_h    = src_dims[perm[2]];
-    int32_t dst_src_w    = src_dims[perm[3]];
-
-    int64_t src_stride[4] = {int64_t(channels) * src_h * src_w, int64_t(src_h) * src_w, src_w, 1};
-    int64_t dst_stride[4] = {int64_t(dst_channels) * dst_src_h * dst_src_w, int64_t(dst_src_h) * dst_src_w, dst_src_w, 1};
-    int64_t axis_stride[4];
-    for (int32_t i = 0; i < 4; ++i) {
-        axis_stride[perm[i]] = dst_stride[i];
-    }
-
-    for (int64_t n = 0; n < batch; ++n) {
-        int64_t batch_in_offset  = n * src_stride[0];
-        int64_t batch_out_offset = n * axis_stride[0];
-        for (int64_t c = 0; c < channels; ++c) {
-            int64_t channels_in_offset  = c * src_stride[1];
-            int64_t channels_out_offset = c * axis_stride[1];
-            for (int64_t h = 0; h < src_h; ++h) {
-                int64_t height_in_offset  = h * src_stride[2];
-                int64_t height_out_offset = h * axis_stride[2];
-                int64_t base_in_offset    = batch_in_offset + channels_in_offset + height_in_offset;
-                int64_t base_out_offset   = batch_out_offset + channels_out_offset + height_out_offset;
-                for (int64_t w = 0; w < src_w; ++w) {
-                    dst[base_out_offset + w * axis_stride[3]] = src[base_in_offset + w * 1];
-                }
-            }
+    int64_t group_of[PPL_RISCV_TENSOR_MAX_DIMS()];
+    int64_t num_group = 0;
+    for (int64_t a = 0, s = 0; a < dim_count; a++) {
+        if (new_axis[a] < 0) {
+            continue;
+        }
+        if (group_start[s]) {
+            out_dims[num_group++] = 1;
         }
+        group_of[s] = num_group - 1;
+        out_dims[num_group - 1] *= src_dims[a];
+        s++;
     }
-    return ppl::common::RC_SUCCESS;
+
+    int64_t num_out = 0;
+    for (int64_t i = 0; i < num_perm; i++) {
+        if (group_start[squeezed_perm[i]]) {
+            out_perm[num_out++] = group_of[squeezed_perm[i]];
+        }
+    }
+
+    return num_group <= 1 ? 0 : num_group;
 }
 
 template <typename T>
-void transpose_ndarray_recursive(
-    const int64_t* src_dims,
-    const int64_t* src_stride,
-    const int64_t* dst_stride,
-    const int32_t* perm,
-    const uint32_t dim_idx,
-    const uint32_t dim_count,
-    const int64_t base_in_offset,
-    const int64_t base_out_offset,
-
-    const T* src,
-    T* dst)
+void transpose_common_copy(const T* src, const int64_t length, T* dst)
 {
-    const int64_t length = src_dims[dim_idx];
-    if (dim_idx == dim_count - 1) {
-        for (int64_t i = 0; i < length; i++) {
-            dst[base_out_offset + i * dst_stride[perm[dim_idx]]] = src[base_in_offset + i];
-        }
-    } else {
-        for (int64_t i = 0; i < length; i++) {
-            transpose_ndarray_recursive<T>(
-                src_dims,
-                src_stride,
-                dst_stride,
-                perm,
-                dim_idx,
-                dim_count,
-                base_in_offset,
-                base_out_offset,
-                src,
-                dst);
-        }
+    const int64_t block_len = 16384;
+    const int64_t num_block = div_up(length, block_len);
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t b = 0; b < num_block; b++) {
+        const int64_t beg = b * block_len;
+        memcpy(dst + beg, src + beg, min(length - beg, block_len) * sizeof(T));
     }
 }
 
@@ -169,44 +117,98 @@ ppl::common::RetCode transpose_ndarray(
 
     const int32_t* perm,
     const ppl::common::TensorShape* src_shape,
-    const ppl::common::TensorShape* dst_shape)
+    const ppl::common::TensorShape* dst_shape,
+    const transpose_common_tile_func_t<T> tile_func)
 {
-    const uint32_t dim_count = src_shape->GetDimCount();
-
+    const int64_t dim_count = src_shape->GetDimCount();
     if (dim_count > PPL_RISCV_TENSOR_MAX_DIMS()) {
         return ppl::common::RC_UNSUPPORTED;
     }
-    if (dim_count <= 1) {
+    if (src_shape->CalcElementsExcludingPadding() == 0) {
         return ppl::common::RC_SUCCESS;
     }
-    if (dim_count <= 2) {
-        return transpose2d_ndarray(src, dst, src_shape);
-    }
-    if (dim_count <= 3) {
-        return transpose3d_ndarray(src, dst, perm, src_shape);
-    }
-    if (dim_count <= 4) {
-        return transpose4d_ndarray(src, dst, perm, src_shape);
+
+    int64_t dims[PPL_RISCV_TENSOR_MAX_DIMS()];
+    int64_t axes[PPL_RISCV_TENSOR_MAX_DIMS()];
+    const int64_t num_dims = transpose_common_coalesce(src_shape->GetDims(), perm, dim_count, dims, axes);
+    if (num_dims == 0) {
+        transpose_common_copy<T>(src, src_shape->CalcElementsIncludingPadding(), dst);
+        return ppl::common::RC_SUCCESS;
     }
 
-    auto src_dims                                   = src_shape->GetDims();
-    auto dst_dims                                   = dst_shape->GetDims();
-    int64_t src_stride[PPL_RISCV_TENSOR_MAX_DIMS()] = {0};
-    int64_t dst_stride[PPL_RISCV_TENSOR_MAX_DIMS()] = {0};
-    src_stride[dim_count - 1]                       = 1;
-    dst_stride[dim_count - 1]                       = 1;
-    for (int32_t i = (int32_t)dim_count - 2; i >= 0; i--) {
-        src_stride[i] = src_stride[i + 1] * src_dims[i + 1];
-        dst_stride[i] = dst_stride[i + 1] * dst_dims[i + 1];
+    int64_t src_stride[PPL_RISCV_TENSOR_MAX_DIMS()];
+    int64_t dst_stride[PPL_RISCV_TENSOR_MAX_DIMS()]; // dst stride of each src axis
+    src_stride[num_dims - 1] = 1;
+    for (int64_t i = num_dims - 2; i >= 0; i--) {
+        src_stride[i] = src_stride[i + 1] * dims[i + 1];
+    }
+    int64_t stride = 1;
+    for (int64_t i = num_dims - 1; i >= 0; i--) {
+        dst_stride[axes[i]] = stride;
+        stride *= dims[axes[i]];
+    }
+
+    if (axes[num_dims - 1] == num_dims - 1) {
+        // innermost axis is kept, move whole rows in dst order
+        const int64_t inner    = dims[num_dims - 1];
+        const int64_t num_rows = stride / inner;
+        PRAGMA_OMP_PARALLEL_FOR()
+        for (int64_t row = 0; row < num_rows; row++) {
+            int64_t o          = row;
+            int64_t src_offset = 0;
+            for (int64_t i = num_dims - 2; i >= 0; i--) {
+                const int64_t idx = o % dims[axes[i]];
+                o /= dims[axes[i]];
+                src_offset += idx * src_stride[axes[i]];
+            }
+            memcpy(dst + row * inner, src + src_offset, inner * sizeof(T));
+        }
+        return ppl::common::RC_SUCCESS;
     }
 
-    int32_t revert_perm[PPL_RISCV_TENSOR_MAX_DIMS()] = {0};
-    for (int64_t i = 0; i < dim_count; i++) {
-        const int32_t perm_val = perm[i] < 0 ? perm[i] + dim_count : perm[i];
-        revert_perm[perm_val]  = i;
+    // otherwise the transpose is a batch of 2-D planes: rows walk the src axis that is contiguous in dst,
+    // cols walk the contiguous src axis
+    const int64_t row_axis = axes[num_dims - 1];
+    const int64_t col_axis = num_dims - 1;
+    const int64_t rows     = dims[row_axis];
+    const int64_t cols     = dims[col_axis];
+    const int64_t src_ld   = src_stride[row_axis];
+    const int64_t dst_ld   = dst_stride[col_axis];
+
+    int64_t outer_axes[PPL_RISCV_TENSOR_MAX_DIMS()];
+    int64_t num_outer = 0;
+    int64_t outer     = 1;
+    for (int64_t i = 0; i < num_dims; i++) {
+        if (i != row_axis && i != col_axis) {
+            outer_axes[num_outer++] = i;
+            outer *= dims[i];
+        }
     }
 
-    transpose_ndarray_recursive(src_dims, src_stride, dst_stride, revert_perm, 0, dim_count, 0, 0, src, dst);
+    // 64 x 64 tiles keep the strided side of the plane inside L1
+    const int64_t tile      = 64;
+    const int64_t num_row_t = div_up(rows, tile);
+    const int64_t num_col_t = div_up(cols, tile);
+    const int64_t num_task  = outer * num_row_t * num_col_t;
+
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t task = 0; task < num_task; task++) {
+        const int64_t r_beg = task / num_col_t % num_row_t * tile;
+        const int64_t c_beg = task % num_col_t * tile;
+
+        int64_t o          = task / (num_col_t * num_row_t);
+        int64_t src_offset = r_beg * src_ld + c_beg;
+        int64_t dst_offset = c_beg * dst_ld + r_beg;
+        for (int64_t i = num_outer - 1; i >= 0; i--) {
+            const int64_t axis = outer_axes[i];
+            const int64_t idx  = o % dims[axis];
+            o /= dims[axis];
+            src_offset += idx * src_stride[axis];
+            dst_offset += idx * dst_stride[axis];
+        }
+
+        tile_func(src + src_offset, src_ld, min(rows - r_beg, tile), min(cols - c_beg, tile), dst_ld, dst + dst_offset);
+    }
 
     return ppl::common::RC_SUCCESS;
 }
@@ -234,13 +236,14 @@ ppl::common::RetCode transpose_ndarray_continous2d(
         inner_dims *= src_shape->GetDim(i);
     }
 
-    for (int64_t od = 0; od < outer_dims; od++) {
-        for (int64_t d0 = 0; d0 < dim0; d0++) {
-            for (int64_t d1 = 0; d1 < dim1; d1++) {
-                const T* src_ = src + od * dim0 * dim1 * inner_dims + d0 * dim1 * inner_dims + d1 * inner_dims;
-                T* dst_       = dst + od * dim1 * dim0 * inner_dims + d1 * dim0 * inner_dims + d0 * inner_dims;
-                memcpy(dst_, src_, inner_dims * sizeof(T));
-            }
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t od_d0 = 0; od_d0 < outer_dims * dim0; od_d0++) {
+        const int64_t od = od_d0 / dim0;
+        const int64_t d0 = od_d0 % dim0;
+        for (int64_t d1 = 0; d1 < dim1; d1++) {
+            const T* src_ = src + od * dim0 * dim1 * inner_dims + d0 * dim1 * inner_dims + d1 * inner_dims;
+            T* dst_       = dst + od * dim1 * dim0 * inner_dims + d1 * dim0 * inner_dims + d0 * inner_dims;
+            memcpy(dst_, src_, inner_dims * sizeof(T));
         }
     }
 
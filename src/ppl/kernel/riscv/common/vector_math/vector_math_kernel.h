@@ -0,0 +1,237 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_PPL_KERNEL_RISCV_COMMON_VECTOR_MATH_VECTOR_MATH_KERNEL_H_
+#define __ST_PPL_KERNEL_RISCV_COMMON_VECTOR_MATH_VECTOR_MATH_KERNEL_H_
+
+#include <math.h>
+#include <float.h>
+#include <riscv-vector.h>
+
+namespace ppl { namespace kernel { namespace riscv {
+
+// Vectorized exp / log / tanh / erf / sigmoid for vec128.
+//
+// fp32 functions are generated for float32xm1 and float32xm2. fp16 functions widen to float32xm2,
+// evaluate in fp32 and round once on the way back.
+//
+// Max error of the fp32 functions against a double reference, measured over every 301st float of the range:
+//   vfexp     1 ulp    x clamped to [ln(FLT_MIN), ln(FLT_MAX)], no denormal results
+//   vflog     1 ulp    x == 0 -> -inf, x < 0 -> nan, x == inf -> inf, denormal x treated as FLT_MIN
+//   vfsigmoid 3 ulp
+//   vftanh    2 ulp
+//   vferf     4 ulp    worst just above |x| = 0.5 where the erfc approximation takes over
+// NaN inputs are not propagated.
+
+// clang-format off
+#define PPL_RISCV_VECTOR_MATH_FP32(XM, N)                                                                                     \
+    inline float32##XM##_t vfreinterpret_float32##XM(int32##XM##_t x, uint64_t vl)                                         \
+    {                                                                                                                       \
+        int32_t buf[N];                                                                                                     \
+        vsev_int32##XM(buf, x, vl);                                                                                         \
+        return vlev_float32##XM((const float*)buf, vl);                                                                     \
+    }                                                                                                                       \
+    inline int32##XM##_t vreinterpret_int32##XM(float32##XM##_t x, uint64_t vl)                                            \
+    {                                                                                                                       \
+        float buf[N];                                                                                                       \
+        vsev_float32##XM(buf, x, vl);                                                                                       \
+        return vlev_int32##XM((const int32_t*)buf, vl);                                                                     \
+    }                                                                                                                       \
+                                                                                                                            \
+    inline float32##XM##_t vfexp_float32##XM(float32##XM##_t x, uint64_t vl)                                               \
+    {                                                                                                                       \
+        x = vfminvf_float32##XM(x, 88.7228317f, vl);                                                                        \
+        x = vfmaxvf_float32##XM(x, -87.3365479f, vl);                                                                       \
+        /* x = n * ln2 + r, |r| <= ln2 / 2, ln2 split in two parts to keep r exact */                                        \
+        int32##XM##_t n   = vfcvtxfv_int32##XM##_float32##XM(vfmulvf_float32##XM(x, 1.44269504f, vl), vl);                 \
+        float32##XM##_t fn = vfcvtfxv_float32##XM##_int32##XM(n, vl);                                                      \
+        float32##XM##_t r  = vfnmsacvf_float32##XM(x, 0.693359375f, fn, vl);                                               \
+        r                  = vfnmsacvf_float32##XM(r, -2.12194440e-4f, fn, vl);                                             \
+        /* exp(r) = 1 + r + r^2 * p(r) */                                                                                   \
+        float32##XM##_t p = vfmvvf_float32##XM(1.9875691500e-4f, vl);                                                       \
+        p = vfaddvf_float32##XM(vfmulvv_float32##XM(p, r, vl), 1.3981999507e-3f, vl);                                      \
+        p = vfaddvf_float32##XM(vfmulvv_float32##XM(p, r, vl), 8.3334519073e-3f, vl);                                      \
+        p = vfaddvf_float32##XM(vfmulvv_float32##XM(p, r, vl), 4.1665795894e-2f, vl);                                      \
+        p = vfaddvf_float32##XM(vfmulvv_float32##XM(p, r, vl), 1.6666665459e-1f, vl);                                      \
+        p = vfaddvf_float32##XM(vfmulvv_float32##XM(p, r, vl), 5.0000001201e-1f, vl);                                      \
+        p = vfmaccvv_float32##XM(r, p, vfmulvv_float32##XM(r, r, vl), vl);                                                  \
+        p = vfaddvf_float32##XM(p, 1.0f, vl);                                                                               \
+        /* 2^n = 2^(n / 2) * 2^(n - n / 2), both halves stay normal for n in [-126, 128] */                                 \
+        int32##XM##_t n1 = vsravx_int32##XM(n, 1, vl);                                                                      \
+        int32##XM##_t n2 = vsubvv_int32##XM(n, n1, vl);                                                                     \
+        float32##XM##_t e1 = vfreinterpret_float32##XM(vsllvx_int32##XM(vaddvx_int32##XM(n1, 127, vl), 23, vl), vl);       \
+        float32##XM##_t e2 = vfreinterpret_float32##XM(vsllvx_int32##XM(vaddvx_int32##XM(n2, 127, vl), 23, vl), vl);       \
+        return vfmulvv_float32##XM(vfmulvv_float32##XM(p, e1, vl), e2, vl);                                                 \
+    }                                                                                                                       \
+                                                                                                                            \
+    inline float32##XM##_t vflog_float32##XM(float32##XM##_t x, uint64_t vl)                                               \
+    {                                                                                                                       \
+        e32##XM##_t is_zero = vmfeqvf_e32##XM##_float32##XM(x, 0.0f, vl);                                                  \
+        e32##XM##_t is_neg  = vmfltvf_e32##XM##_float32##XM(x, 0.0f, vl);                                                  \
+        e32##XM##_t is_inf  = vmfeqvf_e32##XM##_float32##XM(x, INFINITY, vl);                                              \
+        x = vfmaxvf_float32##XM(x, FLT_MIN, vl);                                                                            \
+        /* x = m * 2^e, m in [0.5, 1) */                                                                                    \
+        int32##XM##_t bits = vreinterpret_int32##XM(x, vl);                                                                \
+        int32##XM##_t e    = vsubvx_int32##XM(vsravx_int32##XM(bits, 23, vl), 126, vl);                                    \
+        float32##XM##_t m  = vfreinterpret_float32##XM(vorvx_int32##XM(vandvx_int32##XM(bits, 0x007fffff, vl), 0x3f000000, vl), vl); \
+        float32##XM##_t fe = vfcvtfxv_float32##XM##_int32##XM(e, vl);                                                      \
+        /* m < sqrt(1/2): m = 2m, e = e - 1, so that m - 1 is in [-0.29, 0.41] */                                           \
+        e32##XM##_t is_small = vmfltvf_e32##XM##_float32##XM(m, 0.707106781f, vl);                                         \
+        fe = vfsubvf_mask_float32##XM(fe, fe, 1.0f, is_small, vl);                                                          \
+        m  = vfaddvv_mask_float32##XM(m, m, m, is_small, vl);                                                               \
+        m  = vfsubvf_float32##XM(m, 1.0f, vl);                                                                              \
+        float32##XM##_t z = vfmulvv_float32##XM(m, m, vl);                                                                  \
+        float32##XM##_t p = vfmvvf_float32##XM(7.0376836292e-2f, vl);                                                      \
+        p = vfaddvf_float32##XM(vfmulvv_float32##XM(p, m, vl), -1.1514610310e-1f, vl);                                     \
+        p = vfaddvf_float32##XM(vfmulvv_float32##XM(p, m, vl), 1.1676998740e-1f, vl);                                      \
+        p = vfaddvf_float32##XM(vfmulvv_float32##XM(p, m, vl), -1.2420140846e-1f, vl);                                     \
+        p = vfaddvf_float32##XM(vfmulvv_float32##XM(p, m, vl), 1.4249322787e-1f, vl);                                      \
+        p = vfaddvf_float32##XM(vfmulvv_float32##XM(p, m, vl), -1.6668057665e-1f, vl);                                     \
+        p = vfaddvf_float32##XM(vfmulvv_float32##XM(p, m, vl), 2.0000714765e-1f, vl);                                      \
+        p = vfaddvf_float32##XM(vfmulvv_float32##XM(p, m, vl), -2.4999993993e-1f, vl);                                     \
+        p = vfaddvf_float32##XM(vfmulvv_float32##XM(p, m, vl), 3.3333331174e-1f, vl);                                      \
+        p = vfmulvv_float32##XM(vfmulvv_float32##XM(p, m, vl), z, vl);                                                      \
+        p = vfmaccvf_float32##XM(p, -2.12194440e-4f, fe, vl);                                                               \
+        p = vfnmsacvf_float32##XM(p, 0.5f, z, vl);                                                                          \
+        float32##XM##_t y = vfaddvv_float32##XM(m, p, vl);                                                                  \
+        y = vfmaccvf_float32##XM(y, 0.693359375f, fe, vl);                                                                  \
+        y = vfmergevfm_float32##XM(y, -INFINITY, is_zero, vl);                                                              \
+        y = vfmergevfm_float32##XM(y, NAN, is_neg, vl);                                                                     \
+        y = vfmergevfm_float32##XM(y, INFINITY, is_inf, vl);                                                                \
+        return y;                                                                                                           \
+    }                                                                                                                       \
+                                                                                                                            \
+    inline float32##XM##_t vfsigmoid_float32##XM(float32##XM##_t x, uint64_t vl)                                           \
+    {                                                                                                                       \
+        float32##XM##_t e = vfexp_float32##XM(vfmulvf_float32##XM(x, -1.0f, vl), vl);                                       \
+        return vfrdivvf_float32##XM(vfaddvf_float32##XM(e, 1.0f, vl), 1.0f, vl);                                            \
+    }                                                                                                                       \
+                                                                                                                            \
+    inline float32##XM##_t vftanh_float32##XM(float32##XM##_t x, uint64_t vl)                                              \
+    {                                                                                                                       \
+        float32##XM##_t ax = vfsgnjxvv_float32##XM(x, x, vl);                                                               \
+        e32##XM##_t is_small = vmfltvf_e32##XM##_float32##XM(ax, 0.625f, vl);                                              \
+        /* |x| >= 0.625: 1 - 2 / (exp(2|x|) + 1), tanh(9) rounds to 1 */                                                    \
+        ax = vfminvf_float32##XM(ax, 9.0f, vl);                                                                             \
+        float32##XM##_t e = vfexp_float32##XM(vfaddvv_float32##XM(ax, ax, vl), vl);                                         \
+        float32##XM##_t y = vfrsubvf_float32##XM(vfrdivvf_float32##XM(vfaddvf_float32##XM(e, 1.0f, vl), 2.0f, vl), 1.0f, vl); \
+        y = vfsgnjvv_float32##XM(y, x, vl);                                                                                 \
+        /* |x| < 0.625: x + x^3 * p(x^2) */                                                                                 \
+        float32##XM##_t z = vfmulvv_float32##XM(x, x, vl);                                                                  \
+        float32##XM##_t p = vfmvvf_float32##XM(-5.70498872745e-3f, vl);                                                    \
+        p = vfaddvf_float32##XM(vfmulvv_float32##XM(p, z, vl), 2.06390887954e-2f, vl);                                     \
+        p = vfaddvf_float32##XM(vfmulvv_float32##XM(p, z, vl), -5.37397155531e-2f, vl);                                    \
+        p = vfaddvf_float32##XM(vfmulvv_float32##XM(p, z, vl), 1.33314422036e-1f, vl);                                     \
+        p = vfaddvf_float32##XM(vfmulvv_float32##XM(p, z, vl), -3.33332819422e-1f, vl);                                    \
+        p = vfmaccvv_float32##XM(x, vfmulvv_float32##XM(p, z, vl), x, vl);                                                  \
+        return vfaddvf_mask_float32##XM(y, p, 0.0f, is_small, vl);                                                          \
+    }                                                                                                                       \
+                                                                                                                            \
+    inline float32##XM##_t vferf_float32##XM(float32##XM##_t x, uint64_t vl)                                               \
+    {                                                                                                                       \
+        float32##XM##_t ax = vfsgnjxvv_float32##XM(x, x, vl);                                                               \
+        e32##XM##_t is_small = vmfltvf_e32##XM##_float32##XM(ax, 0.5f, vl);                                                \
+        /* |x| >= 0.5: 1 - erfc(|x|), erfc(x) = t * exp(-x^2 + q(t)), t = 1 / (1 + x / 2), erf(4) rounds to 1 */            \
+        ax = vfminvf_float32##XM(ax, 4.0f, vl);                                                                             \
+        float32##XM##_t t = vfrdivvf_float32##XM(vfaddvf_float32##XM(vfmulvf_float32##XM(ax, 0.5f, vl), 1.0f, vl), 1.0f, vl); \
+        float32##XM##_t q = vfmvvf_float32##XM(0.17087277f, vl);                                                           \
+        q = vfaddvf_float32##XM(vfmulvv_float32##XM(q, t, vl), -0.82215223f, vl);                                          \
+        q = vfaddvf_float32##XM(vfmulvv_float32##XM(q, t, vl), 1.48851587f, vl);                                           \
+        q = vfaddvf_float32##XM(vfmulvv_float32##XM(q, t, vl), -1.13520398f, vl);                                          \
+        q = vfaddvf_float32##XM(vfmulvv_float32##XM(q, t, vl), 0.27886807f, vl);                                           \
+        q = vfaddvf_float32##XM(vfmulvv_float32##XM(q, t, vl), -0.18628806f, vl);                                          \
+        q = vfaddvf_float32##XM(vfmulvv_float32##XM(q, t, vl), 0.09678418f, vl);                                           \
+        q = vfaddvf_float32##XM(vfmulvv_float32##XM(q, t, vl), 0.37409196f, vl);                                           \
+        q = vfaddvf_float32##XM(vfmulvv_float32##XM(q, t, vl), 1.00002368f, vl);                                           \
+        q = vfaddvf_float32##XM(vfmulvv_float32##XM(q, t, vl), -1.26551223f, vl);                                          \
+        q = vfnmsacvv_float32##XM(q, ax, ax, vl);                                                                           \
+        float32##XM##_t y = vfmulvv_float32##XM(t, vfexp_float32##XM(q, vl), vl);                                           \
+        y = vfsgnjvv_float32##XM(vfrsubvf_float32##XM(y, 1.0f, vl), x, vl);                                                 \
+        /* |x| < 0.5: taylor series, 2 / sqrt(pi) * (x - x^3 / 3 + x^5 / 10 - ...) */                                       \
+        float32##XM##_t z = vfmulvv_float32##XM(x, x, vl);                                                                  \
+        float32##XM##_t p = vfmvvf_float32##XM(1.2055332981e-4f, vl);                                                      \
+        p = vfaddvf_float32##XM(vfmulvv_float32##XM(p, z, vl), -8.5483269811e-4f, vl);                                     \
+        p = vfaddvf_float32##XM(vfmulvv_float32##XM(p, z, vl), 5.2239776254e-3f, vl);                                      \
+        p = vfaddvf_float32##XM(vfmulvv_float32##XM(p, z, vl), -2.6866170645e-2f, vl);                                     \
+        p = vfaddvf_float32##XM(vfmulvv_float32##XM(p, z, vl), 1.1283791671e-1f, vl);                                      \
+        p = vfaddvf_float32##XM(vfmulvv_float32##XM(p, z, vl), -3.7612638903e-1f, vl);                                     \
+        p = vfaddvf_float32##XM(vfmulvv_float32##XM(p, z, vl), 1.1283791671f, vl);                                         \
+        p = vfmulvv_float32##XM(p, x, vl);                                                                                  \
+        return vfaddvf_mask_float32##XM(y, p, 0.0f, is_small, vl);                                                          \
+    }
+// clang-format on
+
+PPL_RISCV_VECTOR_MATH_FP32(xm1, 4)
+PPL_RISCV_VECTOR_MATH_FP32(xm2, 8)
+
+#undef PPL_RISCV_VECTOR_MATH_FP32
+
+#define PPL_RISCV_VECTOR_MATH_FP16(FUNC)                                                                                    \
+    inline float16xm1_t FUNC##_float16xm1(float16xm1_t x, uint64_t vl)                                                     \
+    {                                                                                                                       \
+        float32xm2_t x_fp32 = vfwcvtffv_float32xm2_float16xm1(x, vl);                                                       \
+        return vfncvtffv_float16xm1_float32xm2(FUNC##_float32xm2(x_fp32, vl), vl);                                          \
+    }
+
+PPL_RISCV_VECTOR_MATH_FP16(vfexp)
+PPL_RISCV_VECTOR_MATH_FP16(vflog)
+PPL_RISCV_VECTOR_MATH_FP16(vfsigmoid)
+PPL_RISCV_VECTOR_MATH_FP16(vftanh)
+PPL_RISCV_VECTOR_MATH_FP16(vferf)
+
+#undef PPL_RISCV_VECTOR_MATH_FP16
+
+// applies `func` on n_elem contiguous elements, 4 vectors per iteration
+template <float32xm1_t (*func)(float32xm1_t, uint64_t)>
+inline void vector_math_unary_fp32(const float* src, float* dst, const int64_t n_elem)
+{
+    const int64_t atom_c = 4;
+    const auto vl        = vsetvli(atom_c, RVV_E32, RVV_M1);
+
+    int64_t i = 0;
+    for (; i + 4 * atom_c <= n_elem; i += 4 * atom_c) {
+        vsev_float32xm1(dst + i + 0 * atom_c, func(vlev_float32xm1(src + i + 0 * atom_c, vl), vl), vl);
+        vsev_float32xm1(dst + i + 1 * atom_c, func(vlev_float32xm1(src + i + 1 * atom_c, vl), vl), vl);
+        vsev_float32xm1(dst + i + 2 * atom_c, func(vlev_float32xm1(src + i + 2 * atom_c, vl), vl), vl);
+        vsev_float32xm1(dst + i + 3 * atom_c, func(vlev_float32xm1(src + i + 3 * atom_c, vl), vl), vl);
+    }
+    for (; i < n_elem; i += atom_c) {
+        const auto tail_vl = vsetvli(n_elem - i, RVV_E32, RVV_M1);
+        vsev_float32xm1(dst + i, func(vlev_float32xm1(src + i, tail_vl), tail_vl), tail_vl);
+    }
+}
+
+template <float16xm1_t (*func)(float16xm1_t, uint64_t)>
+inline void vector_math_unary_fp16(const __fp16* src, __fp16* dst, const int64_t n_elem)
+{
+    const int64_t atom_c = 8;
+    const auto vl        = vsetvli(atom_c, RVV_E16, RVV_M1);
+
+    int64_t i = 0;
+    for (; i + 2 * atom_c <= n_elem; i += 2 * atom_c) {
+        vsev_float16xm1(dst + i + 0 * atom_c, func(vlev_float16xm1(src + i + 0 * atom_c, vl), vl), vl);
+        vsev_float16xm1(dst + i + 1 * atom_c, func(vlev_float16xm1(src + i + 1 * atom_c, vl), vl), vl);
+    }
+    for (; i < n_elem; i += atom_c) {
+        const auto tail_vl = vsetvli(n_elem - i, RVV_E16, RVV_M1);
+        vsev_float16xm1(dst + i, func(vlev_float16xm1(src + i, tail_vl), tail_vl), tail_vl);
+    }
+}
+
+}}}; // namespace ppl::kernel::riscv
+
+#endif //  __ST_PPL_KERNEL_RISCV_COMMON_VECTOR_MATH_VECTOR_MATH_KERNEL_H_
@@ -0,0 +1,94 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <riscv-vector.h>
+
+#include "ppl/kernel/riscv/common/batchnorm/batchnorm_common.h"
+
+namespace ppl { namespace kernel { namespace riscv {
+
+#define C_BLK() ((int64_t)8)
+// fp16 data is scaled in fp32 -- precision-tuning
+
+template <bool with_relu>
+static void batchnorm_ndarray_kernel_fp16(
+    const __fp16* src,
+    const float* a,
+    const float* b,
+    const int64_t outer_dim,
+    const int64_t channels,
+    const int64_t inner_dim,
+    __fp16* dst)
+{
+    const auto vl = vsetvli(C_BLK(), RVV_E16, RVV_M1);
+
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t nc = 0; nc < outer_dim; nc++) {
+        const float ca     = a[nc % channels];
+        const float cb     = b[nc % channels];
+        const __fp16* src_ = src + nc * inner_dim;
+        __fp16* dst_       = dst + nc * inner_dim;
+
+        int64_t i = 0;
+        for (; i + C_BLK() <= inner_dim; i += C_BLK()) {
+            float32xm2_t y = vfaddvf_float32xm2(vfmulvf_float32xm2(vfwcvtffv_float32xm2_float16xm1(vlev_float16xm1(src_ + i, vl), vl), ca, vl), cb, vl);
+            if (with_relu) y = vfmaxvf_float32xm2(y, 0.0f, vl);
+            vsev_float16xm1(dst_ + i, vfncvtffv_float16xm1_float32xm2(y, vl), vl);
+        }
+        if (i < inner_dim) {
+            const auto tail_vl = vsetvli(inner_dim - i, RVV_E16, RVV_M1);
+            float32xm2_t y     = vfaddvf_float32xm2(vfmulvf_float32xm2(vfwcvtffv_float32xm2_float16xm1(vlev_float16xm1(src_ + i, tail_vl), tail_vl), ca, tail_vl), cb, tail_vl);
+            if (with_relu) y = vfmaxvf_float32xm2(y, 0.0f, tail_vl);
+            vsev_float16xm1(dst_ + i, vfncvtffv_float16xm1_float32xm2(y, tail_vl), tail_vl);
+        }
+    }
+}
+
+ppl::common::RetCode batchnorm_ndarray_fp16(
+    const ppl::common::TensorShape* src_shape,
+    const __fp16* src,
+    const __fp16* mean,
+    const __fp16* variance,
+    const __fp16* scale,
+    const __fp16* shift,
+    const float var_eps,
+    const bool relu,
+    __fp16* dst)
+{
+    const int64_t dim_count = src_shape->GetDimCount();
+    if (dim_count < 2) {
+        return ppl::common::RC_UNSUPPORTED;
+    }
+    const int64_t batch    = src_shape->GetDim(0);
+    const int64_t channels = src_shape->GetDim(1);
+    int64_t inner_dim      = 1;
+    for (int64_t i = 2; i < dim_count; i++) {
+        inner_dim *= src_shape->GetDim(i);
+    }
+
+    std::vector<float> a, b;
+    batchnorm_fold_param_common<__fp16>(mean, variance, scale, shift, var_eps, channels, channels, a, b);
+
+    if (relu) {
+        batchnorm_ndarray_kernel_fp16<true>(src, a.data(), b.data(), batch * channels, channels, inner_dim, dst);
+    } else {
+        batchnorm_ndarray_kernel_fp16<false>(src, a.data(), b.data(), batch * channels, channels, inner_dim, dst);
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+}}}; // namespace ppl::kernel::riscv
@@ -34,7 +34,21 @@ using namespace ppl::common;
 
 namespace ppl { namespace kernel { namespace riscv {
 
-conv2d_common_algo_info conv2d_fp16_algo_selector::select_best_algo(const void* filter, ppl::common::TensorShape& src_shape, ppl::common::TensorShape& dst_shape, const conv2d_common_param& param, Allocator* allocator, uint32_t winograd_level)
+static bool conv2d_fp16_use_fp32_acc(const conv2d_common_param& param, uint32_t fp16_acc_level)
+{
+    // fp16 has 11 significant bits, longer reductions start to lose the small addends
+    const int64_t fp32_acc_k_thresh = 1024;
+
+    const int64_t k = param.channels / param.group * param.kernel_h * param.kernel_w;
+    if (ppl::kernel::riscv::FP16_ACC_FP32 == fp16_acc_level) {
+        return true;
+    } else if (ppl::kernel::riscv::FP16_ACC_AUTO == fp16_acc_level) {
+        return k >= fp32_acc_k_thresh;
+    }
+    return false;
+}
+
+conv2d_common_algo_info conv2d_fp16_algo_selector::select_best_algo(const void* filter, ppl::common::TensorShape& src_shape, ppl::common::TensorShape& dst_shape, const conv2d_common_param& param, Allocator* allocator, uint32_t winograd_level, uint32_t fp16_acc_level)
 {
     static conv2d_common_algo_info unknown_info =
         {conv2d_common_algo::unknown, DATAFORMAT_UNKNOWN, DATAFORMAT_UNKNOWN, DATATYPE_FLOAT16, DATATYPE_FLOAT16};
@@ -65,7 +79,11 @@ conv2d_common_algo_info conv2d_fp16_algo_selector::select_best_algo(const void*
         }
     } else if (DATAFORMAT_N8CX == src_shape.GetDataFormat()) {
         for (auto algo_info : n4cx_algo_info_lst) {
-            if (algo_info.algo_type == conv2d_common_algo::winograd_b2f3) {
+            if (algo_info.algo_type == conv2d_common_algo::tile_gemm) {
+                if (conv2d_fp16_use_fp32_acc(param, fp16_acc_level)) {
+                    algo_info.algo_type = conv2d_common_algo::tile_gemm_fp32acc;
+                }
+            } else if (algo_info.algo_type == conv2d_common_algo::winograd_b2f3) {
                 if ((ppl::kernel::riscv::WG_ON != winograd_level && ppl::kernel::riscv::WG_ON_B2 != winograd_level) ||
                     param.kernel_h != 3 || param.kernel_w != 3 || param.stride_h != 1 || param.stride_w != 1 ||
                     param.dilation_h != 1 || param.dilation_w != 1) {
@@ -121,23 +139,27 @@ conv2d_common_algo_info conv2d_fp16_algo_selector::select_best_algo(const void*
 
     LOG(DEBUG) << "select best fp16 conv algo " << best_algo_info.algo_type;
     if (best_algo_info.algo_type == conv2d_common_algo::unknown) {
-        best_algo_info = select_algo(src_shape, param, winograd_level);
+        best_algo_info = select_algo(src_shape, param, winograd_level, fp16_acc_level);
     }
     return best_algo_info;
 }
 
 conv2d_common_algo_info conv2d_fp16_algo_selector::select_algo(const ppl::common::TensorShape& input_shape,
                                                                const conv2d_common_param& param,
-                                                               uint32_t winograd_level)
+                                                               uint32_t winograd_level,
+                                                               uint32_t fp16_acc_level)
 {
     static conv2d_common_algo_info unknown_info =
         {conv2d_common_algo::unknown, DATAFORMAT_UNKNOWN, DATAFORMAT_UNKNOWN, DATATYPE_FLOAT16, DATATYPE_FLOAT16};
+    const conv2d_common_algo_t tile_gemm_algo = conv2d_fp16_use_fp32_acc(param, fp16_acc_level)
+                                                    ? conv2d_common_algo::tile_gemm_fp32acc
+                                                    : conv2d_common_algo::tile_gemm;
 
     if (input_shape.GetDataFormat() == DATAFORMAT_NDARRAY) {
         if (param.group == 1) {
             return {conv2d_common_algo::tile_gemm, DATAFORMAT_NDARRAY, DATAFORMAT_N8CX, DATATYPE_FLOAT16, DATATYPE_FLOAT16};
         } else {
-            return {conv2d_common_algo::tile_gemm, DATAFORMAT_N8CX, DATAFORMAT_N8CX, DATATYPE_FLOAT16, DATATYPE_FLOAT16};
+            return {tile_gemm_algo, DATAFORMAT_N8CX, DATAFORMAT_N8CX, DATATYPE_FLOAT16, DATATYPE_FLOAT16};
         }
     }
 
@@ -150,7 +172,7 @@ conv2d_common_algo_info conv2d_fp16_algo_selector::select_algo(const ppl::common
             param.stride_h == 1 && param.stride_w == 1 &&
             param.dilation_h == 1 && param.dilation_w == 1) {
             if (ppl::kernel::riscv::WG_OFF == winograd_level) {
-                return {conv2d_common_algo::tile_gemm, DATAFORMAT_N8CX, DATAFORMAT_N8CX, DATATYPE_FLOAT16, DATATYPE_FLOAT16};
+                return {tile_gemm_algo, DATAFORMAT_N8CX, DATAFORMAT_N8CX, DATATYPE_FLOAT16, DATATYPE_FLOAT16};
             } else if (ppl::kernel::riscv::WG_ON_B2 == winograd_level) {
                 return {conv2d_common_algo::winograd_b2f3, DATAFORMAT_N8CX, DATAFORMAT_N8CX, DATATYPE_FLOAT16, DATATYPE_FLOAT16};
             } else if (ppl::kernel::riscv::WG_ON == winograd_level || ppl::kernel::riscv::WG_ON_B4 == winograd_level) {
@@ -160,7 +182,7 @@ conv2d_common_algo_info conv2d_fp16_algo_selector::select_algo(const ppl::common
             }
         }
 
-        return {conv2d_common_algo::tile_gemm, DATAFORMAT_N8CX, DATAFORMAT_N8CX, DATATYPE_FLOAT16, DATATYPE_FLOAT16};
+        return {tile_gemm_algo, DATAFORMAT_N8CX, DATAFORMAT_N8CX, DATATYPE_FLOAT16, DATATYPE_FLOAT16};
     }
 
     return unknown_info;
@@ -172,7 +194,8 @@ conv2d_offline_manager<__fp16>* conv2d_fp16_algo_selector::gen_algo(const conv2d
 {
     conv2d_offline_manager<__fp16>* conv_mgr = nullptr;
 
-    if (algo_info.algo_type == conv2d_common_algo::tile_gemm &&
+    if ((algo_info.algo_type == conv2d_common_algo::tile_gemm ||
+         algo_info.algo_type == conv2d_common_algo::tile_gemm_fp32acc) &&
         algo_info.input_format == DATAFORMAT_N8CX &&
         algo_info.output_format == DATAFORMAT_N8CX) {
         conv_mgr = new conv2d_n8cx_tile_gemm_fp16_offline_manager(param, algo_info, allocator);
@@ -94,6 +94,23 @@ void gemm_common_m8n16_left0_first_rv64_fp16(const __fp16* A, const __fp16* B, _
 
 void gemm_common_m8n16_left0_rv64_fp16(const __fp16* A, const __fp16* B, __fp16* C, int64_t m, int64_t n, int64_t k);
 
+void gemm_common_fp32acc_m8n8_left7_first_rv64_fp16(const __fp16* A, const __fp16* B, __fp16* C, int64_t m, int64_t n, int64_t k);
+void gemm_common_fp32acc_m8n8_left7_rv64_fp16(const __fp16* A, const __fp16* B, __fp16* C, int64_t m, int64_t n, int64_t k);
+void gemm_common_fp32acc_m8n8_left6_first_rv64_fp16(const __fp16* A, const __fp16* B, __fp16* C, int64_t m, int64_t n, int64_t k);
+void gemm_common_fp32acc_m8n8_left6_rv64_fp16(const __fp16* A, const __fp16* B, __fp16* C, int64_t m, int64_t n, int64_t k);
+void gemm_common_fp32acc_m8n8_left5_first_rv64_fp16(const __fp16* A, const __fp16* B, __fp16* C, int64_t m, int64_t n, int64_t k);
+void gemm_common_fp32acc_m8n8_left5_rv64_fp16(const __fp16* A, const __fp16* B, __fp16* C, int64_t m, int64_t n, int64_t k);
+void gemm_common_fp32acc_m8n8_left4_first_rv64_fp16(const __fp16* A, const __fp16* B, __fp16* C, int64_t m, int64_t n, int64_t k);
+void gemm_common_fp32acc_m8n8_left4_rv64_fp16(const __fp16* A, const __fp16* B, __fp16* C, int64_t m, int64_t n, int64_t k);
+void gemm_common_fp32acc_m8n8_left3_first_rv64_fp16(const __fp16* A, const __fp16* B, __fp16* C, int64_t m, int64_t n, int64_t k);
+void gemm_common_fp32acc_m8n8_left3_rv64_fp16(const __fp16* A, const __fp16* B, __fp16* C, int64_t m, int64_t n, int64_t k);
+void gemm_common_fp32acc_m8n8_left2_first_rv64_fp16(const __fp16* A, const __fp16* B, __fp16* C, int64_t m, int64_t n, int64_t k);
+void gemm_common_fp32acc_m8n8_left2_rv64_fp16(const __fp16* A, const __fp16* B, __fp16* C, int64_t m, int64_t n, int64_t k);
+void gemm_common_fp32acc_m8n8_left1_first_rv64_fp16(const __fp16* A, const __fp16* B, __fp16* C, int64_t m, int64_t n, int64_t k);
+void gemm_common_fp32acc_m8n8_left1_rv64_fp16(const __fp16* A, const __fp16* B, __fp16* C, int64_t m, int64_t n, int64_t k);
+void gemm_common_fp32acc_m8n8_left0_first_rv64_fp16(const __fp16* A, const __fp16* B, __fp16* C, int64_t m, int64_t n, int64_t k);
+void gemm_common_fp32acc_m8n8_left0_rv64_fp16(const __fp16* A, const __fp16* B, __fp16* C, int64_t m, int64_t n, int64_t k);
+
 #ifdef __cplusplus
 }
 #endif
@@ -242,6 +259,41 @@ conv_gemm_riscv_kernel_func_type_t conv_gemm_select_xcto8c_kernel_fp16(int64_t m
     }
 }
 
+// same layout as conv_gemm_select_kernel_fp16, but accumulates in fp32 and rounds to fp16 on store
+template <bool first>
+conv_gemm_riscv_kernel_func_type_t conv_gemm_select_fp32acc_kernel_fp16(int64_t n)
+{
+    switch (n % 8) {
+        case 0:
+            return first ? gemm_common_fp32acc_m8n8_left0_first_rv64_fp16 : gemm_common_fp32acc_m8n8_left0_rv64_fp16;
+        case 1:
+            return first ? gemm_common_fp32acc_m8n8_left1_first_rv64_fp16 : gemm_common_fp32acc_m8n8_left1_rv64_fp16;
+        case 2:
+            return first ? gemm_common_fp32acc_m8n8_left2_first_rv64_fp16 : gemm_common_fp32acc_m8n8_left2_rv64_fp16;
+        case 3:
+            return first ? gemm_common_fp32acc_m8n8_left3_first_rv64_fp16 : gemm_common_fp32acc_m8n8_left3_rv64_fp16;
+        case 4:
+            return first ? gemm_common_fp32acc_m8n8_left4_first_rv64_fp16 : gemm_common_fp32acc_m8n8_left4_rv64_fp16;
+        case 5:
+            return first ? gemm_common_fp32acc_m8n8_left5_first_rv64_fp16 : gemm_common_fp32acc_m8n8_left5_rv64_fp16;
+        case 6:
+            return first ? gemm_common_fp32acc_m8n8_left6_first_rv64_fp16 : gemm_common_fp32acc_m8n8_left6_rv64_fp16;
+        case 7:
+            return first ? gemm_common_fp32acc_m8n8_left7_first_rv64_fp16 : gemm_common_fp32acc_m8n8_left7_rv64_fp16;
+    }
+    return first ? gemm_common_fp32acc_m8n8_left0_first_rv64_fp16 : gemm_common_fp32acc_m8n8_left0_rv64_fp16;
+}
+
+template <int64_t src_atom_c, bool first>
+conv_gemm_riscv_kernel_func_type_t conv_gemm_select_xcto8c_fp32acc_kernel_fp16(int64_t n)
+{
+    if (src_atom_c == 1) {
+        // ndarray input has k = ic * kh * kw <= 3 * kh * kw in practice, keep the fp16 kernel
+        return conv_gemm_select_cto8c_kernel_fp16<first>(n);
+    }
+    return conv_gemm_select_fp32acc_kernel_fp16<first>(n);
+}
+
 }}}; // namespace ppl::kernel::riscv
 
 #endif
@@ -126,7 +126,7 @@ void tile_gemm_src_blk_im2col_nxchw(
     }
 }
 
-template <int64_t atom_ic>
+template <int64_t atom_ic, bool fp32_acc = false>
 void conv_tile_gemm_riscv_xcto8c_per_group_fp16(
     const __fp16* src,
     const __fp16* filter,
@@ -200,7 +200,8 @@ void conv_tile_gemm_riscv_xcto8c_per_group_fp16(
             for (int64_t m_beg = 0; m_beg < total_m; m_beg += tile_gemm_m_blk) {
                 int64_t real_m_blk     = min(tile_gemm_m_blk, total_m - m_beg);
                 int64_t real_pad_m_blk = round_up(real_m_blk, atom_oc);
-                auto gemm_func         = conv_gemm_select_xcto8c_kernel_fp16<atom_ic, true>(real_pad_m_blk, real_n_blk);
+                auto gemm_func         = fp32_acc ? conv_gemm_select_xcto8c_fp32acc_kernel_fp16<atom_ic, true>(real_n_blk)
+                                                  : conv_gemm_select_xcto8c_kernel_fp16<atom_ic, true>(real_pad_m_blk, real_n_blk);
 
                 gemm_func(filter_temp, src_trans, dst_blk, real_pad_m_blk, real_n_blk, total_k);
 
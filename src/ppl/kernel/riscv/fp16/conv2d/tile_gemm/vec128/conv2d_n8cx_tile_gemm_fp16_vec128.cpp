@@ -82,7 +82,10 @@ ppl::common::RetCode conv2d_n8cx_tile_gemm_fp16_runtime_executor::execute()
         return ppl::common::RC_INVALID_VALUE;
     }
 
-    conv_shell_riscv_fp16<conv_tile_gemm_tunning_info, 8, get_real_filter_size, conv_tile_gemm_riscv_xcto8c_per_group_fp16<8>>(
+    auto conv_shell_func = fp32_acc_
+                               ? conv_shell_riscv_fp16<conv_tile_gemm_tunning_info, 8, get_real_filter_size, conv_tile_gemm_riscv_xcto8c_per_group_fp16<8, true>>
+                               : conv_shell_riscv_fp16<conv_tile_gemm_tunning_info, 8, get_real_filter_size, conv_tile_gemm_riscv_xcto8c_per_group_fp16<8, false>>;
+    conv_shell_func(
         src_,
         cvt_filter_,
         cvt_bias_,
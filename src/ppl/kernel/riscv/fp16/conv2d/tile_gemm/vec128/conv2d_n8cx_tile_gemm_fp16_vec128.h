@@ -35,10 +35,12 @@ struct conv2d_n8cx_tile_gemm_fp16_vec128_tunning_param {
 
 class conv2d_n8cx_tile_gemm_fp16_runtime_executor final : public conv2d_runtime_executor<__fp16> {
 public:
-    conv2d_n8cx_tile_gemm_fp16_runtime_executor() {}
-    conv2d_n8cx_tile_gemm_fp16_runtime_executor(const conv2d_common_param* conv_param, const __fp16* cvt_filter, const __fp16* bias, conv2d_n8cx_tile_gemm_fp16_vec128_tunning_param tunning_param)
+    conv2d_n8cx_tile_gemm_fp16_runtime_executor()
+        : fp32_acc_(false) {}
+    conv2d_n8cx_tile_gemm_fp16_runtime_executor(const conv2d_common_param* conv_param, const __fp16* cvt_filter, const __fp16* bias, conv2d_n8cx_tile_gemm_fp16_vec128_tunning_param tunning_param, bool fp32_acc = false)
         : conv2d_runtime_executor<__fp16>(conv_param, cvt_filter, bias)
-        , tunning_param_(tunning_param) {}
+        , tunning_param_(tunning_param)
+        , fp32_acc_(fp32_acc) {}
 
     // calculate overall temp buffer size
     uint64_t cal_temp_buffer_size() override;
@@ -49,6 +51,7 @@ public:
 
 private:
     conv2d_n8cx_tile_gemm_fp16_vec128_tunning_param tunning_param_;
+    bool fp32_acc_; // accumulate gemm in fp32, see conv2d_common_algo::tile_gemm_fp32acc
     void adjust_tunning_param();
 
     friend conv2d_n8cx_tile_gemm_fp16_offline_manager;
@@ -68,7 +71,8 @@ public:
 
     conv2d_base_runtime_executor* gen_executor() override
     {
-        return new conv2d_n8cx_tile_gemm_fp16_runtime_executor(&param_, cvt_filter_, cvt_bias_, tunning_param_);
+        const bool fp32_acc = algo_info_.algo_type == conv2d_common_algo::tile_gemm_fp32acc;
+        return new conv2d_n8cx_tile_gemm_fp16_runtime_executor(&param_, cvt_filter_, cvt_bias_, tunning_param_, fp32_acc);
     }
 
 private:
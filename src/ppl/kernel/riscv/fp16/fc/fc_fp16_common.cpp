@@ -20,16 +20,31 @@
 #include "ppl/kernel/riscv/fp16/fc.h"
 #include "ppl/kernel/riscv/fp16/fc/vec128/fc_fp16_vec128.h"
 #include "ppl/kernel/riscv/fp16/fc/vec128/fc_ndarray_fp16_vec128.h"
+#include "ppl/kernel/riscv/fp16/fc/vec128/fc_gemv_fp16_vec128.h"
 #include "ppl/common/log.h"
 
 namespace ppl { namespace kernel { namespace riscv {
 
-fc_common_algo_info fc_algo_selector_fp16::select_algo(const ppl::common::dataformat_t& src_format,
-                                                       const fc_common_param& param)
+// batch <= 0 means unknown
+static fc_common_algo_info fc_fp16_select_algo(const ppl::common::dataformat_t& src_format,
+                                               const fc_common_param& param,
+                                               uint32_t fp16_acc_level,
+                                               int64_t batch)
 {
     static fc_common_algo_info unknown_info = {fc_common_algo::unknown};
+    // same threshold as conv2d, the whole channels is reduced in registers
+    const int64_t fp32_acc_k_thresh = 1024;
+    const bool fp32_acc             = ppl::kernel::riscv::FP16_ACC_FP32 == fp16_acc_level ||
+                                      (ppl::kernel::riscv::FP16_ACC_AUTO == fp16_acc_level && param.channels >= fp32_acc_k_thresh);
 
     if (false) {
+    } else if (batch == 1 && (src_format == ppl::common::DATAFORMAT_NDARRAY || src_format == ppl::common::DATAFORMAT_N8CX)) {
+        return {
+            fp32_acc ? fc_common_algo::gemv_fp32acc : fc_common_algo::gemv,
+            src_format,
+            src_format,
+            ppl::common::DATATYPE_FLOAT16,
+            ppl::common::DATATYPE_FLOAT16};
     } else if (src_format == ppl::common::DATAFORMAT_NDARRAY) {
         return {
             fc_common_algo::standard,
@@ -39,7 +54,7 @@ fc_common_algo_info fc_algo_selector_fp16::select_algo(const ppl::common::datafo
             ppl::common::DATATYPE_FLOAT16};
     } else if (src_format == ppl::common::DATAFORMAT_N8CX) {
         return {
-            fc_common_algo::standard,
+            fp32_acc ? fc_common_algo::standard_fp32acc : fc_common_algo::standard,
             ppl::common::DATAFORMAT_N8CX,
             ppl::common::DATAFORMAT_N8CX,
             ppl::common::DATATYPE_FLOAT16,
@@ -49,6 +64,20 @@ fc_common_algo_info fc_algo_selector_fp16::select_algo(const ppl::common::datafo
     return unknown_info;
 }
 
+fc_common_algo_info fc_algo_selector_fp16::select_algo(const ppl::common::dataformat_t& src_format,
+                                                       const fc_common_param& param,
+                                                       uint32_t fp16_acc_level)
+{
+    return fc_fp16_select_algo(src_format, param, fp16_acc_level, 0);
+}
+
+fc_common_algo_info fc_algo_selector_fp16::select_algo(const ppl::common::TensorShape& src_shape,
+                                                       const fc_common_param& param,
+                                                       uint32_t fp16_acc_level)
+{
+    return fc_fp16_select_algo(src_shape.GetDataFormat(), param, fp16_acc_level, src_shape.GetDim(0));
+}
+
 fc_manager<__fp16>* fc_algo_selector_fp16::gen_algo(const fc_common_param& param, const fc_common_algo_info& algo_info, ppl::common::Allocator* allocator)
 {
     fc_manager<__fp16>* fc_mgr = nullptr;
@@ -56,6 +85,12 @@ fc_manager<__fp16>* fc_algo_selector_fp16::gen_algo(const fc_common_param& param
         fc_mgr = new fc_ndarray_fp16_vec128_manager(param, allocator);
     } else if (algo_info.algo_type == fc_common_algo::standard && algo_info.input_format == ppl::common::DATAFORMAT_N8CX) {
         fc_mgr = new fc_fp16_vec128_manager(param, allocator);
+    } else if (algo_info.algo_type == fc_common_algo::standard_fp32acc && algo_info.input_format == ppl::common::DATAFORMAT_N8CX) {
+        fc_mgr = new fc_fp16_vec128_manager(param, allocator, true);
+    } else if (algo_info.algo_type == fc_common_algo::gemv) {
+        fc_mgr = new fc_gemv_fp16_vec128_manager(param, allocator);
+    } else if (algo_info.algo_type == fc_common_algo::gemv_fp32acc) {
+        fc_mgr = new fc_gemv_fp16_vec128_manager(param, allocator, true);
     } else {
         LOG(ERROR) << "FC gen algo failed.";
     }
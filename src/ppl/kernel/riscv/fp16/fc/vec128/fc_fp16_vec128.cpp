@@ -53,7 +53,7 @@ void fc_cvt_flt_riscv_fp16(
     }
 }
 
-template <int64_t atom_m>
+template <int64_t atom_m, bool first>
 void hgemm_n8chw_mxn8_riscv_fp16(
     const __fp16* src,
     const __fp16* flt,
@@ -65,6 +65,7 @@ void hgemm_n8chw_mxn8_riscv_fp16(
 )
 {
     asm volatile(
+        ".equ           IS_FIRST, %c[IS_FIRST]  \n\t"
         ".equ           ATOM_M, %c[ATOM_M]      \n\t"
 
         "addi           t0,     zero,   8       \n\t"
@@ -75,6 +76,7 @@ void hgemm_n8chw_mxn8_riscv_fp16(
         "mv             t2,     %[DST]          \n\t"
         "mv             t3,     %[IC]           \n\t"
 
+        ".if IS_FIRST == 1                      \n\t"
         // load bias : v31  &&  bias operation
         "vle.v          v31,    (%[BIAS])       \n\t"
 
@@ -100,6 +102,40 @@ void hgemm_n8chw_mxn8_riscv_fp16(
         ".if ATOM_M > 7                         \n\t"
         "vmv.v.v        v23,    v31             \n\t"
         ".endif                                 \n\t"
+        ".else                                  \n\t"
+        // load dst to accumulate on the previous k tile
+        "mv             t4,     t2              \n\t"
+        "vle.v          v16,    (t4)            \n\t"
+        "add            t4,     t4,     %[OHSTD]\n\t"
+        ".if ATOM_M > 1                         \n\t"
+        "vle.v          v17,    (t4)            \n\t"
+        "add            t4,     t4,     %[OHSTD]\n\t"
+        ".endif                                 \n\t"
+        ".if ATOM_M > 2                         \n\t"
+        "vle.v          v18,    (t4)            \n\t"
+        "add            t4,     t4,     %[OHSTD]\n\t"
+        ".endif                                 \n\t"
+        ".if ATOM_M > 3                         \n\t"
+        "vle.v          v19,    (t4)            \n\t"
+        "add            t4,     t4,     %[OHSTD]\n\t"
+        ".endif                                 \n\t"
+        ".if ATOM_M > 4                         \n\t"
+        "vle.v          v20,    (t4)            \n\t"
+        "add            t4,     t4,     %[OHSTD]\n\t"
+        ".endif                                 \n\t"
+        ".if ATOM_M > 5                         \n\t"
+        "vle.v          v21,    (t4)            \n\t"
+        "add            t4,     t4,     %[OHSTD]\n\t"
+        ".endif                                 \n\t"
+        ".if ATOM_M > 6                         \n\t"
+        "vle.v          v22,    (t4)            \n\t"
+        "add            t4,     t4,     %[OHSTD]\n\t"
+        ".endif                                 \n\t"
+        ".if ATOM_M > 7                         \n\t"
+        "vle.v          v23,    (t4)            \n\t"
+        "add            t4,     t4,     %[OHSTD]\n\t"
+        ".endif                                 \n\t"
+        ".endif                                 \n\t"
         // load filter : v8 - v15
         "0:                                     \n\t"
         "vle.v          v8,     (t1)            \n\t"
@@ -349,21 +385,318 @@ void hgemm_n8chw_mxn8_riscv_fp16(
         ".endif                                 \n\t"
 
         :
-        : [ATOM_M] "i"(atom_m), [SRC] "r"(src), [FLT] "r"(flt), [DST] "r"(dst), [BIAS] "r"(bias), [IC] "r"(channels), [IHSTD] "r"(channels * 2), [OHSTD] "r"(num_outs * 2)
+        : [IS_FIRST] "i"(first), [ATOM_M] "i"(atom_m), [SRC] "r"(src), [FLT] "r"(flt), [DST] "r"(dst), [BIAS] "r"(bias), [IC] "r"(channels), [IHSTD] "r"(channels * 2), [OHSTD] "r"(num_outs * 2)
         : "memory", "t0", "t1", "t2", "t3", "t4", "v0", "v1", "v2", "v3", "v4", "v5", "v6", "v7", "v8", "v9", "v10", "v11", "v12", "v13", "v14", "v15", "v16", "v17", "v18", "v19", "v20", "v21", "v22", "v23", "v24", "v25", "v26", "v27", "v28", "v29", "v30", "v31");
 }
 
+// same as hgemm_n8chw_mxn8_riscv_fp16, but accumulates in fp32 (v16 - v31, m2 groups) and rounds to fp16 on store.
+// src is read as fp16 scalars, so no vrgather is needed and up to 8 rows still fit in registers.
+template <int64_t atom_m>
+void hgemm_n8chw_mxn8_fp32acc_riscv_fp16(
+    const __fp16* src,
+    const __fp16* flt,
+    const __fp16* bias,
+    __fp16* dst,
+
+    int32_t channels, // padded
+    int32_t num_outs // padded
+)
+{
+    asm volatile(
+        ".equ           ATOM_M, %c[ATOM_M]      \n\t"
+
+        "addi           t0,     zero,   8       \n\t"
+        "vsetvli        t1,     t0,     e16     \n\t"
+
+        "mv             t0,     %[SRC]          \n\t"
+        "mv             t1,     %[FLT]          \n\t"
+        "mv             t2,     %[DST]          \n\t"
+        "mv             t3,     %[IC]           \n\t"
+
+        // load bias : v0  &&  widen to v16 - v31
+        "vle.v          v0,     (%[BIAS])       \n\t"
+        "vfwcvt.f.f.v   v16,    v0              \n\t"
+        ".if ATOM_M > 1                         \n\t"
+        "vfwcvt.f.f.v   v18,    v0              \n\t"
+        ".endif                                 \n\t"
+        ".if ATOM_M > 2                         \n\t"
+        "vfwcvt.f.f.v   v20,    v0              \n\t"
+        ".endif                                 \n\t"
+        ".if ATOM_M > 3                         \n\t"
+        "vfwcvt.f.f.v   v22,    v0              \n\t"
+        ".endif                                 \n\t"
+        ".if ATOM_M > 4                         \n\t"
+        "vfwcvt.f.f.v   v24,    v0              \n\t"
+        ".endif                                 \n\t"
+        ".if ATOM_M > 5                         \n\t"
+        "vfwcvt.f.f.v   v26,    v0              \n\t"
+        ".endif                                 \n\t"
+        ".if ATOM_M > 6                         \n\t"
+        "vfwcvt.f.f.v   v28,    v0              \n\t"
+        ".endif                                 \n\t"
+        ".if ATOM_M > 7                         \n\t"
+        "vfwcvt.f.f.v   v30,    v0              \n\t"
+        ".endif                                 \n\t"
+        // load filter : v8 - v15
+        "0:                                     \n\t"
+        "vle.v          v8,     (t1)            \n\t"
+        "addi           t1,     t1,     16      \n\t"
+        "vle.v          v9,     (t1)            \n\t"
+        "addi           t1,     t1,     16      \n\t"
+        "vle.v          v10,    (t1)            \n\t"
+        "addi           t1,     t1,     16      \n\t"
+        "vle.v          v11,    (t1)            \n\t"
+        "addi           t1,     t1,     16      \n\t"
+        "vle.v          v12,    (t1)            \n\t"
+        "addi           t1,     t1,     16      \n\t"
+        "vle.v          v13,    (t1)            \n\t"
+        "addi           t1,     t1,     16      \n\t"
+        "vle.v          v14,    (t1)            \n\t"
+        "addi           t1,     t1,     16      \n\t"
+        "vle.v          v15,    (t1)            \n\t"
+        "addi           t1,     t1,     16      \n\t"
+
+        // load src as scalars : ft0 - ft7 / fa0 - fa7, calculate
+        "mv             t4,     t0              \n\t"
+        "flh            ft0,    0(t4)           \n\t"
+        "flh            ft1,    2(t4)           \n\t"
+        "flh            ft2,    4(t4)           \n\t"
+        "flh            ft3,    6(t4)           \n\t"
+        "flh            ft4,    8(t4)           \n\t"
+        "flh            ft5,    10(t4)          \n\t"
+        "flh            ft6,    12(t4)          \n\t"
+        "flh            ft7,    14(t4)          \n\t"
+        "add            t4,     t4,     %[IHSTD]\n\t"
+        "vfwmacc.vf     v16,    ft0,    v8      \n\t"
+        "vfwmacc.vf     v16,    ft1,    v9      \n\t"
+        "vfwmacc.vf     v16,    ft2,    v10     \n\t"
+        "vfwmacc.vf     v16,    ft3,    v11     \n\t"
+        "vfwmacc.vf     v16,    ft4,    v12     \n\t"
+        "vfwmacc.vf     v16,    ft5,    v13     \n\t"
+        "vfwmacc.vf     v16,    ft6,    v14     \n\t"
+        "vfwmacc.vf     v16,    ft7,    v15     \n\t"
+
+        ".if ATOM_M > 1                         \n\t"
+        "flh            fa0,    0(t4)           \n\t"
+        "flh            fa1,    2(t4)           \n\t"
+        "flh            fa2,    4(t4)           \n\t"
+        "flh            fa3,    6(t4)           \n\t"
+        "flh            fa4,    8(t4)           \n\t"
+        "flh            fa5,    10(t4)          \n\t"
+        "flh            fa6,    12(t4)          \n\t"
+        "flh            fa7,    14(t4)          \n\t"
+        "add            t4,     t4,     %[IHSTD]\n\t"
+        "vfwmacc.vf     v18,    fa0,    v8      \n\t"
+        "vfwmacc.vf     v18,    fa1,    v9      \n\t"
+        "vfwmacc.vf     v18,    fa2,    v10     \n\t"
+        "vfwmacc.vf     v18,    fa3,    v11     \n\t"
+        "vfwmacc.vf     v18,    fa4,    v12     \n\t"
+        "vfwmacc.vf     v18,    fa5,    v13     \n\t"
+        "vfwmacc.vf     v18,    fa6,    v14     \n\t"
+        "vfwmacc.vf     v18,    fa7,    v15     \n\t"
+        ".endif                                 \n\t"
+
+        ".if ATOM_M > 2                         \n\t"
+        "flh            ft0,    0(t4)           \n\t"
+        "flh            ft1,    2(t4)           \n\t"
+        "flh            ft2,    4(t4)           \n\t"
+        "flh            ft3,    6(t4)           \n\t"
+        "flh            ft4,    8(t4)           \n\t"
+        "flh            ft5,    10(t4)          \n\t"
+        "flh            ft6,    12(t4)          \n\t"
+        "flh            ft7,    14(t4)          \n\t"
+        "add            t4,     t4,     %[IHSTD]\n\t"
+        "vfwmacc.vf     v20,    ft0,    v8      \n\t"
+        "vfwmacc.vf     v20,    ft1,    v9      \n\t"
+        "vfwmacc.vf     v20,    ft2,    v10     \n\t"
+        "vfwmacc.vf     v20,    ft3,    v11     \n\t"
+        "vfwmacc.vf     v20,    ft4,    v12     \n\t"
+        "vfwmacc.vf     v20,    ft5,    v13     \n\t"
+        "vfwmacc.vf     v20,    ft6,    v14     \n\t"
+        "vfwmacc.vf     v20,    ft7,    v15     \n\t"
+        ".endif                                 \n\t"
+
+        ".if ATOM_M > 3                         \n\t"
+        "flh            fa0,    0(t4)           \n\t"
+        "flh            fa1,    2(t4)           \n\t"
+        "flh            fa2,    4(t4)           \n\t"
+        "flh            fa3,    6(t4)           \n\t"
+        "flh            fa4,    8(t4)           \n\t"
+        "flh            fa5,    10(t4)          \n\t"
+        "flh            fa6,    12(t4)          \n\t"
+        "flh            fa7,    14(t4)          \n\t"
+        "add            t4,     t4,     %[IHSTD]\n\t"
+        "vfwmacc.vf     v22,    fa0,    v8      \n\t"
+        "vfwmacc.vf     v22,    fa1,    v9      \n\t"
+        "vfwmacc.vf     v22,    fa2,    v10     \n\t"
+        "vfwmacc.vf     v22,    fa3,    v11     \n\t"
+        "vfwmacc.vf     v22,    fa4,    v12     \n\t"
+        "vfwmacc.vf     v22,    fa5,    v13     \n\t"
+        "vfwmacc.vf     v22,    fa6,    v14     \n\t"
+        "vfwmacc.vf     v22,    fa7,    v15     \n\t"
+        ".endif                                 \n\t"
+
+        ".if ATOM_M > 4                         \n\t"
+        "flh            ft0,    0(t4)           \n\t"
+        "flh            ft1,    2(t4)           \n\t"
+        "flh            ft2,    4(t4)           \n\t"
+        "flh            ft3,    6(t4)           \n\t"
+        "flh            ft4,    8(t4)           \n\t"
+        "flh            ft5,    10(t4)          \n\t"
+        "flh            ft6,    12(t4)          \n\t"
+        "flh            ft7,    14(t4)          \n\t"
+        "add            t4,     t4,     %[IHSTD]\n\t"
+        "vfwmacc.vf     v24,    ft0,    v8      \n\t"
+        "vfwmacc.vf     v24,    ft1,    v9      \n\t"
+        "vfwmacc.vf     v24,    ft2,    v10     \n\t"
+        "vfwmacc.vf     v24,    ft3,    v11     \n\t"
+        "vfwmacc.vf     v24,    ft4,    v12     \n\t"
+        "vfwmacc.vf     v24,    ft5,    v13     \n\t"
+        "vfwmacc.vf     v24,    ft6,    v14     \n\t"
+        "vfwmacc.vf     v24,    ft7,    v15     \n\t"
+        ".endif                                 \n\t"
+
+        ".if ATOM_M > 5                         \n\t"
+        "flh            fa0,    0(t4)           \n\t"
+        "flh            fa1,    2(t4)           \n\t"
+        "flh            fa2,    4(t4)           \n\t"
+        "flh            fa3,    6(t4)           \n\t"
+        "flh            fa4,    8(t4)           \n\t"
+        "flh            fa5,    10(t4)          \n\t"
+        "flh            fa6,    12(t4)          \n\t"
+        "flh            fa7,    14(t4)          \n\t"
+        "add            t4,     t4,     %[IHSTD]\n\t"
+        "vfwmacc.vf     v26,    fa0,    v8      \n\t"
+        "vfwmacc.vf     v26,    fa1,    v9      \n\t"
+        "vfwmacc.vf     v26,    fa2,    v10     \n\t"
+        "vfwmacc.vf     v26,    fa3,    v11     \n\t"
+        "vfwmacc.vf     v26,    fa4,    v12     \n\t"
+        "vfwmacc.vf     v26,    fa5,    v13     \n\t"
+        "vfwmacc.vf     v26,    fa6,    v14     \n\t"
+        "vfwmacc.vf     v26,    fa7,    v15     \n\t"
+        ".endif                                 \n\t"
+
+        ".if ATOM_M > 6                         \n\t"
+        "flh            ft0,    0(t4)           \n\t"
+        "flh            ft1,    2(t4)           \n\t"
+        "flh            ft2,    4(t4)           \n\t"
+        "flh            ft3,    6(t4)           \n\t"
+        "flh            ft4,    8(t4)           \n\t"
+        "flh            ft5,    10(t4)          \n\t"
+        "flh            ft6,    12(t4)          \n\t"
+        "flh            ft7,    14(t4)          \n\t"
+        "add            t4,     t4,     %[IHSTD]\n\t"
+        "vfwmacc.vf     v28,    ft0,    v8      \n\t"
+        "vfwmacc.vf     v28,    ft1,    v9      \n\t"
+        "vfwmacc.vf     v28,    ft2,    v10     \n\t"
+        "vfwmacc.vf     v28,    ft3,    v11     \n\t"
+        "vfwmacc.vf     v28,    ft4,    v12     \n\t"
+        "vfwmacc.vf     v28,    ft5,    v13     \n\t"
+        "vfwmacc.vf     v28,    ft6,    v14     \n\t"
+        "vfwmacc.vf     v28,    ft7,    v15     \n\t"
+        ".endif                                 \n\t"
+
+        ".if ATOM_M > 7                         \n\t"
+        "flh            fa0,    0(t4)           \n\t"
+        "flh            fa1,    2(t4)           \n\t"
+        "flh            fa2,    4(t4)           \n\t"
+        "flh            fa3,    6(t4)           \n\t"
+        "flh            fa4,    8(t4)           \n\t"
+        "flh            fa5,    10(t4)          \n\t"
+        "flh            fa6,    12(t4)          \n\t"
+        "flh            fa7,    14(t4)          \n\t"
+        "add            t4,     t4,     %[IHSTD]\n\t"
+        "vfwmacc.vf     v30,    fa0,    v8      \n\t"
+        "vfwmacc.vf     v30,    fa1,    v9      \n\t"
+        "vfwmacc.vf     v30,    fa2,    v10     \n\t"
+        "vfwmacc.vf     v30,    fa3,    v11     \n\t"
+        "vfwmacc.vf     v30,    fa4,    v12     \n\t"
+        "vfwmacc.vf     v30,    fa5,    v13     \n\t"
+        "vfwmacc.vf     v30,    fa6,    v14     \n\t"
+        "vfwmacc.vf     v30,    fa7,    v15     \n\t"
+        ".endif                                 \n\t"
+
+        // loop_k condition
+        "addi           t0,     t0,     16      \n\t"
+        "addi           t3,     t3,     -8      \n\t"
+        "bne            t3,     zero,   0b      \n\t"
+
+        // narrow and store dst
+        "vfncvt.f.f.v   v0,     v16             \n\t"
+        "vse.v          v0,     (t2)            \n\t"
+        "add            t2,     t2,     %[OHSTD]\n\t"
+        ".if ATOM_M > 1                         \n\t"
+        "vfncvt.f.f.v   v0,     v18             \n\t"
+        "vse.v          v0,     (t2)            \n\t"
+        "add            t2,     t2,     %[OHSTD]\n\t"
+        ".endif                                 \n\t"
+        ".if ATOM_M > 2                         \n\t"
+        "vfncvt.f.f.v   v0,     v20             \n\t"
+        "vse.v          v0,     (t2)            \n\t"
+        "add            t2,     t2,     %[OHSTD]\n\t"
+        ".endif                                 \n\t"
+        ".if ATOM_M > 3                         \n\t"
+        "vfncvt.f.f.v   v0,     v22             \n\t"
+        "vse.v          v0,     (t2)            \n\t"
+        "add            t2,     t2,     %[OHSTD]\n\t"
+        ".endif                                 \n\t"
+        ".if ATOM_M > 4                         \n\t"
+        "vfncvt.f.f.v   v0,     v24             \n\t"
+        "vse.v          v0,     (t2)            \n\t"
+        "add            t2,     t2,     %[OHSTD]\n\t"
+        ".endif                                 \n\t"
+        ".if ATOM_M > 5                         \n\t"
+        "vfncvt.f.f.v   v0,     v26             \n\t"
+        "vse.v          v0,     (t2)            \n\t"
+        "add            t2,     t2,     %[OHSTD]\n\t"
+        ".endif                                 \n\t"
+        ".if ATOM_M > 6                         \n\t"
+        "vfncvt.f.f.v   v0,     v28             \n\t"
+        "vse.v          v0,     (t2)            \n\t"
+        "add            t2,     t2,     %[OHSTD]\n\t"
+        ".endif                                 \n\t"
+        ".if ATOM_M > 7                         \n\t"
+        "vfncvt.f.f.v   v0,     v30             \n\t"
+        "vse.v          v0,     (t2)            \n\t"
+        "add            t2,     t2,     %[OHSTD]\n\t"
+        ".endif                                 \n\t"
+
+        :
+        : [ATOM_M] "i"(atom_m), [SRC] "r"(src), [FLT] "r"(flt), [DST] "r"(dst), [BIAS] "r"(bias), [IC] "r"(channels), [IHSTD] "r"(channels * 2), [OHSTD] "r"(num_outs * 2)
+        : "memory", "t0", "t1", "t2", "t3", "t4", "v0", "v8", "v9", "v10", "v11", "v12", "v13", "v14", "v15", "v16", "v17", "v18", "v19", "v20", "v21", "v22", "v23", "v24", "v25", "v26", "v27", "v28", "v29", "v30", "v31", "ft0", "ft1", "ft2", "ft3", "ft4", "ft5", "ft6", "ft7", "fa0", "fa1", "fa2", "fa3", "fa4", "fa5", "fa6", "fa7");
+}
+
 typedef void (*hgemm_n8chw_kernel_riscv_fp16_func)(const __fp16*, const __fp16*, const __fp16*, __fp16*, int32_t, int32_t);
 static const hgemm_n8chw_kernel_riscv_fp16_func hgemm_n8chw_mxn8_kernel_select[8]{
-    hgemm_n8chw_mxn8_riscv_fp16<1>,
-    hgemm_n8chw_mxn8_riscv_fp16<2>,
-    hgemm_n8chw_mxn8_riscv_fp16<3>,
-    hgemm_n8chw_mxn8_riscv_fp16<4>,
-    hgemm_n8chw_mxn8_riscv_fp16<5>,
-    hgemm_n8chw_mxn8_riscv_fp16<6>,
-    hgemm_n8chw_mxn8_riscv_fp16<7>,
-    hgemm_n8chw_mxn8_riscv_fp16<8>};
-
+    hgemm_n8chw_mxn8_riscv_fp16<1, true>,
+    hgemm_n8chw_mxn8_riscv_fp16<2, true>,
+    hgemm_n8chw_mxn8_riscv_fp16<3, true>,
+    hgemm_n8chw_mxn8_riscv_fp16<4, true>,
+    hgemm_n8chw_mxn8_riscv_fp16<5, true>,
+    hgemm_n8chw_mxn8_riscv_fp16<6, true>,
+    hgemm_n8chw_mxn8_riscv_fp16<7, true>,
+    hgemm_n8chw_mxn8_riscv_fp16<8, true>};
+static const hgemm_n8chw_kernel_riscv_fp16_func hgemm_n8chw_mxn8_acc_kernel_select[8]{
+    hgemm_n8chw_mxn8_riscv_fp16<1, false>,
+    hgemm_n8chw_mxn8_riscv_fp16<2, false>,
+    hgemm_n8chw_mxn8_riscv_fp16<3, false>,
+    hgemm_n8chw_mxn8_riscv_fp16<4, false>,
+    hgemm_n8chw_mxn8_riscv_fp16<5, false>,
+    hgemm_n8chw_mxn8_riscv_fp16<6, false>,
+    hgemm_n8chw_mxn8_riscv_fp16<7, false>,
+    hgemm_n8chw_mxn8_riscv_fp16<8, false>};
+static const hgemm_n8chw_kernel_riscv_fp16_func hgemm_n8chw_mxn8_fp32acc_kernel_select[8]{
+    hgemm_n8chw_mxn8_fp32acc_riscv_fp16<1>,
+    hgemm_n8chw_mxn8_fp32acc_riscv_fp16<2>,
+    hgemm_n8chw_mxn8_fp32acc_riscv_fp16<3>,
+    hgemm_n8chw_mxn8_fp32acc_riscv_fp16<4>,
+    hgemm_n8chw_mxn8_fp32acc_riscv_fp16<5>,
+    hgemm_n8chw_mxn8_fp32acc_riscv_fp16<6>,
+    hgemm_n8chw_mxn8_fp32acc_riscv_fp16<7>,
+    hgemm_n8chw_mxn8_fp32acc_riscv_fp16<8>};
+
+// first == false accumulates onto dst, used for all but the first k tile. fp32_acc runs one k tile only
+template <bool fp32_acc, bool first>
 void fc_n8chw_riscv_fp16(
     const __fp16* src,
     const __fp16* flt,
@@ -376,11 +709,13 @@ void fc_n8chw_riscv_fp16(
 {
     int32_t padded_channels = (channels + 8 - 1) / 8 * 8;
     int32_t padded_num_outs = (num_outs + 8 - 1) / 8 * 8;
+    auto kernel_select      = fp32_acc ? hgemm_n8chw_mxn8_fp32acc_kernel_select
+                                       : (first ? hgemm_n8chw_mxn8_kernel_select : hgemm_n8chw_mxn8_acc_kernel_select);
 
     for (int32_t oc = 0; oc < padded_num_outs; oc += 8) {
         int32_t bc = 0;
         for (; bc + 8 < batch; bc += 8) {
-            hgemm_n8chw_mxn8_kernel_select[7](
+            kernel_select[7](
                 src + padded_channels * bc,
                 flt + padded_channels * oc,
                 bias + oc,
@@ -390,7 +725,7 @@ void fc_n8chw_riscv_fp16(
                 padded_num_outs);
         }
         if (bc < batch) {
-            hgemm_n8chw_mxn8_kernel_select[batch - bc - 1](
+            kernel_select[batch - bc - 1](
                 src + padded_channels * bc,
                 flt + padded_channels * oc,
                 bias + oc,
@@ -404,9 +739,12 @@ void fc_n8chw_riscv_fp16(
 
 void fc_fp16_vec128_executor::cal_kernel_tunning_param()
 {
-    tunning_param_.m_blk = 16;
-    tunning_param_.n_blk = 16;
-    tunning_param_.k_blk = fc_param_->channels;
+    // k is blocked so that src and flt tiles of wide layers stay in cache.
+    // with fp32_acc k is not blocked, partial sums would be rounded to fp16 in dst between k tiles
+    tunning_param_.m_blk      = 16;
+    tunning_param_.n_blk      = 16;
+    tunning_param_.k_blk      = fp32_acc_ ? fc_param_->channels : 1024;
+    tunning_param_.num_thread = PPL_OMP_MAX_THREADS();
 }
 
 uint64_t fc_fp16_vec128_executor::cal_temp_buffer_size()
@@ -462,7 +800,8 @@ ppl::common::RetCode fc_fp16_vec128_executor::execute()
         fc_param_->channels,
         fc_param_->num_output,
         tunning_param_,
-        fc_n8chw_riscv_fp16);
+        fp32_acc_ ? fc_n8chw_riscv_fp16<true, true> : fc_n8chw_riscv_fp16<false, true>,
+        fp32_acc_ ? nullptr : fc_n8chw_riscv_fp16<false, false>); // k is not blocked with fp32_acc
 
     return common::RC_SUCCESS;
 }
@@ -499,7 +838,7 @@ ppl::common::RetCode fc_fp16_vec128_manager::gen_cvt_weights(const __fp16* filte
 
 fc_executor<__fp16>* fc_fp16_vec128_manager::gen_executor()
 {
-    return new fc_fp16_vec128_executor(&param_, cvt_filter_, cvt_bias_);
+    return new fc_fp16_vec128_executor(&param_, cvt_filter_, cvt_bias_, fp32_acc_);
 }
 
 }}}; // namespace ppl::kernel::riscv
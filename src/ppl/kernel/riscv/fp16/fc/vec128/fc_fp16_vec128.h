@@ -29,29 +29,35 @@ class fc_fp16_vec128_manager;
 
 class fc_fp16_vec128_executor final : public fc_executor<__fp16> {
 public:
-    fc_fp16_vec128_executor() {}
-    fc_fp16_vec128_executor(const fc_common_param* fc_param, const __fp16* cvt_filter, const __fp16* bias)
-        : fc_executor<__fp16>(fc_param, cvt_filter, bias) {}
+    fc_fp16_vec128_executor()
+        : fp32_acc_(false) {}
+    fc_fp16_vec128_executor(const fc_common_param* fc_param, const __fp16* cvt_filter, const __fp16* bias, bool fp32_acc = false)
+        : fc_executor<__fp16>(fc_param, cvt_filter, bias)
+        , fp32_acc_(fp32_acc) {}
     uint64_t cal_temp_buffer_size() override;
     ppl::common::RetCode prepare() override;
     ppl::common::RetCode execute() override;
 
 private:
     fc_tunning_param tunning_param_;
+    bool fp32_acc_;
     void cal_kernel_tunning_param();
     friend fc_fp16_vec128_manager;
 };
 
 class fc_fp16_vec128_manager final : public fc_manager<__fp16> {
 public:
-    fc_fp16_vec128_manager() {}
-    fc_fp16_vec128_manager(const fc_common_param& param, ppl::common::Allocator* allocator)
-        : fc_manager<__fp16>(param, allocator) {}
+    fc_fp16_vec128_manager()
+        : fp32_acc_(false) {}
+    fc_fp16_vec128_manager(const fc_common_param& param, ppl::common::Allocator* allocator, bool fp32_acc = false)
+        : fc_manager<__fp16>(param, allocator)
+        , fp32_acc_(fp32_acc) {}
     ppl::common::RetCode gen_cvt_weights(const __fp16* filter, const __fp16* bias) override;
     fc_executor<__fp16>* gen_executor() override;
 
 private:
     fc_tunning_param tunning_param_;
+    bool fp32_acc_; // accumulate in fp32, see fc_common_algo::standard_fp32acc
 };
 
 }}}; // namespace ppl::kernel::riscv
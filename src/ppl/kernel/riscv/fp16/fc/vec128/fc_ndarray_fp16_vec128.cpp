@@ -29,9 +29,10 @@ namespace ppl { namespace kernel { namespace riscv {
 
 
 void fc_ndarray_fp16_vec128_executor::cal_kernel_tunning_param() {
-    tunning_param_.m_blk = 7;
-    tunning_param_.n_blk = 32;
-    tunning_param_.k_blk = 128;
+    tunning_param_.m_blk      = 7;
+    tunning_param_.n_blk      = 32;
+    tunning_param_.k_blk      = 128;
+    tunning_param_.num_thread = PPL_OMP_MAX_THREADS();
 }
 
 uint64_t fc_ndarray_fp16_vec128_executor::cal_temp_buffer_size()
@@ -0,0 +1,205 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <riscv-vector.h>
+
+#include "ppl/kernel/riscv/common/gru/gru_ndarray_common.h"
+#include "ppl/kernel/riscv/common/vector_math/vector_math_kernel.h"
+#include "ppl/kernel/riscv/fp16/fc/vec128/kernel/fc_ndarray_kernel_fp16_vec128.h"
+
+namespace ppl { namespace kernel { namespace riscv {
+
+#define ATOM_N()     ((int64_t)8)
+#define ATOM_K()     ((int64_t)4)
+#define FLT_ATOM_N() ((int64_t)32)
+
+inline float32xm2_t gru_load_gate_fp16(const __fp16* x_gate, const __fp16* h_gate, const uint64_t vl)
+{
+    return vfaddvv_float32xm2(
+        vfwcvtffv_float32xm2_float16xm1(vlev_float16xm1(x_gate, vl), vl),
+        vfwcvtffv_float32xm2_float16xm1(vlev_float16xm1(h_gate, vl), vl),
+        vl);
+}
+
+inline void gru_reset_kernel_fp16(
+    const __fp16* x_gate,
+    const __fp16* h_gate,
+    const __fp16* h,
+    const int64_t hidden_size,
+    const int64_t i,
+    const uint64_t vl,
+    __fp16* rh)
+{
+    float32xm2_t rt = vfsigmoid_float32xm2(gru_load_gate_fp16(x_gate + hidden_size + i, h_gate + hidden_size + i, vl), vl);
+    float32xm2_t ht = vfwcvtffv_float32xm2_float16xm1(vlev_float16xm1(h + i, vl), vl);
+    vsev_float16xm1(rh + i, vfncvtffv_float16xm1_float32xm2(vfmulvv_float32xm2(rt, ht, vl), vl), vl);
+}
+
+static void gru_reset_fp16(
+    const __fp16* x_gate,
+    const __fp16* h_gate,
+    const __fp16* h,
+    const int64_t hidden_size,
+    __fp16* rh)
+{
+    const int64_t atom_c = 8;
+    const auto vl        = vsetvli(atom_c, RVV_E16, RVV_M1);
+
+    int64_t i = 0;
+    for (; i + atom_c <= hidden_size; i += atom_c) {
+        gru_reset_kernel_fp16(x_gate, h_gate, h, hidden_size, i, vl, rh);
+    }
+    if (i < hidden_size) {
+        const auto tail_vl = vsetvli(hidden_size - i, RVV_E16, RVV_M1);
+        gru_reset_kernel_fp16(x_gate, h_gate, h, hidden_size, i, tail_vl, rh);
+    }
+}
+
+template <bool linear_before_reset>
+inline void gru_cell_kernel_fp16(
+    const __fp16* x_gate,
+    const __fp16* h_gate,
+    const __fp16* hh,
+    const int64_t hidden_size,
+    const int64_t i,
+    const uint64_t vl,
+    __fp16* h)
+{
+    // gates are evaluated in fp32
+    float32xm2_t zt = gru_load_gate_fp16(x_gate + i, h_gate + i, vl);
+    float32xm2_t ht = vfwcvtffv_float32xm2_float16xm1(vlev_float16xm1(hh + i, vl), vl);
+    if (linear_before_reset) {
+        float32xm2_t rt = gru_load_gate_fp16(x_gate + hidden_size + i, h_gate + hidden_size + i, vl);
+        ht              = vfmulvv_float32xm2(vfsigmoid_float32xm2(rt, vl), ht, vl);
+    }
+    zt = vfsigmoid_float32xm2(zt, vl);
+    ht = vfaddvv_float32xm2(vfwcvtffv_float32xm2_float16xm1(vlev_float16xm1(x_gate + 2 * hidden_size + i, vl), vl), ht, vl);
+    ht = vftanh_float32xm2(ht, vl);
+
+    // (1 - z) * h~ + z * h_{t-1}
+    float32xm2_t h_prev = vfwcvtffv_float32xm2_float16xm1(vlev_float16xm1(h + i, vl), vl);
+    vsev_float16xm1(h + i, vfncvtffv_float16xm1_float32xm2(vfmaccvv_float32xm2(ht, zt, vfsubvv_float32xm2(h_prev, ht, vl), vl), vl), vl);
+}
+
+template <bool linear_before_reset>
+static void gru_cell_fp16(
+    const __fp16* x_gate,
+    const __fp16* h_gate,
+    const __fp16* hh,
+    const int64_t hidden_size,
+    __fp16* h)
+{
+    const int64_t atom_c = 8;
+    const auto vl        = vsetvli(atom_c, RVV_E16, RVV_M1);
+
+    int64_t i = 0;
+    for (; i + atom_c <= hidden_size; i += atom_c) {
+        gru_cell_kernel_fp16<linear_before_reset>(x_gate, h_gate, hh, hidden_size, i, vl, h);
+    }
+    if (i < hidden_size) {
+        const auto tail_vl = vsetvli(hidden_size - i, RVV_E16, RVV_M1);
+        gru_cell_kernel_fp16<linear_before_reset>(x_gate, h_gate, hh, hidden_size, i, tail_vl, h);
+    }
+}
+
+uint64_t gru_ndarray_get_packed_W_bytes_fp16(
+    const rnn_direction_t direction,
+    const int64_t hidden_size,
+    const int64_t input_size)
+{
+    return gru_ndarray_common_packed_w_size<__fp16, ATOM_K(), FLT_ATOM_N()>(direction, hidden_size, input_size);
+}
+
+ppl::common::RetCode gru_ndarray_pack_W_fp16(
+    const __fp16* W,
+    const rnn_direction_t direction,
+    const int64_t hidden_size,
+    const int64_t input_size,
+    __fp16* packed_W)
+{
+    gru_ndarray_common_pack_w<__fp16, ATOM_K(), FLT_ATOM_N()>(W, direction, hidden_size, input_size, packed_W);
+    return ppl::common::RC_SUCCESS;
+}
+
+uint64_t gru_ndarray_get_packed_R_bytes_fp16(
+    const rnn_direction_t direction,
+    const int64_t hidden_size)
+{
+    return gru_ndarray_common_packed_r_size<__fp16, ATOM_K(), FLT_ATOM_N()>(direction, hidden_size);
+}
+
+ppl::common::RetCode gru_ndarray_pack_R_fp16(
+    const __fp16* R,
+    const rnn_direction_t direction,
+    const int64_t hidden_size,
+    __fp16* packed_R)
+{
+    gru_ndarray_common_pack_r<__fp16, ATOM_K(), FLT_ATOM_N()>(R, direction, hidden_size, packed_R);
+    return ppl::common::RC_SUCCESS;
+}
+
+uint64_t gru_ndarray_get_buffer_bytes_fp16(
+    const ppl::common::TensorShape* X_shape,
+    const rnn_direction_t direction,
+    const int64_t hidden_size,
+    const bool has_Y_h,
+    const bool packed_W,
+    const bool packed_R)
+{
+    return gru_ndarray_common_temp_buffer_size<__fp16, ATOM_K(), FLT_ATOM_N()>(X_shape, direction, hidden_size, has_Y_h, packed_W, packed_R);
+}
+
+ppl::common::RetCode gru_ndarray_fp16(
+    const ppl::common::TensorShape* X_shape,
+    const __fp16* X,
+    const __fp16* W,
+    const __fp16* R,
+    const __fp16* bias,
+    const int32_t* sequence_lens,
+    const __fp16* initial_h,
+    const rnn_direction_t direction,
+    const int64_t hidden_size,
+    const bool linear_before_reset,
+    const bool packed_W,
+    const bool packed_R,
+    void* temp_buffer,
+    __fp16* Y,
+    __fp16* Y_h)
+{
+    return gru_ndarray_common_execute<__fp16, ATOM_N(), ATOM_K(), FLT_ATOM_N()>(
+        X_shape,
+        X,
+        W,
+        R,
+        bias,
+        sequence_lens,
+        initial_h,
+        direction,
+        hidden_size,
+        linear_before_reset,
+        packed_W,
+        packed_R,
+        temp_buffer,
+        fc_ndarray_select_gemm_kernel_fp16_vec128<true>,
+        fc_ndarray_select_gemm_kernel_fp16_vec128<false>,
+        gru_reset_fp16,
+        linear_before_reset ? gru_cell_fp16<true> : gru_cell_fp16<false>,
+        Y,
+        Y_h);
+}
+
+}}}; // namespace ppl::kernel::riscv
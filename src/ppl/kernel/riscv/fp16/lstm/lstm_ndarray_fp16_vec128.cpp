@@ -0,0 +1,190 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <riscv-vector.h>
+
+#include "ppl/kernel/riscv/common/lstm/lstm_ndarray_common.h"
+#include "ppl/kernel/riscv/common/vector_math/vector_math_kernel.h"
+#include "ppl/kernel/riscv/fp16/fc/vec128/kernel/fc_ndarray_kernel_fp16_vec128.h"
+
+namespace ppl { namespace kernel { namespace riscv {
+
+#define ATOM_N()     ((int64_t)8)
+#define ATOM_K()     ((int64_t)4)
+#define FLT_ATOM_N() ((int64_t)32)
+
+inline float32xm2_t lstm_load_gate_fp16(const __fp16* x_gate, const __fp16* h_gate, const uint64_t vl)
+{
+    return vfaddvv_float32xm2(
+        vfwcvtffv_float32xm2_float16xm1(vlev_float16xm1(x_gate, vl), vl),
+        vfwcvtffv_float32xm2_float16xm1(vlev_float16xm1(h_gate, vl), vl),
+        vl);
+}
+
+template <bool with_peephole>
+inline void lstm_cell_kernel_fp16(
+    const __fp16* x_gate,
+    const __fp16* h_gate,
+    const __fp16* P,
+    const int64_t hidden_size,
+    const int64_t i,
+    const uint64_t vl,
+    __fp16* c,
+    __fp16* h)
+{
+    const int64_t gi = 0 * hidden_size + i;
+    const int64_t go = 1 * hidden_size + i;
+    const int64_t gf = 2 * hidden_size + i;
+    const int64_t gc = 3 * hidden_size + i;
+
+    // gates and cell state are evaluated in fp32
+    float32xm2_t c_prev = vfwcvtffv_float32xm2_float16xm1(vlev_float16xm1(c + i, vl), vl);
+    float32xm2_t it     = lstm_load_gate_fp16(x_gate + gi, h_gate + gi, vl);
+    float32xm2_t ot     = lstm_load_gate_fp16(x_gate + go, h_gate + go, vl);
+    float32xm2_t ft     = lstm_load_gate_fp16(x_gate + gf, h_gate + gf, vl);
+    float32xm2_t ct     = lstm_load_gate_fp16(x_gate + gc, h_gate + gc, vl);
+    if (with_peephole) {
+        it = vfmaccvv_float32xm2(it, c_prev, vfwcvtffv_float32xm2_float16xm1(vlev_float16xm1(P + 0 * hidden_size + i, vl), vl), vl);
+        ft = vfmaccvv_float32xm2(ft, c_prev, vfwcvtffv_float32xm2_float16xm1(vlev_float16xm1(P + 2 * hidden_size + i, vl), vl), vl);
+    }
+    it = vfsigmoid_float32xm2(it, vl);
+    ft = vfsigmoid_float32xm2(ft, vl);
+    ct = vftanh_float32xm2(ct, vl);
+
+    float32xm2_t c_next = vfmaccvv_float32xm2(vfmulvv_float32xm2(ft, c_prev, vl), it, ct, vl);
+    if (with_peephole) {
+        ot = vfmaccvv_float32xm2(ot, c_next, vfwcvtffv_float32xm2_float16xm1(vlev_float16xm1(P + 1 * hidden_size + i, vl), vl), vl);
+    }
+    ot = vfsigmoid_float32xm2(ot, vl);
+
+    vsev_float16xm1(c + i, vfncvtffv_float16xm1_float32xm2(c_next, vl), vl);
+    vsev_float16xm1(h + i, vfncvtffv_float16xm1_float32xm2(vfmulvv_float32xm2(ot, vftanh_float32xm2(c_next, vl), vl), vl), vl);
+}
+
+template <bool with_peephole>
+static void lstm_cell_fp16(
+    const __fp16* x_gate,
+    const __fp16* h_gate,
+    const __fp16* P,
+    const int64_t hidden_size,
+    __fp16* c,
+    __fp16* h)
+{
+    const int64_t atom_c = 8;
+    const auto vl        = vsetvli(atom_c, RVV_E16, RVV_M1);
+
+    int64_t i = 0;
+    for (; i + atom_c <= hidden_size; i += atom_c) {
+        lstm_cell_kernel_fp16<with_peephole>(x_gate, h_gate, P, hidden_size, i, vl, c, h);
+    }
+    if (i < hidden_size) {
+        const auto tail_vl = vsetvli(hidden_size - i, RVV_E16, RVV_M1);
+        lstm_cell_kernel_fp16<with_peephole>(x_gate, h_gate, P, hidden_size, i, tail_vl, c, h);
+    }
+}
+
+uint64_t lstm_ndarray_get_packed_W_bytes_fp16(
+    const rnn_direction_t direction,
+    const int64_t hidden_size,
+    const int64_t input_size)
+{
+    return lstm_ndarray_common_packed_w_size<__fp16, ATOM_K(), FLT_ATOM_N()>(direction, hidden_size, input_size);
+}
+
+ppl::common::RetCode lstm_ndarray_pack_W_fp16(
+    const __fp16* W,
+    const rnn_direction_t direction,
+    const int64_t hidden_size,
+    const int64_t input_size,
+    __fp16* packed_W)
+{
+    lstm_ndarray_common_pack_w<__fp16, ATOM_K(), FLT_ATOM_N()>(W, direction, hidden_size, input_size, packed_W);
+    return ppl::common::RC_SUCCESS;
+}
+
+uint64_t lstm_ndarray_get_packed_R_bytes_fp16(
+    const rnn_direction_t direction,
+    const int64_t hidden_size)
+{
+    return lstm_ndarray_common_packed_w_size<__fp16, ATOM_K(), FLT_ATOM_N()>(direction, hidden_size, hidden_size);
+}
+
+ppl::common::RetCode lstm_ndarray_pack_R_fp16(
+    const __fp16* R,
+    const rnn_direction_t direction,
+    const int64_t hidden_size,
+    __fp16* packed_R)
+{
+    lstm_ndarray_common_pack_w<__fp16, ATOM_K(), FLT_ATOM_N()>(R, direction, hidden_size, hidden_size, packed_R);
+    return ppl::common::RC_SUCCESS;
+}
+
+uint64_t lstm_ndarray_get_buffer_bytes_fp16(
+    const ppl::common::TensorShape* X_shape,
+    const rnn_direction_t direction,
+    const int64_t hidden_size,
+    const bool has_Y_h,
+    const bool has_Y_c,
+    const bool packed_W,
+    const bool packed_R)
+{
+    return lstm_ndarray_common_temp_buffer_size<__fp16, ATOM_K(), FLT_ATOM_N()>(X_shape, direction, hidden_size, has_Y_h, has_Y_c, packed_W, packed_R);
+}
+
+ppl::common::RetCode lstm_ndarray_fp16(
+    const ppl::common::TensorShape* X_shape,
+    const __fp16* X,
+    const __fp16* W,
+    const __fp16* R,
+    const __fp16* P,
+    const __fp16* bias,
+    const int32_t* sequence_lens,
+    const __fp16* initial_h,
+    const __fp16* initial_c,
+    const rnn_direction_t direction,
+    const int64_t hidden_size,
+    const bool packed_W,
+    const bool packed_R,
+    void* temp_buffer,
+    __fp16* Y,
+    __fp16* Y_h,
+    __fp16* Y_c)
+{
+    return lstm_ndarray_common_execute<__fp16, ATOM_N(), ATOM_K(), FLT_ATOM_N()>(
+        X_shape,
+        X,
+        W,
+        R,
+        P,
+        bias,
+        sequence_lens,
+        initial_h,
+        initial_c,
+        direction,
+        hidden_size,
+        packed_W,
+        packed_R,
+        temp_buffer,
+        fc_ndarray_select_gemm_kernel_fp16_vec128<true>,
+        fc_ndarray_select_gemm_kernel_fp16_vec128<false>,
+        P ? lstm_cell_fp16<true> : lstm_cell_fp16<false>,
+        Y,
+        Y_h,
+        Y_c);
+}
+
+}}}; // namespace ppl::kernel::riscv
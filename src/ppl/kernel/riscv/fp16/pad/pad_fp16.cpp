@@ -0,0 +1,90 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/kernel/riscv/common/pad/pad_common.h"
+
+namespace ppl { namespace kernel { namespace riscv {
+
+ppl::common::RetCode pad_ndarray_constant_fp16(
+    const ppl::common::TensorShape* src_shape,
+    const ppl::common::TensorShape* dst_shape,
+    const __fp16* src,
+    const int64_t* start_pads,
+    const int64_t* end_pads,
+    const __fp16 constant_value,
+    __fp16* dst)
+{
+    return pad_ndarray_common<__fp16, PAD_MODE_CONSTANT>(src_shape, dst_shape, src, start_pads, end_pads, constant_value, dst);
+}
+
+ppl::common::RetCode pad_ndarray_reflect_fp16(
+    const ppl::common::TensorShape* src_shape,
+    const ppl::common::TensorShape* dst_shape,
+    const __fp16* src,
+    const int64_t* start_pads,
+    const int64_t* end_pads,
+    __fp16* dst)
+{
+    return pad_ndarray_common<__fp16, PAD_MODE_REFLECT>(src_shape, dst_shape, src, start_pads, end_pads, (__fp16)0, dst);
+}
+
+ppl::common::RetCode pad_ndarray_edge_fp16(
+    const ppl::common::TensorShape* src_shape,
+    const ppl::common::TensorShape* dst_shape,
+    const __fp16* src,
+    const int64_t* start_pads,
+    const int64_t* end_pads,
+    __fp16* dst)
+{
+    return pad_ndarray_common<__fp16, PAD_MODE_EDGE>(src_shape, dst_shape, src, start_pads, end_pads, (__fp16)0, dst);
+}
+
+ppl::common::RetCode pad_n8cx_constant_fp16(
+    const ppl::common::TensorShape* src_shape,
+    const ppl::common::TensorShape* dst_shape,
+    const __fp16* src,
+    const int64_t* start_pads,
+    const int64_t* end_pads,
+    const __fp16 constant_value,
+    __fp16* dst)
+{
+    return pad_nbcx_common<__fp16, PAD_MODE_CONSTANT>(src_shape, dst_shape, src, start_pads, end_pads, constant_value, 8, dst);
+}
+
+ppl::common::RetCode pad_n8cx_reflect_fp16(
+    const ppl::common::TensorShape* src_shape,
+    const ppl::common::TensorShape* dst_shape,
+    const __fp16* src,
+    const int64_t* start_pads,
+    const int64_t* end_pads,
+    __fp16* dst)
+{
+    return pad_nbcx_common<__fp16, PAD_MODE_REFLECT>(src_shape, dst_shape, src, start_pads, end_pads, (__fp16)0, 8, dst);
+}
+
+ppl::common::RetCode pad_n8cx_edge_fp16(
+    const ppl::common::TensorShape* src_shape,
+    const ppl::common::TensorShape* dst_shape,
+    const __fp16* src,
+    const int64_t* start_pads,
+    const int64_t* end_pads,
+    __fp16* dst)
+{
+    return pad_nbcx_common<__fp16, PAD_MODE_EDGE>(src_shape, dst_shape, src, start_pads, end_pads, (__fp16)0, 8, dst);
+}
+
+}}}; // namespace ppl::kernel::riscv
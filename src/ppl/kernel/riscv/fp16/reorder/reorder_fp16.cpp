@@ -0,0 +1,147 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <riscv-vector.h>
+
+#include "ppl/kernel/riscv/common/reorder/reorder_common.h"
+
+namespace ppl { namespace kernel { namespace riscv {
+
+static void reorder_ndarray_n8cx_block_fp16(const __fp16* src, const int64_t inner, const int64_t c_len, const int64_t i_len, __fp16* dst)
+{
+    const int64_t c_blk  = 8;
+    const int64_t stride = inner * sizeof(__fp16);
+    const auto vl        = vsetvli(c_blk, RVV_E16, RVV_M1);
+
+    if (c_len == c_blk) {
+        int64_t i = 0;
+        for (; i + 4 <= i_len; i += 4) {
+            vsev_float16xm1(dst + (i + 0) * c_blk, vlsev_float16xm1(src + i + 0, stride, vl), vl);
+            vsev_float16xm1(dst + (i + 1) * c_blk, vlsev_float16xm1(src + i + 1, stride, vl), vl);
+            vsev_float16xm1(dst + (i + 2) * c_blk, vlsev_float16xm1(src + i + 2, stride, vl), vl);
+            vsev_float16xm1(dst + (i + 3) * c_blk, vlsev_float16xm1(src + i + 3, stride, vl), vl);
+        }
+        for (; i < i_len; i++) {
+            vsev_float16xm1(dst + i * c_blk, vlsev_float16xm1(src + i, stride, vl), vl);
+        }
+    } else {
+        for (int64_t i = 0; i < i_len; i++) {
+            for (int64_t c = 0; c < c_blk; c++) {
+                dst[i * c_blk + c] = c < c_len ? src[c * inner + i] : (__fp16)0.0f;
+            }
+        }
+    }
+}
+
+static void reorder_n8cx_ndarray_block_fp16(const __fp16* src, const int64_t inner, const int64_t c_len, const int64_t i_len, __fp16* dst)
+{
+    const int64_t c_blk  = 8;
+    const int64_t stride = inner * sizeof(__fp16);
+    const auto vl        = vsetvli(c_len, RVV_E16, RVV_M1);
+
+    int64_t i = 0;
+    for (; i + 4 <= i_len; i += 4) {
+        vssev_float16xm1(dst + i + 0, stride, vlev_float16xm1(src + (i + 0) * c_blk, vl), vl);
+        vssev_float16xm1(dst + i + 1, stride, vlev_float16xm1(src + (i + 1) * c_blk, vl), vl);
+        vssev_float16xm1(dst + i + 2, stride, vlev_float16xm1(src + (i + 2) * c_blk, vl), vl);
+        vssev_float16xm1(dst + i + 3, stride, vlev_float16xm1(src + (i + 3) * c_blk, vl), vl);
+    }
+    for (; i < i_len; i++) {
+        vssev_float16xm1(dst + i, stride, vlev_float16xm1(src + i * c_blk, vl), vl);
+    }
+}
+
+static void reorder_n8cx_fp16_ndarray_fp32_block(const __fp16* src, const int64_t inner, const int64_t c_len, const int64_t i_len, float* dst)
+{
+    const int64_t c_blk  = 8;
+    const int64_t stride = inner * sizeof(float);
+    const auto vl        = vsetvli(c_len, RVV_E16, RVV_M1);
+
+    int64_t i = 0;
+    for (; i + 2 <= i_len; i += 2) {
+        vssev_float32xm2(dst + i + 0, stride, vfwcvtffv_float32xm2_float16xm1(vlev_float16xm1(src + (i + 0) * c_blk, vl), vl), vl);
+        vssev_float32xm2(dst + i + 1, stride, vfwcvtffv_float32xm2_float16xm1(vlev_float16xm1(src + (i + 1) * c_blk, vl), vl), vl);
+    }
+    for (; i < i_len; i++) {
+        vssev_float32xm2(dst + i, stride, vfwcvtffv_float32xm2_float16xm1(vlev_float16xm1(src + i * c_blk, vl), vl), vl);
+    }
+}
+
+// one n8cx block makes two n4cx blocks, the second one only exists for more than 4 channels
+static void reorder_n8cx_fp16_n4cx_fp32_block(const __fp16* src, const int64_t inner, const int64_t c_len, const int64_t i_len, float* dst)
+{
+    const int64_t src_c_blk = 8;
+    const int64_t dst_c_blk = 4;
+    const auto vl           = vsetvli(dst_c_blk, RVV_E16, RVV_M1);
+    float* dst_hi           = dst + dst_c_blk * inner;
+
+    if (c_len == src_c_blk) {
+        for (int64_t i = 0; i < i_len; i++) {
+            vsev_float32xm2(dst + i * dst_c_blk, vfwcvtffv_float32xm2_float16xm1(vlev_float16xm1(src + i * src_c_blk, vl), vl), vl);
+            vsev_float32xm2(dst_hi + i * dst_c_blk, vfwcvtffv_float32xm2_float16xm1(vlev_float16xm1(src + i * src_c_blk + dst_c_blk, vl), vl), vl);
+        }
+    } else {
+        // lanes at or beyond c_len are zeroed instead of taking the n8cx padding lanes
+        const auto lo_vl        = vsetvli(min(c_len, dst_c_blk), RVV_E16, RVV_M1);
+        const auto hi_vl        = vsetvli(max<int64_t>(c_len - dst_c_blk, 0), RVV_E16, RVV_M1);
+        const float32xm2_t zero = vfmvvf_float32xm2(0.0f, vl);
+        for (int64_t i = 0; i < i_len; i++) {
+            vsev_float32xm2(dst + i * dst_c_blk, zero, vl);
+            vsev_float32xm2(dst + i * dst_c_blk, vfwcvtffv_float32xm2_float16xm1(vlev_float16xm1(src + i * src_c_blk, lo_vl), lo_vl), lo_vl);
+        }
+        if (c_len > dst_c_blk) {
+            for (int64_t i = 0; i < i_len; i++) {
+                vsev_float32xm2(dst_hi + i * dst_c_blk, zero, vl);
+                vsev_float32xm2(dst_hi + i * dst_c_blk, vfwcvtffv_float32xm2_float16xm1(vlev_float16xm1(src + i * src_c_blk + dst_c_blk, hi_vl), hi_vl), hi_vl);
+            }
+        }
+    }
+}
+
+ppl::common::RetCode reorder_ndarray_n8cx_fp16(
+    const ppl::common::TensorShape* src_shape,
+    const __fp16* src,
+    __fp16* dst)
+{
+    return reorder_common<__fp16, __fp16, 1, 8>(src_shape, src, reorder_ndarray_n8cx_block_fp16, dst);
+}
+
+ppl::common::RetCode reorder_n8cx_ndarray_fp16(
+    const ppl::common::TensorShape* src_shape,
+    const __fp16* src,
+    __fp16* dst)
+{
+    return reorder_common<__fp16, __fp16, 8, 1>(src_shape, src, reorder_n8cx_ndarray_block_fp16, dst);
+}
+
+ppl::common::RetCode reorder_n8cx_fp16_ndarray_fp32(
+    const ppl::common::TensorShape* src_shape,
+    const __fp16* src,
+    float* dst)
+{
+    return reorder_common<__fp16, float, 8, 1>(src_shape, src, reorder_n8cx_fp16_ndarray_fp32_block, dst);
+}
+
+ppl::common::RetCode reorder_n8cx_fp16_n4cx_fp32(
+    const ppl::common::TensorShape* src_shape,
+    const __fp16* src,
+    float* dst)
+{
+    return reorder_common<__fp16, float, 8, 4>(src_shape, src, reorder_n8cx_fp16_n4cx_fp32_block, dst);
+}
+
+}}}; // namespace ppl::kernel::riscv
@@ -17,6 +17,7 @@
 
 #include <math.h>
 #include <vector>
+#include <riscv-vector.h>
 
 #include "ppl/kernel/riscv/common/internal_include.h"
 #include "ppl/kernel/riscv/common/resize2d/resize2d_ndarray_common.h"
@@ -24,6 +25,24 @@
 
 namespace ppl { namespace kernel { namespace riscv {
 
+// rows are accumulated in fp32, vectors run along the dst width
+static void resize2d_ndarray_vertical_fp16(
+    const float* const* rows,
+    const float* coeff,
+    const int64_t num_taps,
+    const int64_t width,
+    __fp16* dst)
+{
+    for (int64_t i = 0; i < width; i += 8) {
+        const auto vl    = vsetvli(width - i, RVV_E32, RVV_M2);
+        float32xm2_t acc = vfmulvf_float32xm2(vlev_float32xm2(rows[0] + i, vl), coeff[0], vl);
+        for (int64_t k = 1; k < num_taps; ++k) {
+            acc = vfmaccvf_float32xm2(acc, coeff[k], vlev_float32xm2(rows[k] + i, vl), vl);
+        }
+        vsev_float16xm1(dst + i, vfncvtffv_float16xm1_float32xm2(acc, vl), vl);
+    }
+}
+
 ppl::common::RetCode resize2d_ndarray_pytorch_linear_floor_fp16(
     const ppl::common::TensorShape* src_shape,
     const ppl::common::TensorShape* dst_shape,
@@ -32,7 +51,7 @@ ppl::common::RetCode resize2d_ndarray_pytorch_linear_floor_fp16(
     const float scale_w,
     __fp16* dst)
 {
-    return resize2d_ndarray_pytorch_linear_floor_common<__fp16>(src_shape, dst_shape, src, scale_h, scale_w, dst);
+    return resize2d_ndarray_pytorch_linear_floor_common<__fp16>(src_shape, dst_shape, src, scale_h, scale_w, resize2d_ndarray_vertical_fp16, dst);
 }
 
 ppl::common::RetCode resize2d_ndarray_asymmetric_nearest_floor_fp16(
@@ -55,7 +74,7 @@ ppl::common::RetCode resize2d_ndarray_pytorch_cubic_floor_fp16(
     const float cubic_coeff_a,
     __fp16* dst)
 {
-    return resize2d_ndarray_pytorch_cubic_floor_common<__fp16>(src_shape, dst_shape, src, scale_h, scale_w, cubic_coeff_a, dst);
+    return resize2d_ndarray_pytorch_cubic_floor_common<__fp16>(src_shape, dst_shape, src, scale_h, scale_w, cubic_coeff_a, resize2d_ndarray_vertical_fp16, dst);
 }
 
 ppl::common::RetCode resize2d_nbcx_pytorch_linear_floor_fp16(
@@ -0,0 +1,117 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <math.h>
+#include <riscv-vector.h>
+
+#include "ppl/kernel/riscv/common/internal_include.h"
+
+namespace ppl { namespace kernel { namespace riscv {
+
+#define C_BLK() ((int64_t)8)
+
+static inline float32xm2_t rmsnorm_load_fp16(const __fp16* src, const uint64_t vl)
+{
+    return vfwcvtffv_float32xm2_float16xm1(vlev_float16xm1(src, vl), vl);
+}
+
+// 1 / sqrt(mean(x²) + eps) of one row, accumulated in fp32 -- precision-tuning
+static inline float rmsnorm_row_rrms_fp16(const __fp16* src, const int64_t len, const float eps)
+{
+    const auto vl = vsetvli(C_BLK(), RVV_E16, RVV_M1);
+
+    float32xm2_t vsqr = vfmvvf_float32xm2(0.0f, vl);
+    int64_t i         = 0;
+    for (; i + C_BLK() <= len; i += C_BLK()) {
+        const float32xm2_t x = rmsnorm_load_fp16(src + i, vl);
+        vsqr                 = vfmaccvv_float32xm2(vsqr, x, x, vl);
+    }
+
+    float sqr_data[C_BLK()];
+    vsev_float32xm2(sqr_data, vsqr, vl);
+    float sqr = 0.0f;
+    for (int64_t k = 0; k < C_BLK(); k++) {
+        sqr += sqr_data[k];
+    }
+    for (; i < len; i++) {
+        const float x = (float)src[i];
+        sqr += x * x;
+    }
+
+    return 1.0f / sqrtf(sqr / len + eps);
+}
+
+template <bool has_scale>
+static void rmsnorm_ndarray_kernel_fp16(
+    const __fp16* src,
+    const __fp16* scale,
+    const int64_t outer_dim,
+    const int64_t inner_dim,
+    const float eps,
+    __fp16* dst)
+{
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t o = 0; o < outer_dim; o++) {
+        const __fp16* src_ = src + o * inner_dim;
+        __fp16* dst_       = dst + o * inner_dim;
+
+        const float rrms = rmsnorm_row_rrms_fp16(src_, inner_dim, eps);
+
+        for (int64_t i = 0; i < inner_dim; i += C_BLK()) {
+            const auto vl  = vsetvli(inner_dim - i, RVV_E16, RVV_M1);
+            float32xm2_t y = vfmulvf_float32xm2(rmsnorm_load_fp16(src_ + i, vl), rrms, vl);
+            if (has_scale) y = vfmulvv_float32xm2(y, rmsnorm_load_fp16(scale + i, vl), vl);
+            vsev_float16xm1(dst_ + i, vfncvtffv_float16xm1_float32xm2(y, vl), vl);
+        }
+    }
+}
+
+ppl::common::RetCode rmsnorm_ndarray_fp16(
+    const ppl::common::TensorShape* src_shape,
+    const __fp16* src,
+    const __fp16* scale,
+    const int64_t axis,
+    const float eps,
+    __fp16* dst)
+{
+    const int64_t dim_count = src_shape->GetDimCount();
+    const int64_t real_axis = axis < 0 ? axis + dim_count : axis;
+    if (real_axis < 0 || real_axis >= dim_count) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+
+    int64_t outer_dim = 1;
+    int64_t inner_dim = 1;
+    for (int64_t i = 0; i < real_axis; i++) {
+        outer_dim *= src_shape->GetDim(i);
+    }
+    for (int64_t i = real_axis; i < dim_count; i++) {
+        inner_dim *= src_shape->GetDim(i);
+    }
+    if (inner_dim == 0) {
+        return ppl::common::RC_SUCCESS;
+    }
+
+    if (scale) {
+        rmsnorm_ndarray_kernel_fp16<true>(src, scale, outer_dim, inner_dim, eps, dst);
+    } else {
+        rmsnorm_ndarray_kernel_fp16<false>(src, scale, outer_dim, inner_dim, eps, dst);
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+}}}; // namespace ppl::kernel::riscv
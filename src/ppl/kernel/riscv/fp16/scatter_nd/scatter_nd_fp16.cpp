@@ -15,10 +15,39 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <riscv-vector.h>
+
 #include "ppl/kernel/riscv/common/scatter_nd/scatter_nd_common.h"
 
 namespace ppl { namespace kernel { namespace riscv {
 
+static void scatter_nd_apply_fp16(const __fp16 *updates, const int64_t len, const int32_t reduction, __fp16 *dst)
+{
+    for (int64_t i = 0; i < len;) {
+        const auto vl        = vsetvli(len - i, RVV_E16, RVV_M4);
+        const float16xm4_t u = vlev_float16xm4(updates + i, vl);
+        float16xm4_t r       = u;
+        switch (reduction) {
+            case SCATTER_REDUCTION_ADD:
+                r = vfaddvv_float16xm4(vlev_float16xm4(dst + i, vl), u, vl);
+                break;
+            case SCATTER_REDUCTION_MUL:
+                r = vfmulvv_float16xm4(vlev_float16xm4(dst + i, vl), u, vl);
+                break;
+            case SCATTER_REDUCTION_MAX:
+                r = vfmaxvv_float16xm4(vlev_float16xm4(dst + i, vl), u, vl);
+                break;
+            case SCATTER_REDUCTION_MIN:
+                r = vfminvv_float16xm4(vlev_float16xm4(dst + i, vl), u, vl);
+                break;
+            default:
+                break;
+        }
+        vsev_float16xm4(dst + i, r, vl);
+        i += vl;
+    }
+}
+
 ppl::common::RetCode scatter_nd_ndarray_fp16(
     const __fp16 *src,
     const __fp16 *updates,
@@ -28,6 +57,7 @@ ppl::common::RetCode scatter_nd_ndarray_fp16(
     const int64_t inner_dim,
     const int64_t num_indices,
     const int64_t indices_dim,
+    const int32_t reduction,
     __fp16 *dst)
 {
     return scatter_nd_ndarray_common<__fp16>(
@@ -39,6 +69,32 @@ ppl::common::RetCode scatter_nd_ndarray_fp16(
         inner_dim,
         num_indices,
         indices_dim,
+        reduction,
+        scatter_nd_apply_fp16,
+        dst);
+}
+
+ppl::common::RetCode scatter_nd_ndarray_fp16(
+    const __fp16 *src,
+    const __fp16 *updates,
+    const int64_t *indices,
+    const int32_t *strides,
+    const int64_t src_length,
+    const int64_t inner_dim,
+    const int64_t num_indices,
+    const int64_t indices_dim,
+    __fp16 *dst)
+{
+    return scatter_nd_ndarray_fp16(
+        src,
+        updates,
+        indices,
+        strides,
+        src_length,
+        inner_dim,
+        num_indices,
+        indices_dim,
+        SCATTER_REDUCTION_NONE,
         dst);
 }
 
@@ -15,32 +15,15 @@
 // specific language governing permissions and limitations
 // under the License.
 
-#include <math.h>
-
 #include "ppl/kernel/riscv/common/internal_include.h"
+#include "ppl/kernel/riscv/common/vector_math/vector_math_kernel.h"
 
 namespace ppl { namespace kernel { namespace riscv {
 
 ppl::common::RetCode sigmoid_fp16(const ppl::common::TensorShape* x_shape, const __fp16* x, __fp16* y)
 {
-    const int64_t n_elem   = x_shape->CalcElementsIncludingPadding();
-    const int64_t n_unroll = 8;
-
-    int64_t i = 0;
-    for (; i <= n_elem - n_unroll; i += n_unroll) {
-        y[i + 0] = 1.0f / (expf(-(float)x[i + 0]) + 1.0f);
-        y[i + 1] = 1.0f / (expf(-(float)x[i + 1]) + 1.0f);
-        y[i + 2] = 1.0f / (expf(-(float)x[i + 2]) + 1.0f);
-        y[i + 3] = 1.0f / (expf(-(float)x[i + 3]) + 1.0f);
-        y[i + 4] = 1.0f / (expf(-(float)x[i + 4]) + 1.0f);
-        y[i + 5] = 1.0f / (expf(-(float)x[i + 5]) + 1.0f);
-        y[i + 6] = 1.0f / (expf(-(float)x[i + 6]) + 1.0f);
-        y[i + 7] = 1.0f / (expf(-(float)x[i + 7]) + 1.0f);
-    }
-    for (; i < n_elem; ++i) {
-        y[i] = 1.0f / (expf(-(float)x[i]) + 1.0f);
-    }
-
+    const int64_t n_elem = x_shape->CalcElementsIncludingPadding();
+    vector_math_unary_fp16<vfsigmoid_float16xm1>(x, y, n_elem);
     return ppl::common::RC_SUCCESS;
 }
 
@@ -0,0 +1,33 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/kernel/riscv/common/internal_include.h"
+#include "ppl/kernel/riscv/common/activation/activation_kernel.h"
+
+namespace ppl { namespace kernel { namespace riscv {
+
+ppl::common::RetCode silu_fp16(
+    const ppl::common::TensorShape* x_shape,
+    const __fp16* x,
+    __fp16* y)
+{
+    const int64_t n_elem = x_shape->CalcElementsIncludingPadding();
+    vector_math_unary_fp16<vfsilu<__fp16, 128>>(x, y, n_elem);
+    return ppl::common::RC_SUCCESS;
+}
+
+}}}; // namespace ppl::kernel::riscv
@@ -15,19 +15,237 @@
 // specific language governing permissions and limitations
 // under the License.
 
-#include <cmath>
+#include <cfloat>
+#include <cstring>
 #include <riscv-vector.h>
 
 #include "ppl/kernel/riscv/common/internal_include.h"
+#include "ppl/kernel/riscv/common/vector_math/vector_math_kernel.h"
 
 namespace ppl { namespace kernel { namespace riscv {
 
+#define C_BLK() ((int64_t)8)
+
+// online softmax, same scheme as fp32: the running max and sum are kept in fp32 -- precision-tuning
+static inline float32xm2_t softmax_load_fp16(const __fp16* src, const uint64_t vl)
+{
+    return vfwcvtffv_float32xm2_float16xm1(vlev_float16xm1(src, vl), vl);
+}
+
+static inline void softmax_online_update4_fp16(
+    const float32xm2_t x0,
+    const float32xm2_t x1,
+    const float32xm2_t x2,
+    const float32xm2_t x3,
+    float32xm2_t* vmax,
+    float32xm2_t* vsum,
+    const uint64_t vl)
+{
+    const float32xm2_t new_max = vfmaxvv_float32xm2(
+        vfmaxvv_float32xm2(*vmax, vfmaxvv_float32xm2(x0, x1, vl), vl), vfmaxvv_float32xm2(x2, x3, vl), vl);
+    float32xm2_t sum = vfmulvv_float32xm2(*vsum, vfexp_float32xm2(vfsubvv_float32xm2(*vmax, new_max, vl), vl), vl);
+    sum              = vfaddvv_float32xm2(sum, vfexp_float32xm2(vfsubvv_float32xm2(x0, new_max, vl), vl), vl);
+    sum              = vfaddvv_float32xm2(sum, vfexp_float32xm2(vfsubvv_float32xm2(x1, new_max, vl), vl), vl);
+    sum              = vfaddvv_float32xm2(sum, vfexp_float32xm2(vfsubvv_float32xm2(x2, new_max, vl), vl), vl);
+    sum              = vfaddvv_float32xm2(sum, vfexp_float32xm2(vfsubvv_float32xm2(x3, new_max, vl), vl), vl);
+    *vmax            = new_max;
+    *vsum            = sum;
+}
+
+static inline void softmax_online_update1_fp16(
+    const float32xm2_t x,
+    float32xm2_t* vmax,
+    float32xm2_t* vsum,
+    const uint64_t vl)
+{
+    const float32xm2_t new_max = vfmaxvv_float32xm2(*vmax, x, vl);
+    const float32xm2_t sum     = vfmulvv_float32xm2(*vsum, vfexp_float32xm2(vfsubvv_float32xm2(*vmax, new_max, vl), vl), vl);
+    *vsum                      = vfaddvv_float32xm2(sum, vfexp_float32xm2(vfsubvv_float32xm2(x, new_max, vl), vl), vl);
+    *vmax                      = new_max;
+}
+
+static inline void softmax_online_merge_lanes_fp16(
+    const float32xm2_t vmax,
+    const float32xm2_t vsum,
+    const uint64_t vl,
+    float* fmax,
+    float* recp_sum)
+{
+    float max_data[C_BLK()];
+    float sum_data[C_BLK()];
+    vsev_float32xm2(max_data, vmax, vl);
+    float max_val = max_data[0];
+    for (int64_t k = 1; k < C_BLK(); k++) {
+        max_val = max_data[k] > max_val ? max_data[k] : max_val;
+    }
+    vsev_float32xm2(sum_data, vfmulvv_float32xm2(vsum, vfexp_float32xm2(vfsubvf_float32xm2(vmax, max_val, vl), vl), vl), vl);
+    float sum = 0.0f;
+    for (int64_t k = 0; k < C_BLK(); k++) {
+        sum += sum_data[k];
+    }
+    *fmax     = max_val;
+    *recp_sum = 1.0f / sum;
+}
+
+static inline void softmax_fill_tail_fp16(__fp16* tail, const __fp16* src, const int64_t num)
+{
+    for (int64_t k = 0; k < C_BLK(); k++) {
+        tail[k] = (__fp16)(-65504.0f);
+    }
+    memcpy(tail, src, num * sizeof(__fp16));
+}
+
+static void softmax_contiguous_fp16(const __fp16* src, __fp16* dst, const int64_t len)
+{
+    const auto vl = vsetvli(C_BLK(), RVV_E16, RVV_M1);
+
+    float32xm2_t vmax = vfmvvf_float32xm2(-FLT_MAX, vl);
+    float32xm2_t vsum = vfmvvf_float32xm2(0.0f, vl);
+    int64_t i         = 0;
+    for (; i + 4 * C_BLK() <= len; i += 4 * C_BLK()) {
+        softmax_online_update4_fp16(
+            softmax_load_fp16(src + i + 0 * C_BLK(), vl),
+            softmax_load_fp16(src + i + 1 * C_BLK(), vl),
+            softmax_load_fp16(src + i + 2 * C_BLK(), vl),
+            softmax_load_fp16(src + i + 3 * C_BLK(), vl),
+            &vmax,
+            &vsum,
+            vl);
+    }
+    for (; i + C_BLK() <= len; i += C_BLK()) {
+        softmax_online_update1_fp16(softmax_load_fp16(src + i, vl), &vmax, &vsum, vl);
+    }
+    if (i < len) {
+        __fp16 tail[C_BLK()];
+        softmax_fill_tail_fp16(tail, src + i, len - i);
+        softmax_online_update1_fp16(softmax_load_fp16(tail, vl), &vmax, &vsum, vl);
+    }
+
+    float fmax, recp_sum;
+    softmax_online_merge_lanes_fp16(vmax, vsum, vl, &fmax, &recp_sum);
+
+    for (i = 0; i < len; i += C_BLK()) {
+        const auto tail_vl   = vsetvli(len - i, RVV_E16, RVV_M1);
+        const float32xm2_t e = vfexp_float32xm2(vfsubvf_float32xm2(softmax_load_fp16(src + i, tail_vl), fmax, tail_vl), tail_vl);
+        vsev_float16xm1(dst + i, vfncvtffv_float16xm1_float32xm2(vfmulvf_float32xm2(e, recp_sum, tail_vl), tail_vl), tail_vl);
+    }
+}
+
+static void softmax_strided_fp16(
+    const __fp16* src,
+    __fp16* dst,
+    const int64_t axis_dim,
+    const int64_t inner_dim,
+    const uint64_t vl)
+{
+    float32xm2_t vmax = vfmvvf_float32xm2(-FLT_MAX, vl);
+    float32xm2_t vsum = vfmvvf_float32xm2(0.0f, vl);
+    int64_t a         = 0;
+    for (; a + 4 <= axis_dim; a += 4) {
+        softmax_online_update4_fp16(
+            softmax_load_fp16(src + (a + 0) * inner_dim, vl),
+            softmax_load_fp16(src + (a + 1) * inner_dim, vl),
+            softmax_load_fp16(src + (a + 2) * inner_dim, vl),
+            softmax_load_fp16(src + (a + 3) * inner_dim, vl),
+            &vmax,
+            &vsum,
+            vl);
+    }
+    for (; a < axis_dim; a++) {
+        softmax_online_update1_fp16(softmax_load_fp16(src + a * inner_dim, vl), &vmax, &vsum, vl);
+    }
+
+    const float32xm2_t vrecp_sum = vfrdivvf_float32xm2(vsum, 1.0f, vl);
+    for (a = 0; a < axis_dim; a++) {
+        const float32xm2_t e = vfexp_float32xm2(vfsubvv_float32xm2(softmax_load_fp16(src + a * inner_dim, vl), vmax, vl), vl);
+        vsev_float16xm1(dst + a * inner_dim, vfncvtffv_float16xm1_float32xm2(vfmulvv_float32xm2(e, vrecp_sum, vl), vl), vl);
+    }
+}
+
+static void softmax_outer_axis_inner_fp16(
+    const __fp16* src,
+    __fp16* dst,
+    const int64_t outer_dim,
+    const int64_t axis_dim,
+    const int64_t inner_dim)
+{
+    if (inner_dim == 1) {
+        PRAGMA_OMP_PARALLEL_FOR()
+        for (int64_t i = 0; i < outer_dim; i++) {
+            softmax_contiguous_fp16(src + i * axis_dim, dst + i * axis_dim, axis_dim);
+        }
+        return;
+    }
+
+    const int64_t num_inner_blk = div_up(inner_dim, C_BLK());
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t t = 0; t < outer_dim * num_inner_blk; t++) {
+        const int64_t i      = t / num_inner_blk;
+        const int64_t j      = (t % num_inner_blk) * C_BLK();
+        const auto vl        = vsetvli(inner_dim - j, RVV_E16, RVV_M1);
+        const int64_t offset = i * axis_dim * inner_dim + j;
+        softmax_strided_fp16(src + offset, dst + offset, axis_dim, inner_dim, vl);
+    }
+}
+
+static void softmax_n8cx_channel_fp16(
+    const __fp16* src,
+    __fp16* dst,
+    const int64_t channels,
+    const int64_t blk_stride)
+{
+    const auto vl         = vsetvli(C_BLK(), RVV_E16, RVV_M1);
+    const int64_t full_bc = channels / C_BLK();
+    const int64_t tail_c  = channels - full_bc * C_BLK();
+
+    float32xm2_t vmax = vfmvvf_float32xm2(-FLT_MAX, vl);
+    float32xm2_t vsum = vfmvvf_float32xm2(0.0f, vl);
+    int64_t bc        = 0;
+    for (; bc + 4 <= full_bc; bc += 4) {
+        softmax_online_update4_fp16(
+            softmax_load_fp16(src + (bc + 0) * blk_stride, vl),
+            softmax_load_fp16(src + (bc + 1) * blk_stride, vl),
+            softmax_load_fp16(src + (bc + 2) * blk_stride, vl),
+            softmax_load_fp16(src + (bc + 3) * blk_stride, vl),
+            &vmax,
+            &vsum,
+            vl);
+    }
+    for (; bc < full_bc; bc++) {
+        softmax_online_update1_fp16(softmax_load_fp16(src + bc * blk_stride, vl), &vmax, &vsum, vl);
+    }
+    if (tail_c > 0) {
+        __fp16 tail[C_BLK()];
+        softmax_fill_tail_fp16(tail, src + full_bc * blk_stride, tail_c);
+        softmax_online_update1_fp16(softmax_load_fp16(tail, vl), &vmax, &vsum, vl);
+    }
+
+    float fmax, recp_sum;
+    softmax_online_merge_lanes_fp16(vmax, vsum, vl, &fmax, &recp_sum);
+
+    for (bc = 0; bc < full_bc; bc++) {
+        const float32xm2_t e = vfexp_float32xm2(vfsubvf_float32xm2(softmax_load_fp16(src + bc * blk_stride, vl), fmax, vl), vl);
+        vsev_float16xm1(dst + bc * blk_stride, vfncvtffv_float16xm1_float32xm2(vfmulvf_float32xm2(e, recp_sum, vl), vl), vl);
+    }
+    if (tail_c > 0) {
+        // padded channels are written as 0
+        __fp16 tail[C_BLK()];
+        const float32xm2_t e = vfexp_float32xm2(vfsubvf_float32xm2(softmax_load_fp16(src + full_bc * blk_stride, vl), fmax, vl), vl);
+        vsev_float16xm1(tail, vfncvtffv_float16xm1_float32xm2(vfmulvf_float32xm2(e, recp_sum, vl), vl), vl);
+        for (int64_t k = tail_c; k < C_BLK(); k++) {
+            tail[k] = (__fp16)0.0f;
+        }
+        memcpy(dst + full_bc * blk_stride, tail, C_BLK() * sizeof(__fp16));
+    }
+}
+
 ppl::common::RetCode softmax_ndarray_fp16(
     const ppl::common::TensorShape* shape,
     const int64_t axis,
     const __fp16* src,
     __fp16* dst)
 {
+    // opset < 13: dims from axis on are flattened into one row
     int64_t outer_dim = 1;
     int64_t inner_dim = 1;
     for (int64_t i = 0; i < axis; i++) {
@@ -37,37 +255,81 @@ ppl::common::RetCode softmax_ndarray_fp16(
         inner_dim *= shape->GetDim(i);
     }
 
-    const auto vl = vsetvli(8, RVV_E16, RVV_M1);
+    softmax_outer_axis_inner_fp16(src, dst, outer_dim, inner_dim, 1);
+    return ppl::common::RC_SUCCESS;
+}
 
-    for (int64_t i = 0; i < outer_dim; i++) {
-        const __fp16* src_ = src + i * inner_dim;
-        __fp16* dst_       = dst + i * inner_dim;
-        // find max
-        float16xm1_t vfmax = vfmvvf_float16xm1(-__FLT_MAX__, vl);
-        __fp16 fmax        = (__fp16)(-__FLT_MAX__);
-        int64_t j          = 0;
-        for (; j + 8 < inner_dim; j += 8) {
-            vfmax = vfmaxvv_float16xm1(vfmax, vlev_float16xm1(src_ + j, vl), vl);
-        }
-        for (; j < inner_dim; j++) {
-            fmax = std::max(fmax, src_[j]);
-        }
-        __fp16 max_data[8];
-        vsev_float16xm1(max_data, vfmax, vl);
-        for (int64_t k = 0; k < 8; k++) {
-            fmax = std::max(fmax, max_data[k]);
+ppl::common::RetCode softmax13_ndarray_fp16(
+    const ppl::common::TensorShape* shape,
+    const int64_t axis,
+    const __fp16* src,
+    __fp16* dst)
+{
+    const int64_t dim_count = shape->GetDimCount();
+    const int64_t real_axis = axis < 0 ? axis + dim_count : axis;
+    if (real_axis < 0 || real_axis >= dim_count) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+
+    int64_t outer_dim = 1;
+    int64_t inner_dim = 1;
+    for (int64_t i = 0; i < real_axis; i++) {
+        outer_dim *= shape->GetDim(i);
+    }
+    for (int64_t i = real_axis + 1; i < dim_count; i++) {
+        inner_dim *= shape->GetDim(i);
+    }
+
+    softmax_outer_axis_inner_fp16(src, dst, outer_dim, shape->GetDim(real_axis), inner_dim);
+    return ppl::common::RC_SUCCESS;
+}
+
+ppl::common::RetCode softmax13_n8cx_fp16(
+    const ppl::common::TensorShape* shape,
+    const int64_t axis,
+    const __fp16* src,
+    __fp16* dst)
+{
+    const int64_t dim_count = shape->GetDimCount();
+    const int64_t real_axis = axis < 0 ? axis + dim_count : axis;
+    if (dim_count < 2 || real_axis < 0 || real_axis >= dim_count) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+
+    const int64_t batch    = shape->GetDim(0);
+    const int64_t channels = shape->GetDim(1);
+    const int64_t pad_c    = round_up(channels, C_BLK());
+    int64_t hw             = 1;
+    for (int64_t i = 2; i < dim_count; i++) {
+        hw *= shape->GetDim(i);
+    }
+
+    if (real_axis == 1) {
+        PRAGMA_OMP_PARALLEL_FOR()
+        for (int64_t t = 0; t < batch * hw; t++) {
+            const int64_t n      = t / hw;
+            const int64_t offset = n * pad_c * hw + (t % hw) * C_BLK();
+            softmax_n8cx_channel_fp16(src + offset, dst + offset, channels, hw * C_BLK());
         }
-        // Σ(exp(src - max)) -- precision-tuning
-        float sum = 0.0f;
-        for (j = 0; j < inner_dim; j++) {
-            sum += exp((float)src_[j] - fmax);
+        return ppl::common::RC_SUCCESS;
+    }
+
+    // any other axis keeps channels in lanes: view n8cx as [n, c / 8, d2, ..., 8]
+    int64_t outer_dim = 1;
+    int64_t inner_dim = C_BLK();
+    if (real_axis > 0) {
+        outer_dim = batch * pad_c / C_BLK();
+        for (int64_t i = 2; i < real_axis; i++) {
+            outer_dim *= shape->GetDim(i);
         }
-        float recp_sum = (double)1.0 / sum;
-        // final result
-        for (j = 0; j < inner_dim; j++) {
-            dst_[j] = (__fp16)(exp((float)src_[j] - fmax) * recp_sum);
+        for (int64_t i = real_axis + 1; i < dim_count; i++) {
+            inner_dim *= shape->GetDim(i);
         }
+    } else {
+        inner_dim = pad_c * hw;
     }
+
+    softmax_outer_axis_inner_fp16(src, dst, outer_dim, shape->GetDim(real_axis), inner_dim);
     return ppl::common::RC_SUCCESS;
 }
 
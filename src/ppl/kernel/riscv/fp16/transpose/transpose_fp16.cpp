@@ -15,10 +15,46 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <riscv-vector.h>
+
 #include "ppl/kernel/riscv/common/transpose/transpose_common.h"
 
 namespace ppl { namespace kernel { namespace riscv {
 
+// each dst column segment is gathered with one strided load, 8 src columns are in flight at a time
+static void transpose_tile_fp16(
+    const __fp16* src,
+    const int64_t src_ld,
+    const int64_t rows,
+    const int64_t cols,
+    const int64_t dst_ld,
+    __fp16* dst)
+{
+    const int64_t atom       = 8;
+    const int64_t src_stride = src_ld * sizeof(__fp16);
+
+    for (int64_t r = 0; r < rows; r += atom) {
+        const auto vl     = vsetvli(rows - r, RVV_E16, RVV_M1);
+        const __fp16* src_p = src + r * src_ld;
+        __fp16* dst_p       = dst + r;
+
+        int64_t c = 0;
+        for (; c + atom <= cols; c += atom) {
+            vsev_float16xm1(dst_p + (c + 0) * dst_ld, vlsev_float16xm1(src_p + c + 0, src_stride, vl), vl);
+            vsev_float16xm1(dst_p + (c + 1) * dst_ld, vlsev_float16xm1(src_p + c + 1, src_stride, vl), vl);
+            vsev_float16xm1(dst_p + (c + 2) * dst_ld, vlsev_float16xm1(src_p + c + 2, src_stride, vl), vl);
+            vsev_float16xm1(dst_p + (c + 3) * dst_ld, vlsev_float16xm1(src_p + c + 3, src_stride, vl), vl);
+            vsev_float16xm1(dst_p + (c + 4) * dst_ld, vlsev_float16xm1(src_p + c + 4, src_stride, vl), vl);
+            vsev_float16xm1(dst_p + (c + 5) * dst_ld, vlsev_float16xm1(src_p + c + 5, src_stride, vl), vl);
+            vsev_float16xm1(dst_p + (c + 6) * dst_ld, vlsev_float16xm1(src_p + c + 6, src_stride, vl), vl);
+            vsev_float16xm1(dst_p + (c + 7) * dst_ld, vlsev_float16xm1(src_p + c + 7, src_stride, vl), vl);
+        }
+        for (; c < cols; c++) {
+            vsev_float16xm1(dst_p + c * dst_ld, vlsev_float16xm1(src_p + c, src_stride, vl), vl);
+        }
+    }
+}
+
 ppl::common::RetCode transpose_ndarray_fp16(
     const __fp16* src,
     __fp16* dst,
@@ -27,7 +63,7 @@ ppl::common::RetCode transpose_ndarray_fp16(
     const ppl::common::TensorShape* src_shape,
     const ppl::common::TensorShape* dst_shape)
 {
-    return transpose_ndarray<__fp16>(src, dst, perm, src_shape, dst_shape);
+    return transpose_ndarray<__fp16>(src, dst, perm, src_shape, dst_shape, transpose_tile_fp16);
 }
 
 ppl::common::RetCode transpose_ndarray_continous2d_fp16(
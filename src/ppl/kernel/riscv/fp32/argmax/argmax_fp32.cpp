@@ -15,17 +15,80 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <riscv-vector.h>
+
 #include "ppl/kernel/riscv/common/argmax/argmax_common.h"
 
 namespace ppl { namespace kernel { namespace riscv {
 
+// chunks without a better element are skipped with one vector compare, the rare improving chunk is rescanned
+template <bool is_min>
+static int64_t argmax_line_fp32(const float* src, const int64_t len)
+{
+    float best  = src[0];
+    int64_t idx = 0;
+    for (int64_t i = 1; i < len;) {
+        const auto vl         = vsetvli(len - i, RVV_E32, RVV_M4);
+        const float32xm4_t v  = vlev_float32xm4(src + i, vl);
+        const e32xm4_t better = is_min ? vmfltvf_e32xm4_float32xm4(v, best, vl) : vmfgtvf_e32xm4_float32xm4(v, best, vl);
+        const int64_t first   = vmfirstm_e32xm4(better, vl);
+        if (first >= 0) {
+            for (int64_t k = i + first; k < i + (int64_t)vl; k++) {
+                if (is_min ? src[k] < best : src[k] > best) {
+                    best = src[k];
+                    idx  = k;
+                }
+            }
+        }
+        i += vl;
+    }
+    return idx;
+}
+
+template <bool is_min>
+static void argmax_columns_fp32(const float* src, const int64_t argmax_dim, const int64_t inner_dim, const int64_t width, int64_t* dst)
+{
+    float best[ARGMAX_INNER_BLK()];
+    uint32_t idx[ARGMAX_INNER_BLK()];
+    for (int64_t j = 0; j < width;) {
+        const auto vl = vsetvli(width - j, RVV_E32, RVV_M2);
+        vsev_float32xm2(best + j, vlev_float32xm2(src + j, vl), vl);
+        vsev_uint32xm2(idx + j, vmvvx_uint32xm2(0, vl), vl);
+        j += vl;
+    }
+    for (int64_t k = 1; k < argmax_dim; k++) {
+        const float* src_k = src + k * inner_dim;
+        for (int64_t j = 0; j < width;) {
+            const auto vl         = vsetvli(width - j, RVV_E32, RVV_M2);
+            const float32xm2_t v  = vlev_float32xm2(src_k + j, vl);
+            const float32xm2_t b  = vlev_float32xm2(best + j, vl);
+            const e32xm2_t better = is_min ? vmfltvv_e32xm2_float32xm2(v, b, vl) : vmfgtvv_e32xm2_float32xm2(v, b, vl);
+            vsev_float32xm2(best + j, is_min ? vfminvv_float32xm2(b, v, vl) : vfmaxvv_float32xm2(b, v, vl), vl);
+            vsev_mask_uint32xm2(idx + j, vmvvx_uint32xm2(k, vl), better, vl);
+            j += vl;
+        }
+    }
+    for (int64_t j = 0; j < width; j++) {
+        dst[j] = idx[j];
+    }
+}
+
 ppl::common::RetCode argmax_ndarray_fp32(
     const ppl::common::TensorShape* src_shape,
     const float* src,
     const int64_t axis,
     int64_t* dst)
 {
-    return argmax_ndarray<float>(src_shape, src, axis, dst);
+    return argmax_ndarray_common<float>(src_shape, src, axis, argmax_line_fp32<false>, argmax_columns_fp32<false>, dst);
+}
+
+ppl::common::RetCode argmin_ndarray_fp32(
+    const ppl::common::TensorShape* src_shape,
+    const float* src,
+    const int64_t axis,
+    int64_t* dst)
+{
+    return argmax_ndarray_common<float>(src_shape, src, axis, argmax_line_fp32<true>, argmax_columns_fp32<true>, dst);
 }
 
 }}}; // namespace ppl::kernel::riscv
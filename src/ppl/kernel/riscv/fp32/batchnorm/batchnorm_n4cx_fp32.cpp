@@ -0,0 +1,89 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <riscv-vector.h>
+
+#include "ppl/kernel/riscv/common/batchnorm/batchnorm_common.h"
+
+namespace ppl { namespace kernel { namespace riscv {
+
+#define C_BLK() ((int64_t)4)
+
+template <bool with_relu>
+static void batchnorm_n4cx_kernel_fp32(
+    const float* src,
+    const float* a,
+    const float* b,
+    const int64_t batch,
+    const int64_t pad_c,
+    const int64_t inner_dim,
+    float* dst)
+{
+    const auto vl           = vsetvli(C_BLK(), RVV_E32, RVV_M1);
+    const int64_t num_c_blk = pad_c / C_BLK();
+
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t nc = 0; nc < batch * num_c_blk; nc++) {
+        const int64_t c       = (nc % num_c_blk) * C_BLK();
+        const float32xm1_t va = vlev_float32xm1(a + c, vl);
+        const float32xm1_t vb = vlev_float32xm1(b + c, vl);
+        const float* src_     = src + nc * inner_dim * C_BLK();
+        float* dst_           = dst + nc * inner_dim * C_BLK();
+
+        for (int64_t i = 0; i < inner_dim; i++) {
+            float32xm1_t y = vfaddvv_float32xm1(vfmulvv_float32xm1(vlev_float32xm1(src_ + i * C_BLK(), vl), va, vl), vb, vl);
+            if (with_relu) y = vfmaxvf_float32xm1(y, 0.0f, vl);
+            vsev_float32xm1(dst_ + i * C_BLK(), y, vl);
+        }
+    }
+}
+
+ppl::common::RetCode batchnorm_n4cx_fp32(
+    const ppl::common::TensorShape* src_shape,
+    const float* src,
+    const float* mean,
+    const float* variance,
+    const float* scale,
+    const float* shift,
+    const float var_eps,
+    const bool relu,
+    float* dst)
+{
+    const int64_t dim_count = src_shape->GetDimCount();
+    if (dim_count < 2) {
+        return ppl::common::RC_UNSUPPORTED;
+    }
+    const int64_t batch    = src_shape->GetDim(0);
+    const int64_t channels = src_shape->GetDim(1);
+    const int64_t pad_c    = round_up(channels, C_BLK());
+    int64_t inner_dim      = 1;
+    for (int64_t i = 2; i < dim_count; i++) {
+        inner_dim *= src_shape->GetDim(i);
+    }
+
+    std::vector<float> a, b;
+    batchnorm_fold_param_common<float>(mean, variance, scale, shift, var_eps, channels, pad_c, a, b);
+
+    if (relu) {
+        batchnorm_n4cx_kernel_fp32<true>(src, a.data(), b.data(), batch, pad_c, inner_dim, dst);
+    } else {
+        batchnorm_n4cx_kernel_fp32<false>(src, a.data(), b.data(), batch, pad_c, inner_dim, dst);
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+}}}; // namespace ppl::kernel::riscv
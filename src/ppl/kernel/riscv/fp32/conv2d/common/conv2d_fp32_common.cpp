@@ -36,7 +36,13 @@ using namespace ppl::common;
 
 namespace ppl { namespace kernel { namespace riscv {
 
-conv2d_common_algo_info conv2d_fp32_algo_selector::select_best_algo(const void* filter, ppl::common::TensorShape& src_shape, ppl::common::TensorShape& dst_shape, const conv2d_common_param& param, Allocator* allocator, uint32_t winograd_level)
+static bool conv2d_fp32_use_fp16_weight(const conv2d_common_param& param, uint32_t weight_level)
+{
+    // fp16 cvt filter is only laid out for a single group
+    return ppl::kernel::riscv::FP32_WEIGHT_FP16 == weight_level && param.group == 1;
+}
+
+conv2d_common_algo_info conv2d_fp32_algo_selector::select_best_algo(const void* filter, ppl::common::TensorShape& src_shape, ppl::common::TensorShape& dst_shape, const conv2d_common_param& param, Allocator* allocator, uint32_t winograd_level, uint32_t weight_level)
 {
     static conv2d_common_algo_info unknown_info =
         {conv2d_common_algo::unknown, DATAFORMAT_UNKNOWN, DATAFORMAT_UNKNOWN, DATATYPE_FLOAT32, DATATYPE_FLOAT32};
@@ -62,7 +68,11 @@ conv2d_common_algo_info conv2d_fp32_algo_selector::select_best_algo(const void*
         }
     } else if (DATAFORMAT_N4CX == src_shape.GetDataFormat()) {
         for (auto algo_info : n4cx_algo_info_lst) {
-            if (algo_info.algo_type == conv2d_common_algo::winograd_b2f3) {
+            if (algo_info.algo_type == conv2d_common_algo::tile_gemm) {
+                if (conv2d_fp32_use_fp16_weight(param, weight_level)) {
+                    algo_info.algo_type = conv2d_common_algo::tile_gemm_fp16w;
+                }
+            } else if (algo_info.algo_type == conv2d_common_algo::winograd_b2f3) {
                 if ((ppl::kernel::riscv::WG_ON != winograd_level && ppl::kernel::riscv::WG_ON_B2 != winograd_level) ||
                     param.kernel_h != 3 || param.kernel_w != 3 || param.stride_h != 1 || param.stride_w != 1 ||
                     param.dilation_h != 1 || param.dilation_w != 1) {
@@ -81,7 +91,7 @@ conv2d_common_algo_info conv2d_fp32_algo_selector::select_best_algo(const void*
                     continue;
                 }
             } else if (algo_info.algo_type == conv2d_common_algo::gemm) {
-                if (param.dilation_h != 1 || param.dilation_w != 1) {
+                if (param.dilation_h != 1 || param.dilation_w != 1 || conv2d_fp32_use_fp16_weight(param, weight_level)) {
                     continue;
                 }
             }
@@ -122,14 +132,15 @@ conv2d_common_algo_info conv2d_fp32_algo_selector::select_best_algo(const void*
 
     LOG(DEBUG) << "select best fp32 conv algo " << best_algo_info.algo_type;
     if (best_algo_info.algo_type == conv2d_common_algo::unknown) {
-        best_algo_info = select_algo(src_shape, param, winograd_level);
+        best_algo_info = select_algo(src_shape, param, winograd_level, weight_level);
     }
     return best_algo_info;
 }
 
 conv2d_common_algo_info conv2d_fp32_algo_selector::select_algo(const ppl::common::TensorShape& input_shape,
                                                                const conv2d_common_param& param,
-                                                               uint32_t winograd_level)
+                                                               uint32_t winograd_level,
+                                                               uint32_t weight_level)
 {
     LOG(DEBUG) << "RISCV FP32 CONV select algo";
 
@@ -143,6 +154,9 @@ conv2d_common_algo_info conv2d_fp32_algo_selector::select_algo(const ppl::common
     }
 
     if (DATAFORMAT_N4CX == input_shape.GetDataFormat()) {
+        if (conv2d_fp32_use_fp16_weight(param, weight_level)) {
+            return {conv2d_common_algo::tile_gemm_fp16w, DATAFORMAT_N4CX, DATAFORMAT_N4CX, DATATYPE_FLOAT32, DATATYPE_FLOAT32};
+        }
         if (param.group == 1 && param.kernel_h == 1 && param.kernel_w == 1 &&
             param.pad_h == 0 && param.pad_w == 0 &&
             param.stride_h == 1 && param.stride_w == 1 &&
@@ -192,7 +206,8 @@ conv2d_offline_manager<float>* conv2d_fp32_algo_selector::gen_algo(const conv2d_
         conv_mgr = new conv2d_ndarray_tile_gemm_fp32_offline_manager(param, algo_info, allocator);
     }
 
-    if (conv2d_common_algo::tile_gemm == algo_info.algo_type &&
+    if ((conv2d_common_algo::tile_gemm == algo_info.algo_type ||
+         conv2d_common_algo::tile_gemm_fp16w == algo_info.algo_type) &&
         DATAFORMAT_N4CX == algo_info.input_format &&
         DATAFORMAT_N4CX == algo_info.output_format) {
         conv_mgr = new conv2d_n4cx_tile_gemm_fp32_offline_manager(param, algo_info, allocator);
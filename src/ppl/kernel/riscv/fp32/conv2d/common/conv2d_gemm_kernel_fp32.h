@@ -19,6 +19,7 @@
 #define __ST_PPL_KERNEL_RISCV_FP32_CONV2D_COMMON_CONV2D_GEMM_KERNEL_FP32_H_
 
 #include "ppl/kernel/riscv/fp32/conv2d/common/gemm_kernel/conv2d_n4cx_n4cx_gemm_kernel_fp32_vec128.h"
+#include "ppl/kernel/riscv/fp32/conv2d/common/gemm_kernel/conv2d_n4cx_n4cx_gemm_kernel_fp16w_fp32_vec128.h"
 #include "ppl/kernel/riscv/fp32/conv2d/common/gemm_kernel/conv2d_ndarray_n4cx_gemm_kernel_fp32_vec128.h"
 
 namespace ppl { namespace kernel { namespace riscv {
@@ -31,6 +32,14 @@ typedef void (*conv2d_gemm_kernel_func_riscv_fp32_type_t)(
     const int64_t n,
     const int64_t k);
 
+typedef void (*conv2d_gemm_fp16w_kernel_func_riscv_fp32_type_t)(
+    const __fp16* A,
+    const float* B,
+    float* C,
+    const int64_t m,
+    const int64_t n,
+    const int64_t k);
+
 template <bool first>
 conv2d_gemm_kernel_func_riscv_fp32_type_t conv2d_gemm_select_cto4c_kernel_fp32_vec128(int64_t m, int64_t n)
 {
@@ -196,6 +205,44 @@ conv2d_gemm_kernel_func_riscv_fp32_type_t conv2d_gemm_select_xcto4c_kernel_fp32_
     }
 }
 
+// m must be a multiple of 8, the fp16 filter is padded to 8 output channels
+static inline conv2d_gemm_fp16w_kernel_func_riscv_fp32_type_t conv2d_gemm_select_4cto4c_fp16w_kernel_fp32_vec128(int64_t m, int64_t n)
+{
+    switch (m % 16) {
+        case 8:
+            switch (n % 6) {
+                case 0:
+                    return gemm_n4cx_n4cx_fp16w_fp32_vec128<16, 6, 8, 6>;
+                case 1:
+                    return gemm_n4cx_n4cx_fp16w_fp32_vec128<16, 6, 8, 1>;
+                case 2:
+                    return gemm_n4cx_n4cx_fp16w_fp32_vec128<16, 6, 8, 2>;
+                case 3:
+                    return gemm_n4cx_n4cx_fp16w_fp32_vec128<16, 6, 8, 3>;
+                case 4:
+                    return gemm_n4cx_n4cx_fp16w_fp32_vec128<16, 6, 8, 4>;
+                default:
+                    return gemm_n4cx_n4cx_fp16w_fp32_vec128<16, 6, 8, 5>;
+            }
+        case 0:
+            switch (n % 6) {
+                case 0:
+                    return gemm_n4cx_n4cx_fp16w_fp32_vec128<16, 6, 16, 6>;
+                case 1:
+                    return gemm_n4cx_n4cx_fp16w_fp32_vec128<16, 6, 16, 1>;
+                case 2:
+                    return gemm_n4cx_n4cx_fp16w_fp32_vec128<16, 6, 16, 2>;
+                case 3:
+                    return gemm_n4cx_n4cx_fp16w_fp32_vec128<16, 6, 16, 3>;
+                case 4:
+                    return gemm_n4cx_n4cx_fp16w_fp32_vec128<16, 6, 16, 4>;
+                default:
+                    return gemm_n4cx_n4cx_fp16w_fp32_vec128<16, 6, 16, 5>;
+            }
+    }
+    return gemm_n4cx_n4cx_fp16w_fp32_vec128<16, 6, 16, 6>;
+}
+
 }}}; // namespace ppl::kernel::riscv
 
 #endif
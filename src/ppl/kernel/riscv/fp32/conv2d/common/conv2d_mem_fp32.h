@@ -19,6 +19,10 @@
 #define __ST_PPL_KERNEL_RISCV_FP32_CONV2D_COMMON_CONV2D_MEM_FP32_H_
 
 #include <riscv-vector.h>
+#include <float.h>
+
+#include "ppl/kernel/riscv/common/conv2d.h"
+#include "ppl/kernel/riscv/common/math.h"
 
 namespace ppl { namespace kernel { namespace riscv {
 
@@ -114,6 +118,113 @@ void conv2d_n4cx_mem_dst_blk_trans_fp32_vec128(
     }
 }
 
+// conv rows/cols [beg, end) covered by pooling window `o`. a window lying entirely in padding is moved onto
+// the nearest valid row/col unless `keep_empty`, so max and average-exclude pooling never reduce an empty window.
+static inline void conv2d_pool_get_window_range(
+    int64_t o,
+    int64_t stride,
+    int64_t pad,
+    int64_t kernel,
+    int64_t size,
+    bool keep_empty,
+    int64_t* beg,
+    int64_t* end)
+{
+    *beg = max<int64_t>(o * stride - pad, 0);
+    *end = min<int64_t>(o * stride - pad + kernel, size);
+    if (!keep_empty) {
+        *beg = min<int64_t>(*beg, size - 1);
+        *end = max<int64_t>(*end, *beg + 1);
+    }
+}
+
+// pool conv output rows which are still in cache and write pooled rows [dst_h_beg, dst_h_end) only.
+// conv row `ih` of the first channel block is located at conv_rows[ih - conv_h_beg],
+// following channel blocks are conv_rows_c_stride[ih - conv_h_beg] elements away.
+template <bool with_relu>
+void conv2d_n4cx_mem_dst_rows_pool_fp32_vec128(
+    const float* const* conv_rows,
+    const int64_t* conv_rows_c_stride,
+    int64_t conv_h_beg,
+    int64_t conv_h,
+    int64_t conv_w,
+
+    float* dst,
+    int64_t dst_h,
+    int64_t dst_w,
+    int64_t dst_h_beg,
+    int64_t dst_h_end,
+
+    int64_t real_dst_blk_m,
+    const conv2d_common_pool_param* pool_param,
+    const float* bias)
+{
+    const int64_t atom_c   = 4;
+    const auto vl          = vsetvli(atom_c, RVV_E32, RVV_M1);
+    const bool is_max_pool = pool_param->pool_type == conv2d_pool_type::MAX;
+    const bool keep_empty  = pool_param->pool_type == conv2d_pool_type::AVERAGE_INCLUDE;
+    const int64_t kernel_h = pool_param->kernel_h;
+    const int64_t kernel_w = pool_param->kernel_w;
+    const int64_t stride_h = pool_param->stride_h;
+    const int64_t stride_w = pool_param->stride_w;
+    const int64_t pad_h    = pool_param->pad_h;
+    const int64_t pad_w    = pool_param->pad_w;
+
+    float32xm1_t _vzero = vfmvvf_float32xm1(0.f, vl);
+
+    for (int64_t mi = 0; mi < real_dst_blk_m; mi += atom_c) {
+        const int64_t c_blk_idx = mi / atom_c;
+        float32xm1_t _vbias     = vlev_float32xm1(bias + mi, vl);
+        float* dst_c_blk        = dst + mi * dst_h * dst_w;
+
+        for (int64_t oh = dst_h_beg; oh < dst_h_end; oh += 1) {
+            int64_t ih_beg, ih_end;
+            conv2d_pool_get_window_range(oh, stride_h, pad_h, kernel_h, conv_h, keep_empty, &ih_beg, &ih_end);
+            float* dst_row = dst_c_blk + oh * dst_w * atom_c;
+
+            for (int64_t ow = 0; ow < dst_w; ow += 1) {
+                int64_t iw_beg, iw_end;
+                conv2d_pool_get_window_range(ow, stride_w, pad_w, kernel_w, conv_w, keep_empty, &iw_beg, &iw_end);
+
+                float32xm1_t _vacc;
+                if (is_max_pool) {
+                    // the window is never empty, start from its first element
+                    _vacc = vlev_float32xm1(conv_rows[ih_beg - conv_h_beg] + c_blk_idx * conv_rows_c_stride[ih_beg - conv_h_beg] + iw_beg * atom_c, vl);
+                    for (int64_t ih = ih_beg; ih < ih_end; ih += 1) {
+                        const float* row = conv_rows[ih - conv_h_beg] + c_blk_idx * conv_rows_c_stride[ih - conv_h_beg];
+                        for (int64_t iw = iw_beg; iw < iw_end; iw += 1) {
+                            _vacc = vfmaxvv_float32xm1(_vacc, vlev_float32xm1(row + iw * atom_c, vl), vl);
+                        }
+                    }
+                    // bias and relu are monotonic, apply them on the max only
+                    _vacc = vfaddvv_float32xm1(_vacc, _vbias, vl);
+                    if (with_relu) {
+                        _vacc = vfmaxvv_float32xm1(_vacc, _vzero, vl);
+                    }
+                } else {
+                    _vacc = _vzero;
+                    for (int64_t ih = ih_beg; ih < ih_end; ih += 1) {
+                        const float* row = conv_rows[ih - conv_h_beg] + c_blk_idx * conv_rows_c_stride[ih - conv_h_beg];
+                        for (int64_t iw = iw_beg; iw < iw_end; iw += 1) {
+                            float32xm1_t _v = vfaddvv_float32xm1(vlev_float32xm1(row + iw * atom_c, vl), _vbias, vl);
+                            if (with_relu) {
+                                _v = vfmaxvv_float32xm1(_v, _vzero, vl);
+                            }
+                            _vacc = vfaddvv_float32xm1(_vacc, _v, vl);
+                        }
+                    }
+                    int64_t win_size = kernel_h * kernel_w;
+                    if (pool_param->pool_type == conv2d_pool_type::AVERAGE_EXCLUDE) {
+                        win_size = (ih_end - ih_beg) * (iw_end - iw_beg);
+                    }
+                    _vacc = vfmulvf_float32xm1(_vacc, 1.0f / win_size, vl);
+                }
+                vsev_float32xm1(dst_row + ow * atom_c, _vacc, vl);
+            }
+        }
+    }
+}
+
 }}}; // namespace ppl::kernel::riscv
 
 #endif // #define __ST_PPL_KERNEL_RISCV_FP32_CONV2D_COMMON_CONV2D_MEM_FP32_H_
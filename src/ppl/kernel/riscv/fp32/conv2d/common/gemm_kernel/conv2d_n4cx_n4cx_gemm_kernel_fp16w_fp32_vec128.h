@@ -0,0 +1,408 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_PPL_KERNEL_RISCV_FP32_CONV2D_COMMON_GEMM_KERNEL_CONV2D_GEMM_KERNEL_N4CX_N4CX_FP16W_FP32_H_
+#define __ST_PPL_KERNEL_RISCV_FP32_CONV2D_COMMON_GEMM_KERNEL_CONV2D_GEMM_KERNEL_N4CX_N4CX_FP16W_FP32_H_
+
+#include <cstdint>
+namespace ppl { namespace kernel { namespace riscv {
+
+// A is the fp16 filter stored as [m / 8][k][8], widened to fp32 with vfwcvt before each k step,
+// B and C are fp32 n4cx as in gemm_n4cx_n4cx_fp32_vec128. k must be a multiple of 4.
+template <int64_t m, int64_t n>
+static void gemm_kernel_m16n6_n4cx_n4cx_fp16w_fp32_vec128(
+    const __fp16* a,
+    const float* b,
+    float* c,
+    const int64_t total_m,
+    const int64_t total_n,
+    const int64_t total_k)
+{
+    asm volatile(
+        ".equ            ATOM_M, %c[ATOM_M]         \n\t"
+        ".equ            ATOM_N, %c[ATOM_N]         \n\t"
+        "addi            t0, zero, 8                \n\t"
+        "addi            t1, zero, 4                \n\t"
+        "vsetvli         t2, t1, e32                \n\t"
+        "mv              s2, %[A_LOC]               \n\t"
+        "mv              s3, %[B_LOC]               \n\t"
+        "mv              s4, %[C_LOC]               \n\t"
+        "mv              s5, %[K]                   \n\t"
+        ".if ATOM_M > 8                             \n\t"
+        "add             s6, s2, %[A_NXT_LINE_STRIDE]\n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_M > 0                             \n\t"
+        ".if ATOM_N > 0                             \n\t"
+        "vmv.v.i         v8, 0                      \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 1                             \n\t"
+        "vmv.v.i         v9, 0                      \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 2                             \n\t"
+        "vmv.v.i         v10, 0                     \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 3                             \n\t"
+        "vmv.v.i         v11, 0                     \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 4                             \n\t"
+        "vmv.v.i         v12, 0                     \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 5                             \n\t"
+        "vmv.v.i         v13, 0                     \n\t"
+        ".endif                                     \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_M > 4                             \n\t"
+        ".if ATOM_N > 0                             \n\t"
+        "vmv.v.i         v14, 0                     \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 1                             \n\t"
+        "vmv.v.i         v15, 0                     \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 2                             \n\t"
+        "vmv.v.i         v16, 0                     \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 3                             \n\t"
+        "vmv.v.i         v17, 0                     \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 4                             \n\t"
+        "vmv.v.i         v18, 0                     \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 5                             \n\t"
+        "vmv.v.i         v19, 0                     \n\t"
+        ".endif                                     \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_M > 8                             \n\t"
+        ".if ATOM_N > 0                             \n\t"
+        "vmv.v.i         v20, 0                     \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 1                             \n\t"
+        "vmv.v.i         v21, 0                     \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 2                             \n\t"
+        "vmv.v.i         v22, 0                     \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 3                             \n\t"
+        "vmv.v.i         v23, 0                     \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 4                             \n\t"
+        "vmv.v.i         v24, 0                     \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 5                             \n\t"
+        "vmv.v.i         v25, 0                     \n\t"
+        ".endif                                     \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_M > 12                            \n\t"
+        ".if ATOM_N > 0                             \n\t"
+        "vmv.v.i         v26, 0                     \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 1                             \n\t"
+        "vmv.v.i         v27, 0                     \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 2                             \n\t"
+        "vmv.v.i         v28, 0                     \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 3                             \n\t"
+        "vmv.v.i         v29, 0                     \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 4                             \n\t"
+        "vmv.v.i         v30, 0                     \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 5                             \n\t"
+        "vmv.v.i         v31, 0                     \n\t"
+        ".endif                                     \n\t"
+        ".endif                                     \n\t"
+
+        "1:                                         \n\t" // loop k
+        ".irp KK, 0, 1, 2, 3                        \n\t"
+        "vsetvli         t2, t0, e16                \n\t"
+        "vle.v           v4, (s2)                   \n\t"
+        "addi            s2, s2, 16                 \n\t"
+        ".if ATOM_M > 8                             \n\t"
+        "vle.v           v5, (s6)                   \n\t"
+        "addi            s6, s6, 16                 \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 0                             \n\t"
+        "flw             f0, \\KK*4+0(s3)           \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 1                             \n\t"
+        "flw             f1, \\KK*4+16(s3)          \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 2                             \n\t"
+        "flw             f2, \\KK*4+32(s3)          \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 3                             \n\t"
+        "flw             f3, \\KK*4+48(s3)          \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 4                             \n\t"
+        "flw             f4, \\KK*4+64(s3)          \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 5                             \n\t"
+        "flw             f5, \\KK*4+80(s3)          \n\t"
+        ".endif                                     \n\t"
+        "vfwcvt.f.f.v    v0, v4                     \n\t"
+        ".if ATOM_M > 8                             \n\t"
+        "vfwcvt.f.f.v    v2, v5                     \n\t"
+        ".endif                                     \n\t"
+        "vsetvli         t2, t1, e32                \n\t"
+        ".if ATOM_M > 0                             \n\t"
+        ".if ATOM_N > 0                             \n\t"
+        "vfmacc.vf       v8, f0, v0                 \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 1                             \n\t"
+        "vfmacc.vf       v9, f1, v0                 \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 2                             \n\t"
+        "vfmacc.vf       v10, f2, v0                \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 3                             \n\t"
+        "vfmacc.vf       v11, f3, v0                \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 4                             \n\t"
+        "vfmacc.vf       v12, f4, v0                \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 5                             \n\t"
+        "vfmacc.vf       v13, f5, v0                \n\t"
+        ".endif                                     \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_M > 4                             \n\t"
+        ".if ATOM_N > 0                             \n\t"
+        "vfmacc.vf       v14, f0, v1                \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 1                             \n\t"
+        "vfmacc.vf       v15, f1, v1                \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 2                             \n\t"
+        "vfmacc.vf       v16, f2, v1                \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 3                             \n\t"
+        "vfmacc.vf       v17, f3, v1                \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 4                             \n\t"
+        "vfmacc.vf       v18, f4, v1                \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 5                             \n\t"
+        "vfmacc.vf       v19, f5, v1                \n\t"
+        ".endif                                     \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_M > 8                             \n\t"
+        ".if ATOM_N > 0                             \n\t"
+        "vfmacc.vf       v20, f0, v2                \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 1                             \n\t"
+        "vfmacc.vf       v21, f1, v2                \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 2                             \n\t"
+        "vfmacc.vf       v22, f2, v2                \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 3                             \n\t"
+        "vfmacc.vf       v23, f3, v2                \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 4                             \n\t"
+        "vfmacc.vf       v24, f4, v2                \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 5                             \n\t"
+        "vfmacc.vf       v25, f5, v2                \n\t"
+        ".endif                                     \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_M > 12                            \n\t"
+        ".if ATOM_N > 0                             \n\t"
+        "vfmacc.vf       v26, f0, v3                \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 1                             \n\t"
+        "vfmacc.vf       v27, f1, v3                \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 2                             \n\t"
+        "vfmacc.vf       v28, f2, v3                \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 3                             \n\t"
+        "vfmacc.vf       v29, f3, v3                \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 4                             \n\t"
+        "vfmacc.vf       v30, f4, v3                \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 5                             \n\t"
+        "vfmacc.vf       v31, f5, v3                \n\t"
+        ".endif                                     \n\t"
+        ".endif                                     \n\t"
+        ".endr                                      \n\t"
+        "addi            s5, s5, -4                 \n\t"
+        "add             s3, s3, %[B_NXT_LINE_STRIDE]\n\t"
+        "bnez            s5, 1b                     \n\t"
+
+        ".if ATOM_M > 0                             \n\t"
+        ".if ATOM_N > 0                             \n\t"
+        "vse.v           v8, (s4)                   \n\t"
+        "addi            s4, s4, 16                 \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 1                             \n\t"
+        "vse.v           v9, (s4)                   \n\t"
+        "addi            s4, s4, 16                 \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 2                             \n\t"
+        "vse.v           v10, (s4)                  \n\t"
+        "addi            s4, s4, 16                 \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 3                             \n\t"
+        "vse.v           v11, (s4)                  \n\t"
+        "addi            s4, s4, 16                 \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 4                             \n\t"
+        "vse.v           v12, (s4)                  \n\t"
+        "addi            s4, s4, 16                 \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 5                             \n\t"
+        "vse.v           v13, (s4)                  \n\t"
+        "addi            s4, s4, 16                 \n\t"
+        ".endif                                     \n\t"
+        "add             s4, s4, %[C_NXT_LINE_STRIDE]\n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_M > 4                             \n\t"
+        ".if ATOM_N > 0                             \n\t"
+        "vse.v           v14, (s4)                  \n\t"
+        "addi            s4, s4, 16                 \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 1                             \n\t"
+        "vse.v           v15, (s4)                  \n\t"
+        "addi            s4, s4, 16                 \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 2                             \n\t"
+        "vse.v           v16, (s4)                  \n\t"
+        "addi            s4, s4, 16                 \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 3                             \n\t"
+        "vse.v           v17, (s4)                  \n\t"
+        "addi            s4, s4, 16                 \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 4                             \n\t"
+        "vse.v           v18, (s4)                  \n\t"
+        "addi            s4, s4, 16                 \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 5                             \n\t"
+        "vse.v           v19, (s4)                  \n\t"
+        "addi            s4, s4, 16                 \n\t"
+        ".endif                                     \n\t"
+        "add             s4, s4, %[C_NXT_LINE_STRIDE]\n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_M > 8                             \n\t"
+        ".if ATOM_N > 0                             \n\t"
+        "vse.v           v20, (s4)                  \n\t"
+        "addi            s4, s4, 16                 \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 1                             \n\t"
+        "vse.v           v21, (s4)                  \n\t"
+        "addi            s4, s4, 16                 \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 2                             \n\t"
+        "vse.v           v22, (s4)                  \n\t"
+        "addi            s4, s4, 16                 \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 3                             \n\t"
+        "vse.v           v23, (s4)                  \n\t"
+        "addi            s4, s4, 16                 \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 4                             \n\t"
+        "vse.v           v24, (s4)                  \n\t"
+        "addi            s4, s4, 16                 \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 5                             \n\t"
+        "vse.v           v25, (s4)                  \n\t"
+        "addi            s4, s4, 16                 \n\t"
+        ".endif                                     \n\t"
+        "add             s4, s4, %[C_NXT_LINE_STRIDE]\n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_M > 12                            \n\t"
+        ".if ATOM_N > 0                             \n\t"
+        "vse.v           v26, (s4)                  \n\t"
+        "addi            s4, s4, 16                 \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 1                             \n\t"
+        "vse.v           v27, (s4)                  \n\t"
+        "addi            s4, s4, 16                 \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 2                             \n\t"
+        "vse.v           v28, (s4)                  \n\t"
+        "addi            s4, s4, 16                 \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 3                             \n\t"
+        "vse.v           v29, (s4)                  \n\t"
+        "addi            s4, s4, 16                 \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 4                             \n\t"
+        "vse.v           v30, (s4)                  \n\t"
+        "addi            s4, s4, 16                 \n\t"
+        ".endif                                     \n\t"
+        ".if ATOM_N > 5                             \n\t"
+        "vse.v           v31, (s4)                  \n\t"
+        "addi            s4, s4, 16                 \n\t"
+        ".endif                                     \n\t"
+        "add             s4, s4, %[C_NXT_LINE_STRIDE]\n\t"
+        ".endif                                     \n\t"
+
+        :
+        : [ATOM_M] "i"(m), [ATOM_N] "i"(n), [A_LOC] "r"(a), [B_LOC] "r"(b), [C_LOC] "r"(c), [K] "r"(total_k), [A_NXT_LINE_STRIDE] "r"(total_k * 16), [B_NXT_LINE_STRIDE] "r"(total_n * 16), [C_NXT_LINE_STRIDE] "r"((total_n - n) * 16)
+        : "memory", "t0", "t1", "t2", "s2", "s3", "s4", "s5", "s6", "f0", "f1", "f2", "f3", "f4", "f5");
+}
+
+template <int64_t align_m, int64_t align_n, int64_t left_m, int64_t left_n>
+void gemm_n4cx_n4cx_fp16w_fp32_vec128(
+    const __fp16* a,
+    const float* b,
+    float* c,
+    const int64_t total_m,
+    const int64_t total_n,
+    const int64_t total_k)
+{
+    const int64_t atom_k           = 4;
+    const int64_t atom_m           = 4;
+    const int64_t c_nxt_blk_stride = (align_m - atom_m) * total_n;
+    const int64_t a_nxt_blk_stride = align_m * total_k;
+
+    int64_t mi           = 0;
+    const __fp16* temp_a = a;
+    float* temp_c        = c;
+    for (mi = 0; mi <= total_m - align_m; mi += align_m) {
+        int64_t ni          = 0;
+        const float* temp_b = b;
+        for (ni = 0; ni <= total_n - align_n; ni += align_n) {
+            gemm_kernel_m16n6_n4cx_n4cx_fp16w_fp32_vec128<align_m, align_n>(temp_a, temp_b, temp_c, total_m, total_n, total_k);
+            temp_b += atom_k * align_n;
+            temp_c += atom_m * align_n;
+        }
+        if (ni < total_n) {
+            gemm_kernel_m16n6_n4cx_n4cx_fp16w_fp32_vec128<align_m, left_n>(temp_a, temp_b, temp_c, total_m, total_n, total_k);
+            temp_c += atom_m * left_n;
+        }
+        temp_c += c_nxt_blk_stride;
+        temp_a += a_nxt_blk_stride;
+    }
+    if (mi < total_m) {
+        int64_t ni          = 0;
+        const float* temp_b = b;
+        for (ni = 0; ni <= total_n - align_n; ni += align_n) {
+            gemm_kernel_m16n6_n4cx_n4cx_fp16w_fp32_vec128<left_m, align_n>(temp_a, temp_b, temp_c, total_m, total_n, total_k);
+            temp_b += atom_k * align_n;
+            temp_c += atom_m * align_n;
+        }
+        if (ni < total_n) {
+            gemm_kernel_m16n6_n4cx_n4cx_fp16w_fp32_vec128<left_m, left_n>(temp_a, temp_b, temp_c, total_m, total_n, total_k);
+        }
+    }
+}
+
+}}}; // namespace ppl::kernel::riscv
+
+#endif
@@ -23,8 +23,28 @@
 
 namespace ppl { namespace kernel { namespace riscv {
 
+// direct gemm is 1x1 stride 1, so conv rows are the same as src rows. pooling path runs on bands of full rows.
+// the cvt filter is a single k block, so it can be split into m blocks of any multiple of 4 to spread over threads
+static conv2d_nxcx_conv_tile_gemm_tunning_info conv2d_n4cx_direct_gemm_pool_tunning_info(
+    const conv2d_common_param* conv_param,
+    const ppl::common::TensorShape* src_shape)
+{
+    return {16, round_up(conv_param->channels, 4), 1, src_shape->GetDim(3), 1};
+}
+
 uint64_t conv2d_n4cx_direct_gemm_fp32_runtime_executor::cal_temp_buffer_size()
 {
+    if (has_fuse_pool()) {
+        return conv2d_nxcx_tile_gemm_pool_get_temp_buffer_size_fp32_vec128<4>(
+            1,
+            1,
+            conv_param_->channels,
+            conv_param_->num_output,
+            src_shape_->GetDim(2),
+            src_shape_->GetDim(3),
+            fuse_pool_param_,
+            conv2d_n4cx_direct_gemm_pool_tunning_info(conv_param_, src_shape_));
+    }
     return 4;
 }
 
@@ -49,6 +69,42 @@ ppl::common::RetCode conv2d_n4cx_direct_gemm_fp32_runtime_executor::execute()
         return ppl::common::RC_INVALID_VALUE;
     }
 
+    if (has_fuse_pool()) {
+        if (!is_fuse_pool_supported()) {
+            return ppl::common::RC_UNSUPPORTED;
+        }
+        auto rc = conv2d_nxcx_tile_gemm_pool_check_param(
+            conv_param_, fuse_pool_param_, src_shape_, dst_shape_, sum_src_ != nullptr, src_shape_->GetDim(2), src_shape_->GetDim(3));
+        if (rc != ppl::common::RC_SUCCESS) {
+            return rc;
+        }
+        conv2d_nxcx_conv_tile_gemm_pool_fp32_vec128<4>(
+            src_,
+            cvt_filter_,
+            cvt_bias_,
+            (float*)temp_buffer_,
+            dst_,
+            src_shape_->GetDim(2), // src_h
+            src_shape_->GetDim(3), // src_w
+            0,
+            0,
+            1,
+            1,
+            1,
+            1,
+            1,
+            1,
+            conv_param_->channels,
+            conv_param_->num_output,
+            src_shape_->GetDim(0), // batch
+            (conv_param_->fuse_flag & conv_fuse_flag::RELU) != 0,
+            fuse_pool_param_,
+            dst_shape_->GetDim(2), // pooled dst_h
+            dst_shape_->GetDim(3), // pooled dst_w
+            conv2d_n4cx_direct_gemm_pool_tunning_info(conv_param_, src_shape_));
+        return ppl::common::RC_SUCCESS;
+    }
+
     int64_t pad_channels   = round_up(conv_param_->channels, 4);
     int64_t pad_num_output = round_up(conv_param_->num_output, 4);
     int64_t dst_h          = dst_shape_->GetDim(2);
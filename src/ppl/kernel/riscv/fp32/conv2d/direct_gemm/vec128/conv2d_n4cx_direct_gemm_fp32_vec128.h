@@ -42,6 +42,10 @@ public:
     ppl::common::RetCode prepare() override;
     // execute op
     ppl::common::RetCode execute() override;
+    bool is_fuse_pool_supported() const override
+    {
+        return true;
+    }
 
 private:
     conv2d_n4cx_direct_gemm_fp32_vec128_tunning_param tunning_param_;
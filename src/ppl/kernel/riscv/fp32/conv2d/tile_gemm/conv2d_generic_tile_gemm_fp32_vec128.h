@@ -18,10 +18,13 @@
 #ifndef __ST_PPL_KERNEL_RISCV_FP32_CONV2D_TILE_GEMM_CONV2D_GENERIC_TILE_GEMM_FP32_VEC128_H_
 #define __ST_PPL_KERNEL_RISCV_FP32_CONV2D_TILE_GEMM_CONV2D_GENERIC_TILE_GEMM_FP32_VEC128_H_
 
-#include "ppl/kernel/riscv/common/math.h"
+#include "ppl/common/log.h"
+#include "ppl/kernel/riscv/common/internal_include.h"
+#include "ppl/kernel/riscv/common/conv2d.h"
 #include "ppl/kernel/riscv/fp32/conv2d/common/conv2d_gemm_kernel_fp32.h"
 #include "ppl/kernel/riscv/fp32/conv2d/common/conv2d_mem_fp32.h"
 #include <cstring>
+#include <utility>
 
 namespace ppl { namespace kernel { namespace riscv {
 
@@ -33,6 +36,37 @@ struct conv2d_nxcx_conv_tile_gemm_tunning_info {
     int64_t num_threads;
 };
 
+// channels of a k block, the cvt filter of each m block is stored as consecutive k blocks
+template <int64_t atom_ic>
+static inline int64_t conv2d_nxcx_tile_gemm_get_k_blk_channels(
+    int64_t tile_gemm_k_blk,
+    int64_t flt_h,
+    int64_t flt_w,
+    int64_t pad_channels)
+{
+    return min(max<int64_t>(tile_gemm_k_blk / (flt_h * flt_w) / atom_ic * atom_ic, atom_ic), pad_channels);
+}
+
+// gemm of one m block walked in k blocks, src_trans holds the whole k of the tile
+template <int64_t atom_ic>
+void conv2d_nxcx_tile_gemm_k_blk_fp32_vec128(
+    const float* filter,
+    const float* src_trans,
+    float* dst_blk,
+    int64_t m,
+    int64_t n,
+    int64_t flt_size,
+    int64_t pad_channels,
+    int64_t k_blk_channels)
+{
+    for (int64_t c_beg = 0; c_beg < pad_channels; c_beg += k_blk_channels) {
+        int64_t real_k_blk = min(k_blk_channels, pad_channels - c_beg) * flt_size;
+        auto gemm_func     = c_beg == 0 ? conv2d_gemm_select_xcto4c_kernel_fp32_vec128<atom_ic, true>(m, n)
+                                        : conv2d_gemm_select_xcto4c_kernel_fp32_vec128<atom_ic, false>(m, n);
+        gemm_func(filter + c_beg * flt_size * m, src_trans + c_beg * flt_size * n, dst_blk, m, n, real_k_blk);
+    }
+}
+
 template <int64_t atom_c>
 void conv2d_nxcx_tile_gemm_src_blk_im2col_fp32_vec128(
     const float* src,
@@ -167,8 +201,9 @@ void conv2d_nxcx_conv_tile_gemm_riscv_per_group_fp32_vec128(
 
     int64_t src_h_stride    = atom_ic * src_w;
     int64_t filter_m_stride = tile_gemm_m_blk * total_k;
+    int64_t k_blk_channels  = conv2d_nxcx_tile_gemm_get_k_blk_channels<atom_ic>(tile_gemm_k_blk, flt_h, flt_w, pad_ic);
 
-    // blk loops, TODO: k_blk
+    // blk loops
     for (int64_t dst_h_beg = 0; dst_h_beg < dst_h; dst_h_beg += tile_gemm_dst_h_blk) {
         int64_t real_dst_h_blk = min(tile_gemm_dst_h_blk, dst_h - dst_h_beg);
         for (int64_t dst_w_beg = 0; dst_w_beg < dst_w; dst_w_beg += tile_gemm_dst_w_blk) {
@@ -201,8 +236,103 @@ void conv2d_nxcx_conv_tile_gemm_riscv_per_group_fp32_vec128(
             for (int64_t m_beg = 0; m_beg < total_m; m_beg += tile_gemm_m_blk) {
                 int64_t real_m_blk     = min(tile_gemm_m_blk, total_m - m_beg);
                 int64_t real_pad_m_blk = round_up(real_m_blk, atom_oc);
-                auto gemm_func =
-                    conv2d_gemm_select_xcto4c_kernel_fp32_vec128<atom_ic, true>(real_pad_m_blk, real_n_blk);
+                conv2d_nxcx_tile_gemm_k_blk_fp32_vec128<atom_ic>(
+                    filter_temp, src_trans, dst_blk, real_pad_m_blk, real_n_blk, flt_h * flt_w, pad_ic, k_blk_channels);
+
+                auto dst_ptr  = dst + m_beg * (dst_h * dst_w) + dst_h_beg * dst_w * atom_oc + dst_w_beg * atom_oc;
+                auto bias_ptr = bias + m_beg;
+
+                conv2d_n4cx_mem_dst_blk_trans_fp32_vec128<false>(
+                    dst_blk,
+                    real_dst_h_blk,
+                    real_dst_w_blk,
+                    dst_ptr,
+                    dst_h,
+                    dst_w,
+                    real_m_blk,
+                    real_dst_h_blk,
+                    real_dst_w_blk,
+                    bias_ptr);
+
+                filter_temp += real_m_blk * total_k;
+            }
+        }
+    }
+}
+
+// filter is the fp16 cvt filter from conv2d_n4cx_conv_tile_gemm_cvt_filter_fp16w_fp32_vec128, passed as float* to fit the shell
+inline void conv2d_n4cx_conv_tile_gemm_fp16w_riscv_per_group_fp32_vec128(
+    const float* src,
+    const float* filter,
+    const float* bias,
+    float* temp_buffer,
+    float* dst,
+    int64_t src_h,
+    int64_t src_w,
+    int64_t pad_h,
+    int64_t pad_w,
+    int64_t flt_h,
+    int64_t flt_w,
+    int64_t stride_h,
+    int64_t stride_w,
+    int64_t hole_h,
+    int64_t hole_w,
+    int64_t dst_h,
+    int64_t dst_w,
+    int64_t ic,
+    int64_t oc,
+    conv2d_nxcx_conv_tile_gemm_tunning_info tunning_info)
+{
+    const int64_t atom_ic     = 4;
+    const int64_t atom_oc     = 4;
+    const int64_t atom_flt_oc = 8;
+
+    int64_t tile_gemm_m_blk     = round_up(tunning_info.tile_gemm_m_blk, atom_flt_oc);
+    int64_t tile_gemm_dst_h_blk = min(dst_h, tunning_info.tile_gemm_dst_h_blk);
+    int64_t tile_gemm_dst_w_blk = min(dst_w, tunning_info.tile_gemm_dst_w_blk);
+
+    int64_t pad_ic  = round_up(ic, atom_ic);
+    int64_t pad_oc  = round_up(oc, atom_oc);
+    int64_t total_m = pad_oc;
+    int64_t total_k = flt_h * flt_w * pad_ic;
+
+    int64_t src_trans_size = total_k * tile_gemm_dst_h_blk * tile_gemm_dst_w_blk;
+    auto src_trans         = temp_buffer;
+    auto dst_blk           = src_trans + src_trans_size;
+
+    for (int64_t dst_h_beg = 0; dst_h_beg < dst_h; dst_h_beg += tile_gemm_dst_h_blk) {
+        int64_t real_dst_h_blk = min(tile_gemm_dst_h_blk, dst_h - dst_h_beg);
+        for (int64_t dst_w_beg = 0; dst_w_beg < dst_w; dst_w_beg += tile_gemm_dst_w_blk) {
+            int64_t real_dst_w_blk = min(tile_gemm_dst_w_blk, dst_w - dst_w_beg);
+            int64_t real_n_blk     = real_dst_h_blk * real_dst_w_blk;
+
+            auto filter_temp = (const __fp16*)filter;
+
+            conv2d_nxcx_tile_gemm_src_blk_im2col_fp32_vec128<atom_ic>(
+                src,
+                src_h,
+                src_w,
+                dst_h,
+                dst_w,
+                flt_h,
+                flt_w,
+                pad_h,
+                pad_w,
+                stride_h,
+                stride_w,
+                hole_h,
+                hole_w,
+                ic,
+                dst_h_beg,
+                real_dst_h_blk,
+                dst_w_beg,
+                real_dst_w_blk,
+                src_trans);
+
+            for (int64_t m_beg = 0; m_beg < total_m; m_beg += tile_gemm_m_blk) {
+                int64_t real_m_blk     = min(tile_gemm_m_blk, total_m - m_beg);
+                int64_t real_pad_m_blk = round_up(real_m_blk, atom_flt_oc);
+                auto gemm_func         = conv2d_gemm_select_4cto4c_fp16w_kernel_fp32_vec128(real_pad_m_blk, real_n_blk);
 
                 gemm_func(filter_temp, src_trans, dst_blk, real_pad_m_blk, real_n_blk, total_k);
 
@@ -221,12 +351,328 @@ void conv2d_nxcx_conv_tile_gemm_riscv_per_group_fp32_vec128(
                     real_dst_w_blk,
                     bias_ptr);
 
-                filter_temp += real_m_blk * total_k;
+                filter_temp += real_pad_m_blk * total_k;
             }
         }
     }
 }
 
+// pooled rows computed per band, conv rows of a band are computed for all output channels and stay in cache until pooled
+static inline int64_t conv2d_nxcx_tile_gemm_pool_get_dst_h_blk(
+    const conv2d_common_pool_param* pool_param,
+    int64_t dst_w,
+    conv2d_nxcx_conv_tile_gemm_tunning_info tunning_info)
+{
+    const int64_t tile_n = tunning_info.tile_gemm_dst_h_blk * tunning_info.tile_gemm_dst_w_blk;
+    return max<int64_t>(tile_n / (pool_param->stride_h * dst_w), 1);
+}
+
+static inline int64_t conv2d_nxcx_tile_gemm_pool_get_max_band_h(
+    const conv2d_common_pool_param* pool_param,
+    int64_t dst_h,
+    int64_t pool_dst_h_blk)
+{
+    return min<int64_t>((pool_dst_h_blk - 1) * pool_param->stride_h + pool_param->kernel_h, dst_h);
+}
+
+// conv rows shared by two adjacent bands, they are carried over instead of being recomputed.
+// at least one row is kept for the windows moved onto the last conv row by conv2d_pool_get_window_range
+static inline int64_t conv2d_nxcx_tile_gemm_pool_get_carry_h(const conv2d_common_pool_param* pool_param)
+{
+    return max<int64_t>(pool_param->kernel_h - pool_param->stride_h, 1);
+}
+
+// checks shared by executors running the pooling fused path
+static inline ppl::common::RetCode conv2d_nxcx_tile_gemm_pool_check_param(
+    const conv2d_common_param* conv_param,
+    const conv2d_common_pool_param* pool_param,
+    const ppl::common::TensorShape* src_shape,
+    const ppl::common::TensorShape* dst_shape,
+    bool has_sum,
+    int64_t conv_dst_h,
+    int64_t conv_dst_w)
+{
+    if (has_sum || (conv_param->fuse_flag & ~conv_fuse_flag::RELU)) {
+        LOG(ERROR) << "only relu can be fused together with pooling.";
+        return ppl::common::RC_UNSUPPORTED;
+    }
+    if (pool_param->kernel_h <= 0 || pool_param->kernel_w <= 0 || pool_param->stride_h <= 0 ||
+        pool_param->stride_w <= 0 || pool_param->pad_h < 0 || pool_param->pad_w < 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+
+    // both floor and ceil mode output sizes are accepted, windows past the end are clamped
+    auto valid_pool_dst = [](int64_t pool_dst, int64_t conv_dst, int64_t kernel, int64_t stride, int64_t pad) {
+        const int64_t floor_dst = (conv_dst + 2 * pad - kernel) / stride + 1;
+        const int64_t ceil_dst  = div_up(conv_dst + 2 * pad - kernel, stride) + 1;
+        return pool_dst > 0 && (pool_dst == floor_dst || pool_dst == ceil_dst);
+    };
+    if (dst_shape->GetDim(0) != src_shape->GetDim(0) || dst_shape->GetDim(1) != conv_param->num_output ||
+        !valid_pool_dst(dst_shape->GetDim(2), conv_dst_h, pool_param->kernel_h, pool_param->stride_h, pool_param->pad_h) ||
+        !valid_pool_dst(dst_shape->GetDim(3), conv_dst_w, pool_param->kernel_w, pool_param->stride_w, pool_param->pad_w)) {
+        LOG(ERROR) << "dst shape does not match the pooled conv output.";
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template <int64_t atom_ic, bool with_relu>
+void conv2d_nxcx_conv_tile_gemm_pool_riscv_per_group_fp32_vec128(
+    const float* src,
+    const float* filter,
+    const float* bias,
+    float* temp_buffer,
+    float* dst,
+    int64_t src_h,
+    int64_t src_w,
+    int64_t pad_h,
+    int64_t pad_w,
+    int64_t flt_h,
+    int64_t flt_w,
+    int64_t stride_h,
+    int64_t stride_w,
+    int64_t hole_h,
+    int64_t hole_w,
+    int64_t dst_h,
+    int64_t dst_w,
+    int64_t ic,
+    int64_t oc,
+    const conv2d_common_pool_param* pool_param,
+    int64_t pool_dst_h,
+    int64_t pool_dst_w,
+    conv2d_nxcx_conv_tile_gemm_tunning_info tunning_info)
+{
+    const int64_t atom_oc  = 4;
+    const bool keep_empty  = pool_param->pool_type == conv2d_pool_type::AVERAGE_INCLUDE;
+    const int64_t flt_size = flt_h * flt_w;
+
+    int64_t pad_ic  = round_up(ic, atom_ic);
+    int64_t pad_oc  = round_up(oc, atom_oc);
+    int64_t total_m = pad_oc;
+    int64_t total_k = flt_size * pad_ic;
+
+    int64_t tile_gemm_m_blk = min(round_up(tunning_info.tile_gemm_m_blk, atom_oc), pad_oc);
+    int64_t tile_gemm_k_blk = round_up(tunning_info.tile_gemm_k_blk, atom_ic);
+    int64_t k_blk_channels  = conv2d_nxcx_tile_gemm_get_k_blk_channels<atom_ic>(tile_gemm_k_blk, flt_h, flt_w, pad_ic);
+    int64_t num_m_blk       = div_up(total_m, tile_gemm_m_blk);
+    int64_t pool_dst_h_blk  = conv2d_nxcx_tile_gemm_pool_get_dst_h_blk(pool_param, dst_w, tunning_info);
+    int64_t max_band_h      = conv2d_nxcx_tile_gemm_pool_get_max_band_h(pool_param, dst_h, pool_dst_h_blk);
+    int64_t carry_h         = conv2d_nxcx_tile_gemm_pool_get_carry_h(pool_param);
+
+    // per thread tables of the conv rows read by a band, followed by the im2col of one k block.
+    // conv rows are kept in n4cx order: [m / atom_oc][h][dst_w][atom_oc]
+    int64_t row_size    = dst_w * atom_oc;
+    auto rows_table     = (const float**)temp_buffer;
+    auto c_stride_table = (int64_t*)(rows_table + PPL_OMP_MAX_THREADS() * max_band_h);
+    auto src_trans      = (float*)(c_stride_table + PPL_OMP_MAX_THREADS() * max_band_h);
+    auto dst_blk        = src_trans + k_blk_channels * flt_size * max_band_h * dst_w;
+    auto carry_rows     = dst_blk + total_m * max_band_h * dst_w;
+    auto next_carry     = carry_rows + total_m * carry_h * dst_w;
+    int64_t carry_beg   = 0;
+    int64_t conv_h_end  = 0; // conv rows [0, conv_h_end) have been computed
+
+    for (int64_t pool_h_beg = 0; pool_h_beg < pool_dst_h; pool_h_beg += pool_dst_h_blk) {
+        int64_t pool_h_end = min(pool_h_beg + pool_dst_h_blk, pool_dst_h);
+        int64_t need_h_beg, need_h_end, last_h_beg, keep_h_beg, keep_h_end;
+        conv2d_pool_get_window_range(pool_h_beg, pool_param->stride_h, pool_param->pad_h, pool_param->kernel_h, dst_h, false, &need_h_beg, &keep_h_end);
+        conv2d_pool_get_window_range(pool_h_end - 1, pool_param->stride_h, pool_param->pad_h, pool_param->kernel_h, dst_h, false, &last_h_beg, &need_h_end);
+        conv2d_pool_get_window_range(pool_h_end, pool_param->stride_h, pool_param->pad_h, pool_param->kernel_h, dst_h, false, &keep_h_beg, &keep_h_end);
+        int64_t band_h_beg = max(need_h_beg, conv_h_end);
+        int64_t band_h     = max<int64_t>(need_h_end - band_h_beg, 0);
+        int64_t band_n     = band_h * dst_w;
+
+        keep_h_beg     = min(max(keep_h_beg, need_h_end - carry_h), need_h_end);
+        int64_t keep_h = need_h_end - keep_h_beg;
+
+        for (int64_t c_beg = 0; c_beg < pad_ic && band_h > 0; c_beg += k_blk_channels) {
+            int64_t real_k_blk_channels = min(k_blk_channels, pad_ic - c_beg);
+
+            PRAGMA_OMP_PARALLEL_FOR()
+            for (int64_t c = 0; c < real_k_blk_channels; c += atom_ic) {
+                conv2d_nxcx_tile_gemm_src_blk_im2col_fp32_vec128<atom_ic>(
+                    src + (c_beg + c) * src_h * src_w,
+                    src_h,
+                    src_w,
+                    dst_h,
+                    dst_w,
+                    flt_h,
+                    flt_w,
+                    pad_h,
+                    pad_w,
+                    stride_h,
+                    stride_w,
+                    hole_h,
+                    hole_w,
+                    atom_ic,
+                    band_h_beg,
+                    band_h,
+                    0,
+                    dst_w,
+                    src_trans + c * flt_size * band_n);
+            }
+
+            PRAGMA_OMP_PARALLEL_FOR()
+            for (int64_t m_blk_idx = 0; m_blk_idx < num_m_blk; m_blk_idx += 1) {
+                int64_t m_beg      = m_blk_idx * tile_gemm_m_blk;
+                int64_t real_m_blk = min(tile_gemm_m_blk, total_m - m_beg);
+                auto gemm_func     = c_beg == 0 ? conv2d_gemm_select_xcto4c_kernel_fp32_vec128<atom_ic, true>(real_m_blk, band_n)
+                                                : conv2d_gemm_select_xcto4c_kernel_fp32_vec128<atom_ic, false>(real_m_blk, band_n);
+                gemm_func(
+                    filter + m_beg * total_k + c_beg * flt_size * real_m_blk,
+                    src_trans,
+                    dst_blk + m_beg * band_n,
+                    real_m_blk,
+                    band_n,
+                    real_k_blk_channels * flt_size);
+            }
+        }
+
+        PRAGMA_OMP_PARALLEL_FOR()
+        for (int64_t m_blk_idx = 0; m_blk_idx < num_m_blk; m_blk_idx += 1) {
+            int64_t m_beg      = m_blk_idx * tile_gemm_m_blk;
+            int64_t real_m_blk = min(tile_gemm_m_blk, total_m - m_beg);
+            auto carry_m       = carry_rows + m_beg * carry_h * dst_w;
+            auto next_carry_m  = next_carry + m_beg * carry_h * dst_w;
+
+            const float** conv_rows     = rows_table + PPL_OMP_THREAD_ID() * max_band_h;
+            int64_t* conv_rows_c_stride = c_stride_table + PPL_OMP_THREAD_ID() * max_band_h;
+            for (int64_t h = need_h_beg; h < need_h_end; h += 1) {
+                if (h >= band_h_beg) {
+                    conv_rows[h - need_h_beg]          = dst_blk + m_beg * band_n + (h - band_h_beg) * row_size;
+                    conv_rows_c_stride[h - need_h_beg] = band_h * row_size;
+                } else {
+                    conv_rows[h - need_h_beg]          = carry_m + (h - carry_beg) * row_size;
+                    conv_rows_c_stride[h - need_h_beg] = carry_h * row_size;
+                }
+            }
+
+            conv2d_n4cx_mem_dst_rows_pool_fp32_vec128<with_relu>(
+                conv_rows,
+                conv_rows_c_stride,
+                need_h_beg,
+                dst_h,
+                dst_w,
+                dst + m_beg * pool_dst_h * pool_dst_w,
+                pool_dst_h,
+                pool_dst_w,
+                pool_h_beg,
+                pool_h_end,
+                real_m_blk,
+                pool_param,
+                bias + m_beg);
+
+            for (int64_t mi = 0; mi < real_m_blk; mi += atom_oc) {
+                for (int64_t h = keep_h_beg; h < need_h_end; h += 1) {
+                    auto row_ptr = conv_rows[h - need_h_beg] + (mi / atom_oc) * conv_rows_c_stride[h - need_h_beg];
+                    memcpy(next_carry_m + (mi / atom_oc) * carry_h * row_size + (h - keep_h_beg) * row_size, row_ptr, row_size * sizeof(float));
+                }
+            }
+        }
+
+        std::swap(carry_rows, next_carry);
+        carry_beg  = keep_h_beg;
+        conv_h_end = max(conv_h_end, need_h_end);
+    }
+}
+
+template <int64_t atom_ic>
+size_t conv2d_nxcx_tile_gemm_pool_get_temp_buffer_size_fp32_vec128(
+    int64_t flt_h,
+    int64_t flt_w,
+    int64_t channels,
+    int64_t num_outs,
+    int64_t dst_h,
+    int64_t dst_w,
+    const conv2d_common_pool_param* pool_param,
+    conv2d_nxcx_conv_tile_gemm_tunning_info tunning_info)
+{
+    const int64_t atom_oc = 4;
+
+    int64_t pad_channels   = round_up(channels, atom_ic);
+    int64_t pad_num_outs   = round_up(num_outs, atom_oc);
+    int64_t k_blk_channels = conv2d_nxcx_tile_gemm_get_k_blk_channels<atom_ic>(
+        round_up(tunning_info.tile_gemm_k_blk, atom_ic), flt_h, flt_w, pad_channels);
+    int64_t pool_dst_h_blk = conv2d_nxcx_tile_gemm_pool_get_dst_h_blk(pool_param, dst_w, tunning_info);
+    int64_t max_band_h     = conv2d_nxcx_tile_gemm_pool_get_max_band_h(pool_param, dst_h, pool_dst_h_blk);
+    int64_t carry_h        = conv2d_nxcx_tile_gemm_pool_get_carry_h(pool_param);
+
+    size_t rows_table_size = PPL_OMP_MAX_THREADS() * max_band_h * (sizeof(const float*) + sizeof(int64_t));
+    size_t src_trans_size  = flt_h * flt_w * k_blk_channels * max_band_h * dst_w * sizeof(float);
+    size_t dst_blk_size    = pad_num_outs * max_band_h * dst_w * sizeof(float);
+    size_t carry_size      = 2 * pad_num_outs * carry_h * dst_w * sizeof(float);
+
+    return rows_table_size + src_trans_size + dst_blk_size + carry_size;
+}
+
+// batch loop of the pooling fused path, only group == 1 is supported.
+// k is walked in tile_gemm_k_blk, im2col and the gemm of each k block are spread over threads
+template <int64_t atom_ic>
+void conv2d_nxcx_conv_tile_gemm_pool_fp32_vec128(
+    const float* src,
+    const float* filter,
+    const float* bias,
+    float* temp_buffer,
+    float* dst,
+    int64_t src_h,
+    int64_t src_w,
+    int64_t pad_h,
+    int64_t pad_w,
+    int64_t flt_h,
+    int64_t flt_w,
+    int64_t stride_h,
+    int64_t stride_w,
+    int64_t hole_h,
+    int64_t hole_w,
+    int64_t ic,
+    int64_t oc,
+    int64_t batch,
+    bool with_relu,
+    const conv2d_common_pool_param* pool_param,
+    int64_t pool_dst_h,
+    int64_t pool_dst_w,
+    conv2d_nxcx_conv_tile_gemm_tunning_info tunning_info)
+{
+    const int64_t atom_oc = 4;
+
+    int64_t flt_h_with_hole = hole_h * (flt_h - 1) + 1;
+    int64_t flt_w_with_hole = hole_w * (flt_w - 1) + 1;
+    int64_t dst_h           = (src_h + 2 * pad_h - flt_h_with_hole + stride_h) / stride_h;
+    int64_t dst_w           = (src_w + 2 * pad_w - flt_w_with_hole + stride_w) / stride_w;
+
+    int64_t src_batch_stride = round_up(ic, atom_ic) * src_h * src_w;
+    int64_t dst_batch_stride = round_up(oc, atom_oc) * pool_dst_h * pool_dst_w;
+
+    auto per_group_func = with_relu ? conv2d_nxcx_conv_tile_gemm_pool_riscv_per_group_fp32_vec128<atom_ic, true>
+                                    : conv2d_nxcx_conv_tile_gemm_pool_riscv_per_group_fp32_vec128<atom_ic, false>;
+
+    for (int64_t i = 0; i < batch; i += 1) {
+        per_group_func(
+            src + i * src_batch_stride,
+            filter,
+            bias,
+            temp_buffer,
+            dst + i * dst_batch_stride,
+            src_h,
+            src_w,
+            pad_h,
+            pad_w,
+            flt_h,
+            flt_w,
+            stride_h,
+            stride_w,
+            hole_h,
+            hole_w,
+            dst_h,
+            dst_w,
+            ic,
+            oc,
+            pool_param,
+            pool_dst_h,
+            pool_dst_w,
+            tunning_info);
+    }
+}
+
 template <int64_t atom_ic>
 size_t conv2d_nxcx_conv_tile_gemm_get_cvt_filter_size_fp32_vec128(
     int64_t flt_h,
@@ -261,34 +707,29 @@ static void conv2d_nxcx_conv_tile_gemm_cvt_filter_kernel_fp32_vec128(
     const int64_t atom_oc = 4;
 
     tile_gemm_m_blk = round_up(tile_gemm_m_blk, atom_oc);
-    tile_gemm_k_blk = round_up(tile_gemm_k_blk, atom_ic);
-    tile_gemm_k_blk = tile_gemm_k_blk / (flt_h * flt_w);
 
-    int64_t n;
-    int64_t pad_channels         = round_up(channels, atom_ic);
-    int64_t pad_num_outs         = round_up(num_outs, atom_oc);
-    int64_t flt_size             = flt_h * flt_w;
-    int64_t tile_gemm_k_blk_left = round_up(pad_channels, tile_gemm_k_blk) - pad_channels;
+    int64_t pad_channels   = round_up(channels, atom_ic);
+    int64_t pad_num_outs   = round_up(num_outs, atom_oc);
+    int64_t flt_size       = flt_h * flt_w;
+    int64_t k_blk_channels = conv2d_nxcx_tile_gemm_get_k_blk_channels<atom_ic>(tile_gemm_k_blk, flt_h, flt_w, pad_channels);
     memset(filter_cvt, 0, pad_channels * pad_num_outs * flt_size * sizeof(float));
 
-    // handle tile_gemm_m_blk
-    for (n = 0; n < num_outs; n++) {
+    // m_blks -> k_blks -> blk m / 4 -> blk k / atom_ic -> flt_size -> atom_ic(k) -> 4(m)
+    for (int64_t n = 0; n < num_outs; n++) {
+        int64_t m_beg      = n / tile_gemm_m_blk * tile_gemm_m_blk;
+        int64_t real_m_blk = min(tile_gemm_m_blk, pad_num_outs - m_beg);
         for (int64_t c = 0; c < channels; c++) {
-            int64_t ch_blk = tile_gemm_k_blk;
-            if (pad_channels - c <= tile_gemm_k_blk_left) {
-                ch_blk = tile_gemm_k_blk_left;
-            }
-
-            // m_blks -> k_blks -> blk m / 8 -> blk k / atom_ic -> flt_size -> atom_ic(k) -> 8(m)
+            int64_t c_beg      = c / k_blk_channels * k_blk_channels;
+            int64_t real_k_blk = min(k_blk_channels, pad_channels - c_beg);
             for (int64_t i = 0; i < flt_size; i++) {
                 int64_t filter_cvt_loc = 0;
-                filter_cvt_loc += (n / tile_gemm_m_blk) * tile_gemm_m_blk * pad_channels * flt_size; // which m_blk
-                filter_cvt_loc += (c / tile_gemm_k_blk) * tile_gemm_m_blk * tile_gemm_k_blk * flt_size; // which k_blk
-                filter_cvt_loc += ((n % tile_gemm_m_blk) / atom_oc) * ch_blk * flt_size * atom_oc;
-                filter_cvt_loc += ((c % tile_gemm_k_blk) / atom_ic) * flt_size * atom_ic * atom_oc;
+                filter_cvt_loc += m_beg * pad_channels * flt_size; // which m_blk
+                filter_cvt_loc += c_beg * flt_size * real_m_blk;   // which k_blk
+                filter_cvt_loc += ((n - m_beg) / atom_oc) * real_k_blk * flt_size * atom_oc;
+                filter_cvt_loc += ((c - c_beg) / atom_ic) * flt_size * atom_ic * atom_oc;
                 filter_cvt_loc += i * atom_ic * atom_oc;
-                filter_cvt_loc += ((c % tile_gemm_k_blk) % atom_ic) * atom_oc;
-                filter_cvt_loc += ((n % tile_gemm_m_blk) % atom_oc);
+                filter_cvt_loc += ((c - c_beg) % atom_ic) * atom_oc;
+                filter_cvt_loc += n % atom_oc;
                 filter_cvt[filter_cvt_loc] = filter[n * channels * flt_size + c * flt_size + i];
             }
         }
@@ -331,6 +772,56 @@ void conv2d_nxcx_conv_tile_gemm_cvt_filter_fp32_vec128(
     }
 }
 
+static inline size_t conv2d_n4cx_conv_tile_gemm_get_cvt_filter_size_fp16w_fp32_vec128(
+    int64_t flt_h,
+    int64_t flt_w,
+    int64_t channels,
+    int64_t num_outs)
+{
+    const int64_t atom_ic     = 4;
+    const int64_t atom_flt_oc = 8;
+
+    int64_t num_cvt_filter_elem = round_up(num_outs, atom_flt_oc) * round_up(channels, atom_ic) * flt_h * flt_w;
+    return num_cvt_filter_elem * sizeof(__fp16);
+}
+
+// m_blks -> blk m / 8 -> k / atom_ic -> flt_size -> atom_ic(k) -> 8(m), k is not blocked, only group == 1
+static inline void conv2d_n4cx_conv_tile_gemm_cvt_filter_fp16w_fp32_vec128(
+    const float* filter,
+    int64_t flt_h,
+    int64_t flt_w,
+    int64_t num_outs,
+    int64_t channels,
+    int64_t tile_gemm_m_blk,
+    __fp16* filter_cvt)
+{
+    const int64_t atom_ic     = 4;
+    const int64_t atom_flt_oc = 8;
+
+    tile_gemm_m_blk = round_up(tile_gemm_m_blk, atom_flt_oc);
+
+    int64_t pad_channels = round_up(channels, atom_ic);
+    int64_t pad_num_outs = round_up(num_outs, atom_flt_oc);
+    int64_t flt_size     = flt_h * flt_w;
+    int64_t total_k      = pad_channels * flt_size;
+    memset(filter_cvt, 0, pad_num_outs * total_k * sizeof(__fp16));
+
+    for (int64_t n = 0; n < num_outs; n++) {
+        for (int64_t c = 0; c < channels; c++) {
+            for (int64_t i = 0; i < flt_size; i++) {
+                int64_t filter_cvt_loc = 0;
+                filter_cvt_loc += (n / tile_gemm_m_blk) * tile_gemm_m_blk * total_k; // which m_blk
+                filter_cvt_loc += ((n % tile_gemm_m_blk) / atom_flt_oc) * total_k * atom_flt_oc;
+                filter_cvt_loc += (c / atom_ic) * flt_size * atom_ic * atom_flt_oc;
+                filter_cvt_loc += i * atom_ic * atom_flt_oc;
+                filter_cvt_loc += (c % atom_ic) * atom_flt_oc;
+                filter_cvt_loc += n % atom_flt_oc;
+                filter_cvt[filter_cvt_loc] = (__fp16)filter[n * channels * flt_size + c * flt_size + i];
+            }
+        }
+    }
+}
+
 template <int64_t atom_ic>
 size_t conv2d_nxcx_tile_gemm_get_temp_buffer_size_fp32_vec128(
     int64_t src_h,
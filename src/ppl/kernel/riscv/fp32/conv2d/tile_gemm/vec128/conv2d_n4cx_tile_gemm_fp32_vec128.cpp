@@ -23,8 +23,36 @@
 
 namespace ppl { namespace kernel { namespace riscv {
 
+int64_t conv2d_n4cx_tile_gemm_fp32_runtime_executor::conv_dst_h() const
+{
+    const int64_t flt_h_with_hole = conv_param_->dilation_h * (conv_param_->kernel_h - 1) + 1;
+    return (src_shape_->GetDim(2) + 2 * conv_param_->pad_h - flt_h_with_hole + conv_param_->stride_h) / conv_param_->stride_h;
+}
+
+int64_t conv2d_n4cx_tile_gemm_fp32_runtime_executor::conv_dst_w() const
+{
+    const int64_t flt_w_with_hole = conv_param_->dilation_w * (conv_param_->kernel_w - 1) + 1;
+    return (src_shape_->GetDim(3) + 2 * conv_param_->pad_w - flt_w_with_hole + conv_param_->stride_w) / conv_param_->stride_w;
+}
+
 uint64_t conv2d_n4cx_tile_gemm_fp32_runtime_executor::cal_temp_buffer_size()
 {
+    if (has_fuse_pool()) {
+        return conv2d_nxcx_tile_gemm_pool_get_temp_buffer_size_fp32_vec128<4>(
+            conv_param_->kernel_h,
+            conv_param_->kernel_w,
+            conv_param_->channels,
+            conv_param_->num_output,
+            conv_dst_h(),
+            conv_dst_w(),
+            fuse_pool_param_,
+            {tunning_param_.m_blk,
+             tunning_param_.k_blk,
+             tunning_param_.oh_blk,
+             tunning_param_.ow_blk,
+             tunning_param_.num_thread});
+    }
+
     size_t temp_buffer_size = conv2d_nxcx_tile_gemm_get_temp_buffer_size_fp32_vec128<4>(
         src_shape_->GetDim(2), // src_h
         src_shape_->GetDim(3), // src_w
@@ -39,7 +67,7 @@ uint64_t conv2d_n4cx_tile_gemm_fp32_runtime_executor::cal_temp_buffer_size()
         conv_param_->channels,
         conv_param_->group,
         conv_param_->num_output,
-        tunning_param_.m_blk,
+        fp16_filter_ ? round_up(tunning_param_.m_blk, 8) : tunning_param_.m_blk,
         tunning_param_.oh_blk,
         tunning_param_.ow_blk,
         tunning_param_.num_thread);
@@ -80,6 +108,77 @@ ppl::common::RetCode conv2d_n4cx_tile_gemm_fp32_runtime_executor::execute()
         return ppl::common::RC_INVALID_VALUE;
     }
 
+    if (has_fuse_pool()) {
+        if (!is_fuse_pool_supported()) {
+            return ppl::common::RC_UNSUPPORTED;
+        }
+        auto rc = conv2d_nxcx_tile_gemm_pool_check_param(
+            conv_param_, fuse_pool_param_, src_shape_, dst_shape_, sum_src_ != nullptr, conv_dst_h(), conv_dst_w());
+        if (rc != ppl::common::RC_SUCCESS) {
+            return rc;
+        }
+        conv2d_nxcx_conv_tile_gemm_pool_fp32_vec128<4>(
+            src_,
+            cvt_filter_,
+            cvt_bias_,
+            (float*)temp_buffer_,
+            dst_,
+            src_shape_->GetDim(2), // src_h
+            src_shape_->GetDim(3), // src_w
+            conv_param_->pad_h,
+            conv_param_->pad_w,
+            conv_param_->kernel_h,
+            conv_param_->kernel_w,
+            conv_param_->stride_h,
+            conv_param_->stride_w,
+            conv_param_->dilation_h,
+            conv_param_->dilation_w,
+            conv_param_->channels,
+            conv_param_->num_output,
+            src_shape_->GetDim(0), // batch
+            (conv_param_->fuse_flag & conv_fuse_flag::RELU) != 0,
+            fuse_pool_param_,
+            dst_shape_->GetDim(2), // pooled dst_h
+            dst_shape_->GetDim(3), // pooled dst_w
+            {
+                tunning_param_.m_blk,
+                tunning_param_.k_blk,
+                tunning_param_.oh_blk,
+                tunning_param_.ow_blk,
+                tunning_param_.num_thread});
+        return ppl::common::RC_SUCCESS;
+    }
+
+    if (fp16_filter_) {
+        conv2d_shell_fp32<conv2d_nxcx_conv_tile_gemm_tunning_info, 4, conv2d_tile_gemm_get_real_filter_size, conv2d_n4cx_conv_tile_gemm_fp16w_riscv_per_group_fp32_vec128>(
+            src_,
+            cvt_filter_,
+            cvt_bias_,
+            (float*)temp_buffer_,
+            dst_,
+            src_shape_->GetDim(2), // src_h
+            src_shape_->GetDim(3), // src_w
+            conv_param_->pad_h,
+            conv_param_->pad_w,
+            conv_param_->kernel_h,
+            conv_param_->kernel_w,
+            conv_param_->stride_h,
+            conv_param_->stride_w,
+            conv_param_->dilation_h,
+            conv_param_->dilation_w,
+            conv_param_->channels,
+            conv_param_->num_output,
+            conv_param_->group,
+            src_shape_->GetDim(0), // batch
+            {
+                tunning_param_.m_blk,
+                tunning_param_.k_blk,
+                tunning_param_.oh_blk,
+                tunning_param_.ow_blk,
+                tunning_param_.num_thread});
+        return ppl::common::RC_SUCCESS;
+    }
+
     conv2d_shell_fp32<conv2d_nxcx_conv_tile_gemm_tunning_info, 4, conv2d_tile_gemm_get_real_filter_size, conv2d_nxcx_conv_tile_gemm_riscv_per_group_fp32_vec128<4>>(
 
         src_,
@@ -113,6 +212,9 @@ ppl::common::RetCode conv2d_n4cx_tile_gemm_fp32_runtime_executor::execute()
 
 bool conv2d_n4cx_tile_gemm_fp32_offline_manager::is_supported()
 {
+    if (is_fp16_filter()) {
+        return param_.group == 1;
+    }
     return true;
 }
 
@@ -123,7 +225,7 @@ ppl::common::RetCode conv2d_n4cx_tile_gemm_fp32_offline_manager::fast_init_tunni
 
     tunning_param_.k_blk = round_up(channels_per_group, 4) * param_.kernel_h * param_.kernel_w;
     tunning_param_.m_blk = 16;
-    tunning_param_.m_blk = min(tunning_param_.m_blk, round_up(num_outs_per_group, 4));
+    tunning_param_.m_blk = min(tunning_param_.m_blk, round_up(num_outs_per_group, is_fp16_filter() ? 8 : 4));
 
     tunning_param_.ow_blk     = 7;
     tunning_param_.oh_blk     = 3;
@@ -190,7 +292,23 @@ ppl::common::RetCode conv2d_n4cx_tile_gemm_fp32_offline_manager::gen_cvt_weights
         memset(cvt_bias_ + num_output, 0.f, (cvt_bias_size_ - num_output) * sizeof(float));
     }
 
-    {
+    if (is_fp16_filter()) {
+        cvt_filter_size_ = conv2d_n4cx_conv_tile_gemm_get_cvt_filter_size_fp16w_fp32_vec128(
+            kernel_h,
+            kernel_w,
+            channels,
+            num_output);
+
+        cvt_filter_ = (float*)allocator_->Alloc(cvt_filter_size_);
+        conv2d_n4cx_conv_tile_gemm_cvt_filter_fp16w_fp32_vec128(
+            filter,
+            kernel_h,
+            kernel_w,
+            num_output,
+            channels,
+            tunning_param_.m_blk,
+            (__fp16*)cvt_filter_);
+    } else {
         cvt_filter_size_ = conv2d_nxcx_conv_tile_gemm_get_cvt_filter_size_fp32_vec128<4>(
             kernel_h,
             kernel_w,
@@ -35,10 +35,12 @@ struct conv2d_n4cx_tile_gemm_fp32_vec128_tunning_param {
 
 class conv2d_n4cx_tile_gemm_fp32_runtime_executor final : public conv2d_runtime_executor<float> {
 public:
-    conv2d_n4cx_tile_gemm_fp32_runtime_executor() {}
-    conv2d_n4cx_tile_gemm_fp32_runtime_executor(const conv2d_common_param* conv_param, const float* cvt_filter, const float* bias, conv2d_n4cx_tile_gemm_fp32_vec128_tunning_param tunning_param)
+    conv2d_n4cx_tile_gemm_fp32_runtime_executor()
+        : fp16_filter_(false) {}
+    conv2d_n4cx_tile_gemm_fp32_runtime_executor(const conv2d_common_param* conv_param, const float* cvt_filter, const float* bias, conv2d_n4cx_tile_gemm_fp32_vec128_tunning_param tunning_param, bool fp16_filter = false)
         : conv2d_runtime_executor<float>(conv_param, cvt_filter, bias)
-        , tunning_param_(tunning_param) {}
+        , tunning_param_(tunning_param)
+        , fp16_filter_(fp16_filter) {}
 
     // calculate overall temp buffer size
     uint64_t cal_temp_buffer_size() override;
@@ -46,10 +48,19 @@ public:
     ppl::common::RetCode prepare() override;
     // execute op
     ppl::common::RetCode execute() override;
+    // pooling epilogue works on full conv rows of a single group
+    bool is_fuse_pool_supported() const override
+    {
+        return conv_param_->group == 1 && !fp16_filter_;
+    }
 
 private:
     conv2d_n4cx_tile_gemm_fp32_vec128_tunning_param tunning_param_;
+    // cvt_filter_ holds fp16 weights widened in the gemm kernel
+    bool fp16_filter_;
     void adjust_tunning_param();
+    int64_t conv_dst_h() const;
+    int64_t conv_dst_w() const;
 
     friend conv2d_n4cx_tile_gemm_fp32_offline_manager;
 };
@@ -68,11 +79,15 @@ public:
 
     conv2d_base_runtime_executor* gen_executor() override
     {
-        return new conv2d_n4cx_tile_gemm_fp32_runtime_executor(&param_, cvt_filter_, cvt_bias_, tunning_param_);
+        return new conv2d_n4cx_tile_gemm_fp32_runtime_executor(&param_, cvt_filter_, cvt_bias_, tunning_param_, is_fp16_filter());
     }
 
 private:
     conv2d_n4cx_tile_gemm_fp32_vec128_tunning_param tunning_param_;
+    bool is_fp16_filter() const
+    {
+        return algo_info_.algo_type == conv2d_common_algo::tile_gemm_fp16w;
+    }
 };
 
 }}}; // namespace ppl::kernel::riscv
@@ -23,8 +23,36 @@
 
 namespace ppl { namespace kernel { namespace riscv {
 
+int64_t conv2d_ndarray_tile_gemm_fp32_runtime_executor::conv_dst_h() const
+{
+    const int64_t flt_h_with_hole = conv_param_->dilation_h * (conv_param_->kernel_h - 1) + 1;
+    return (src_shape_->GetDim(2) + 2 * conv_param_->pad_h - flt_h_with_hole + conv_param_->stride_h) / conv_param_->stride_h;
+}
+
+int64_t conv2d_ndarray_tile_gemm_fp32_runtime_executor::conv_dst_w() const
+{
+    const int64_t flt_w_with_hole = conv_param_->dilation_w * (conv_param_->kernel_w - 1) + 1;
+    return (src_shape_->GetDim(3) + 2 * conv_param_->pad_w - flt_w_with_hole + conv_param_->stride_w) / conv_param_->stride_w;
+}
+
 uint64_t conv2d_ndarray_tile_gemm_fp32_runtime_executor::cal_temp_buffer_size()
 {
+    if (has_fuse_pool()) {
+        return conv2d_nxcx_tile_gemm_pool_get_temp_buffer_size_fp32_vec128<1>(
+            conv_param_->kernel_h,
+            conv_param_->kernel_w,
+            conv_param_->channels,
+            conv_param_->num_output,
+            conv_dst_h(),
+            conv_dst_w(),
+            fuse_pool_param_,
+            {tunning_param_.m_blk,
+             tunning_param_.k_blk,
+             tunning_param_.oh_blk,
+             tunning_param_.ow_blk,
+             tunning_param_.num_thread});
+    }
+
     size_t temp_buffer_size = conv2d_nxcx_tile_gemm_get_temp_buffer_size_fp32_vec128<1>(
         src_shape_->GetDim(2), // src_h
         src_shape_->GetDim(3), // src_w
@@ -82,6 +110,47 @@ ppl::common::RetCode conv2d_ndarray_tile_gemm_fp32_runtime_executor::execute()
         return ppl::common::RC_INVALID_VALUE;
     }
 
+    if (has_fuse_pool()) {
+        if (!is_fuse_pool_supported()) {
+            return ppl::common::RC_UNSUPPORTED;
+        }
+        auto rc = conv2d_nxcx_tile_gemm_pool_check_param(
+            conv_param_, fuse_pool_param_, src_shape_, dst_shape_, sum_src_ != nullptr, conv_dst_h(), conv_dst_w());
+        if (rc != ppl::common::RC_SUCCESS) {
+            return rc;
+        }
+        conv2d_nxcx_conv_tile_gemm_pool_fp32_vec128<1>(
+            src_,
+            cvt_filter_,
+            cvt_bias_,
+            (float*)temp_buffer_,
+            dst_,
+            src_shape_->GetDim(2), // src_h
+            src_shape_->GetDim(3), // src_w
+            conv_param_->pad_h,
+            conv_param_->pad_w,
+            conv_param_->kernel_h,
+            conv_param_->kernel_w,
+            conv_param_->stride_h,
+            conv_param_->stride_w,
+            conv_param_->dilation_h,
+            conv_param_->dilation_w,
+            conv_param_->channels,
+            conv_param_->num_output,
+            src_shape_->GetDim(0), // batch
+            (conv_param_->fuse_flag & conv_fuse_flag::RELU) != 0,
+            fuse_pool_param_,
+            dst_shape_->GetDim(2), // pooled dst_h
+            dst_shape_->GetDim(3), // pooled dst_w
+            {
+                tunning_param_.m_blk,
+                tunning_param_.k_blk,
+                tunning_param_.oh_blk,
+                tunning_param_.ow_blk,
+                tunning_param_.num_thread});
+        return ppl::common::RC_SUCCESS;
+    }
+
     conv2d_shell_fp32<conv2d_nxcx_conv_tile_gemm_tunning_info, 1, conv2d_tile_gemm_get_real_filter_size, conv2d_nxcx_conv_tile_gemm_riscv_per_group_fp32_vec128<1>>(
         src_,
         cvt_filter_,
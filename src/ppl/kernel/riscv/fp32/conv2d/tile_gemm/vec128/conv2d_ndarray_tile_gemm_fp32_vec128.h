@@ -46,10 +46,17 @@ public:
     ppl::common::RetCode prepare() override;
     // execute op
     ppl::common::RetCode execute() override;
+    // pooling epilogue works on full conv rows of a single group
+    bool is_fuse_pool_supported() const override
+    {
+        return conv_param_->group == 1;
+    }
 
 private:
     conv2d_ndarray_tile_gemm_fp32_vec128_tunning_param tunning_param_;
     void adjust_tunning_param();
+    int64_t conv_dst_h() const;
+    int64_t conv_dst_w() const;
 
     friend conv2d_ndarray_tile_gemm_fp32_offline_manager;
 };
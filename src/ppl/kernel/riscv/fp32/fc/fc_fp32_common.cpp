@@ -20,16 +20,26 @@
 #include "ppl/kernel/riscv/fp32/fc.h"
 #include "ppl/kernel/riscv/fp32/fc/vec128/fc_fp32_vec128.h"
 #include "ppl/kernel/riscv/fp32/fc/vec128/fc_ndarray_fp32_vec128.h"
+#include "ppl/kernel/riscv/fp32/fc/vec128/fc_gemv_fp32_vec128.h"
 #include "ppl/common/log.h"
 
 namespace ppl { namespace kernel { namespace riscv {
 
-fc_common_algo_info fc_algo_selector_fp32::select_algo(
+// batch <= 0 means unknown
+static fc_common_algo_info fc_fp32_select_algo(
     const ppl::common::dataformat_t& src_format,
-    const fc_common_param& param)
+    const fc_common_param& param,
+    int64_t batch)
 {
     static fc_common_algo_info unknown_info = {fc_common_algo::unknown};
     if (false) {
+    } else if (batch == 1 && (src_format == ppl::common::DATAFORMAT_NDARRAY || src_format == ppl::common::DATAFORMAT_N4CX)) {
+        return {
+            fc_common_algo::gemv,
+            src_format,
+            src_format,
+            ppl::common::DATATYPE_FLOAT32,
+            ppl::common::DATATYPE_FLOAT32};
     } else if (src_format == ppl::common::DATAFORMAT_NDARRAY) {
         return {
             fc_common_algo::standard,
@@ -50,6 +60,20 @@ fc_common_algo_info fc_algo_selector_fp32::select_algo(
     return unknown_info;
 }
 
+fc_common_algo_info fc_algo_selector_fp32::select_algo(
+    const ppl::common::dataformat_t& src_format,
+    const fc_common_param& param)
+{
+    return fc_fp32_select_algo(src_format, param, 0);
+}
+
+fc_common_algo_info fc_algo_selector_fp32::select_algo(
+    const ppl::common::TensorShape& src_shape,
+    const fc_common_param& param)
+{
+    return fc_fp32_select_algo(src_shape.GetDataFormat(), param, src_shape.GetDim(0));
+}
+
 fc_manager<float>* fc_algo_selector_fp32::gen_algo(
     const fc_common_param& param,
     const fc_common_algo_info& algo_info,
@@ -60,6 +84,8 @@ fc_manager<float>* fc_algo_selector_fp32::gen_algo(
         fc_mgr = new fc_ndarray_fp32_vec128_manager(param, allocator);
     } else if (algo_info.algo_type == fc_common_algo::standard && algo_info.input_format == ppl::common::DATAFORMAT_N4CX) {
         fc_mgr = new fc_fp32_vec128_manager(param, allocator);
+    } else if (algo_info.algo_type == fc_common_algo::gemv) {
+        fc_mgr = new fc_gemv_fp32_vec128_manager(param, allocator);
     } else {
         LOG(ERROR) << "FC gen algo failed.";
     }
@@ -25,7 +25,7 @@ namespace ppl { namespace kernel { namespace riscv {
 
 #define C_BLK() ((int64_t)4)
 
-template <int64_t atom_m>
+template <int64_t atom_m, bool first>
 void hgemm_n4chw_mxn4_riscv_fp32(
     const float* src,
     const float* flt,
@@ -37,6 +37,7 @@ void hgemm_n4chw_mxn4_riscv_fp32(
 )
 {
     asm volatile(
+        ".equ           IS_FIRST, %c[IS_FIRST]  \n\t"
         ".equ           ATOM_M, %c[ATOM_M]      \n\t"
 
         "addi           t0,     zero,   4       \n\t"
@@ -47,6 +48,7 @@ void hgemm_n4chw_mxn4_riscv_fp32(
         "mv             t2,     %[DST]          \n\t"
         "mv             t3,     %[IC]           \n\t"
 
+        ".if IS_FIRST == 1                      \n\t"
         // load bias : v31  &&  bias operation
         "vle.v          v31,    (%[BIAS])       \n\t"
 
@@ -72,6 +74,40 @@ void hgemm_n4chw_mxn4_riscv_fp32(
         ".if ATOM_M > 7                         \n\t"
         "vmv.v.v        v23,    v31             \n\t"
         ".endif                                 \n\t"
+        ".else                                  \n\t"
+        // load dst to accumulate on the previous k tile
+        "mv             t4,     t2              \n\t"
+        "vle.v          v16,    (t4)            \n\t"
+        "add            t4,     t4,     %[OHSTD]\n\t"
+        ".if ATOM_M > 1                         \n\t"
+        "vle.v          v17,    (t4)            \n\t"
+        "add            t4,     t4,     %[OHSTD]\n\t"
+        ".endif                                 \n\t"
+        ".if ATOM_M > 2                         \n\t"
+        "vle.v          v18,    (t4)            \n\t"
+        "add            t4,     t4,     %[OHSTD]\n\t"
+        ".endif                                 \n\t"
+        ".if ATOM_M > 3                         \n\t"
+        "vle.v          v19,    (t4)            \n\t"
+        "add            t4,     t4,     %[OHSTD]\n\t"
+        ".endif                                 \n\t"
+        ".if ATOM_M > 4                         \n\t"
+        "vle.v          v20,    (t4)            \n\t"
+        "add            t4,     t4,     %[OHSTD]\n\t"
+        ".endif                                 \n\t"
+        ".if ATOM_M > 5                         \n\t"
+        "vle.v          v21,    (t4)            \n\t"
+        "add            t4,     t4,     %[OHSTD]\n\t"
+        ".endif                                 \n\t"
+        ".if ATOM_M > 6                         \n\t"
+        "vle.v          v22,    (t4)            \n\t"
+        "add            t4,     t4,     %[OHSTD]\n\t"
+        ".endif                                 \n\t"
+        ".if ATOM_M > 7                         \n\t"
+        "vle.v          v23,    (t4)            \n\t"
+        "add            t4,     t4,     %[OHSTD]\n\t"
+        ".endif                                 \n\t"
+        ".endif                                 \n\t"
         // load filter : v8 - v11
         "0:                                     \n\t"
         "vle.v          v8,     (t1)            \n\t"
@@ -249,21 +285,32 @@ void hgemm_n4chw_mxn4_riscv_fp32(
         ".endif                                 \n\t"
 
         :
-        : [ATOM_M] "i"(atom_m), [SRC] "r"(src), [FLT] "r"(flt), [DST] "r"(dst), [BIAS] "r"(bias), [IC] "r"(channels), [IHSTD] "r"(channels * 4), [OHSTD] "r"(num_outs * 4)
+        : [IS_FIRST] "i"(first), [ATOM_M] "i"(atom_m), [SRC] "r"(src), [FLT] "r"(flt), [DST] "r"(dst), [BIAS] "r"(bias), [IC] "r"(channels), [IHSTD] "r"(channels * 4), [OHSTD] "r"(num_outs * 4)
         : "memory", "t0", "t1", "t2", "t3", "t4");
 }
 
 typedef void (*hgemm_n4chw_riscv_kernel_fp32_func)(const float*, const float*, const float*, float*, int32_t, int32_t);
 static const hgemm_n4chw_riscv_kernel_fp32_func hgemm_n4chw_mxn4_kernel_select[8]{
-    hgemm_n4chw_mxn4_riscv_fp32<1>,
-    hgemm_n4chw_mxn4_riscv_fp32<2>,
-    hgemm_n4chw_mxn4_riscv_fp32<3>,
-    hgemm_n4chw_mxn4_riscv_fp32<4>,
-    hgemm_n4chw_mxn4_riscv_fp32<5>,
-    hgemm_n4chw_mxn4_riscv_fp32<6>,
-    hgemm_n4chw_mxn4_riscv_fp32<7>,
-    hgemm_n4chw_mxn4_riscv_fp32<8>};
-
+    hgemm_n4chw_mxn4_riscv_fp32<1, true>,
+    hgemm_n4chw_mxn4_riscv_fp32<2, true>,
+    hgemm_n4chw_mxn4_riscv_fp32<3, true>,
+    hgemm_n4chw_mxn4_riscv_fp32<4, true>,
+    hgemm_n4chw_mxn4_riscv_fp32<5, true>,
+    hgemm_n4chw_mxn4_riscv_fp32<6, true>,
+    hgemm_n4chw_mxn4_riscv_fp32<7, true>,
+    hgemm_n4chw_mxn4_riscv_fp32<8, true>};
+static const hgemm_n4chw_riscv_kernel_fp32_func hgemm_n4chw_mxn4_acc_kernel_select[8]{
+    hgemm_n4chw_mxn4_riscv_fp32<1, false>,
+    hgemm_n4chw_mxn4_riscv_fp32<2, false>,
+    hgemm_n4chw_mxn4_riscv_fp32<3, false>,
+    hgemm_n4chw_mxn4_riscv_fp32<4, false>,
+    hgemm_n4chw_mxn4_riscv_fp32<5, false>,
+    hgemm_n4chw_mxn4_riscv_fp32<6, false>,
+    hgemm_n4chw_mxn4_riscv_fp32<7, false>,
+    hgemm_n4chw_mxn4_riscv_fp32<8, false>};
+
+// first == false accumulates onto dst, used for all but the first k tile
+template <bool first>
 void fc_n4chw_riscv_fp32(
     const float* src,
     const float* flt,
@@ -276,11 +323,12 @@ void fc_n4chw_riscv_fp32(
 {
     int32_t padded_channels = round_up(channels, C_BLK());
     int32_t padded_num_outs = round_up(num_outs, C_BLK());
+    auto kernel_select      = first ? hgemm_n4chw_mxn4_kernel_select : hgemm_n4chw_mxn4_acc_kernel_select;
 
     for (int32_t oc = 0; oc < padded_num_outs; oc += C_BLK()) {
         int32_t bc = 0;
-        for (; bc + C_BLK() < batch; bc += C_BLK()) {
-            hgemm_n4chw_mxn4_kernel_select[7](
+        for (; bc + 8 < batch; bc += 8) {
+            kernel_select[7](
                 src + padded_channels * bc,
                 flt + padded_channels * oc,
                 bias + oc,
@@ -290,7 +338,7 @@ void fc_n4chw_riscv_fp32(
                 padded_num_outs);
         }
         if (bc < batch) {
-            hgemm_n4chw_mxn4_kernel_select[batch - bc - 1](
+            kernel_select[batch - bc - 1](
                 src + padded_channels * bc,
                 flt + padded_channels * oc,
                 bias + oc,
@@ -304,9 +352,11 @@ void fc_n4chw_riscv_fp32(
 
 void fc_fp32_vec128_executor::cal_kernel_tunning_param()
 {
-    tunning_param_.m_blk = 16;
-    tunning_param_.n_blk = 16;
-    tunning_param_.k_blk = fc_param_->channels;
+    // k is blocked so that src and flt tiles of wide layers stay in cache
+    tunning_param_.m_blk      = 16;
+    tunning_param_.n_blk      = 16;
+    tunning_param_.k_blk      = 512;
+    tunning_param_.num_thread = PPL_OMP_MAX_THREADS();
 }
 
 uint64_t fc_fp32_vec128_executor::cal_temp_buffer_size()
@@ -362,7 +412,8 @@ ppl::common::RetCode fc_fp32_vec128_executor::execute()
         fc_param_->channels,
         fc_param_->num_output,
         tunning_param_,
-        fc_n4chw_riscv_fp32);
+        fc_n4chw_riscv_fp32<true>,
+        fc_n4chw_riscv_fp32<false>);
 
     return common::RC_SUCCESS;
 }
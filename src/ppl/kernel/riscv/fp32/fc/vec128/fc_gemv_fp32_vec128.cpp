@@ -0,0 +1,340 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <new>
+#include <cstring>
+
+#include "ppl/kernel/riscv/fp32/fc/vec128/fc_gemv_fp32_vec128.h"
+#include "ppl/kernel/riscv/common/fc/fc_common.h"
+#include "ppl/common/log.h"
+
+namespace ppl { namespace kernel { namespace riscv {
+
+#define C_BLK() ((int64_t)4)
+
+// dst[oc_blk * 4] = bias + src[channels] x flt, flt is oc_blk blocks of [channels][4] apart by flt_blk_stride
+template <int64_t oc_blk>
+void fc_gemv_n4cx_kernel_riscv_fp32(
+    const float* src,
+    const float* flt,
+    const float* bias,
+    float* dst,
+
+    int64_t channels,
+    int64_t flt_blk_stride)
+{
+    asm volatile(
+        ".equ           OC_BLK, %c[OC_BLK]      \n\t"
+
+        "addi           t0,     zero,   4       \n\t"
+        "vsetvli        t1,     t0,     e32     \n\t"
+
+        "mv             t0,     %[SRC]          \n\t"
+        "mv             t2,     %[FLT]          \n\t"
+        "add            t3,     t2,     %[FSTD] \n\t"
+        "add            t4,     t3,     %[FSTD] \n\t"
+        "add            t5,     t4,     %[FSTD] \n\t"
+        "mv             t1,     %[BIAS]         \n\t"
+
+        // load bias : v16 - v19, second accumulator : v20 - v23
+        "vle.v          v16,    (t1)            \n\t"
+        "addi           t1,     t1,     16      \n\t"
+        "vmv.v.i        v20,    0               \n\t"
+        ".if OC_BLK > 1                         \n\t"
+        "vle.v          v17,    (t1)            \n\t"
+        "addi           t1,     t1,     16      \n\t"
+        "vmv.v.i        v21,    0               \n\t"
+        ".endif                                 \n\t"
+        ".if OC_BLK > 2                         \n\t"
+        "vle.v          v18,    (t1)            \n\t"
+        "addi           t1,     t1,     16      \n\t"
+        "vmv.v.i        v22,    0               \n\t"
+        ".endif                                 \n\t"
+        ".if OC_BLK > 3                         \n\t"
+        "vle.v          v19,    (t1)            \n\t"
+        "addi           t1,     t1,     16      \n\t"
+        "vmv.v.i        v23,    0               \n\t"
+        ".endif                                 \n\t"
+
+        "srli           t1,     %[IC],  2       \n\t"
+        "beqz           t1,     1f              \n\t"
+        "0:                                     \n\t"
+        "flw            f0,     0(t0)           \n\t"
+        "flw            f1,     4(t0)           \n\t"
+        "flw            f2,     8(t0)           \n\t"
+        "flw            f3,     12(t0)          \n\t"
+        "addi           t0,     t0,     16      \n\t"
+        "vle.v          v0,     (t2)            \n\t"
+        "addi           t2,     t2,     16      \n\t"
+        "vle.v          v4,     (t2)            \n\t"
+        "addi           t2,     t2,     16      \n\t"
+        "vle.v          v8,     (t2)            \n\t"
+        "addi           t2,     t2,     16      \n\t"
+        "vle.v          v12,    (t2)            \n\t"
+        "addi           t2,     t2,     16      \n\t"
+        ".if OC_BLK > 1                         \n\t"
+        "vle.v          v1,     (t3)            \n\t"
+        "addi           t3,     t3,     16      \n\t"
+        "vle.v          v5,     (t3)            \n\t"
+        "addi           t3,     t3,     16      \n\t"
+        "vle.v          v9,     (t3)            \n\t"
+        "addi           t3,     t3,     16      \n\t"
+        "vle.v          v13,    (t3)            \n\t"
+        "addi           t3,     t3,     16      \n\t"
+        ".endif                                 \n\t"
+        ".if OC_BLK > 2                         \n\t"
+        "vle.v          v2,     (t4)            \n\t"
+        "addi           t4,     t4,     16      \n\t"
+        "vle.v          v6,     (t4)            \n\t"
+        "addi           t4,     t4,     16      \n\t"
+        "vle.v          v10,    (t4)            \n\t"
+        "addi           t4,     t4,     16      \n\t"
+        "vle.v          v14,    (t4)            \n\t"
+        "addi           t4,     t4,     16      \n\t"
+        ".endif                                 \n\t"
+        ".if OC_BLK > 3                         \n\t"
+        "vle.v          v3,     (t5)            \n\t"
+        "addi           t5,     t5,     16      \n\t"
+        "vle.v          v7,     (t5)            \n\t"
+        "addi           t5,     t5,     16      \n\t"
+        "vle.v          v11,    (t5)            \n\t"
+        "addi           t5,     t5,     16      \n\t"
+        "vle.v          v15,    (t5)            \n\t"
+        "addi           t5,     t5,     16      \n\t"
+        ".endif                                 \n\t"
+        "vfmacc.vf      v16,    f0,     v0      \n\t"
+        ".if OC_BLK > 1                         \n\t"
+        "vfmacc.vf      v17,    f0,     v1      \n\t"
+        ".endif                                 \n\t"
+        ".if OC_BLK > 2                         \n\t"
+        "vfmacc.vf      v18,    f0,     v2      \n\t"
+        ".endif                                 \n\t"
+        ".if OC_BLK > 3                         \n\t"
+        "vfmacc.vf      v19,    f0,     v3      \n\t"
+        ".endif                                 \n\t"
+        "vfmacc.vf      v20,    f1,     v4      \n\t"
+        ".if OC_BLK > 1                         \n\t"
+        "vfmacc.vf      v21,    f1,     v5      \n\t"
+        ".endif                                 \n\t"
+        ".if OC_BLK > 2                         \n\t"
+        "vfmacc.vf      v22,    f1,     v6      \n\t"
+        ".endif                                 \n\t"
+        ".if OC_BLK > 3                         \n\t"
+        "vfmacc.vf      v23,    f1,     v7      \n\t"
+        ".endif                                 \n\t"
+        "vfmacc.vf      v16,    f2,     v8      \n\t"
+        ".if OC_BLK > 1                         \n\t"
+        "vfmacc.vf      v17,    f2,     v9      \n\t"
+        ".endif                                 \n\t"
+        ".if OC_BLK > 2                         \n\t"
+        "vfmacc.vf      v18,    f2,     v10     \n\t"
+        ".endif                                 \n\t"
+        ".if OC_BLK > 3                         \n\t"
+        "vfmacc.vf      v19,    f2,     v11     \n\t"
+        ".endif                                 \n\t"
+        "vfmacc.vf      v20,    f3,     v12     \n\t"
+        ".if OC_BLK > 1                         \n\t"
+        "vfmacc.vf      v21,    f3,     v13     \n\t"
+        ".endif                                 \n\t"
+        ".if OC_BLK > 2                         \n\t"
+        "vfmacc.vf      v22,    f3,     v14     \n\t"
+        ".endif                                 \n\t"
+        ".if OC_BLK > 3                         \n\t"
+        "vfmacc.vf      v23,    f3,     v15     \n\t"
+        ".endif                                 \n\t"
+        "addi           t1,     t1,     -1      \n\t"
+        "bnez           t1,     0b              \n\t"
+
+        // channels left
+        "1:                                     \n\t"
+        "andi           t1,     %[IC],  3       \n\t"
+        "beqz           t1,     3f              \n\t"
+        "2:                                     \n\t"
+        "flw            f0,     0(t0)           \n\t"
+        "addi           t0,     t0,     4       \n\t"
+        "vle.v          v0,     (t2)            \n\t"
+        "addi           t2,     t2,     16      \n\t"
+        "vfmacc.vf      v16,    f0,     v0      \n\t"
+        ".if OC_BLK > 1                         \n\t"
+        "vle.v          v1,     (t3)            \n\t"
+        "addi           t3,     t3,     16      \n\t"
+        "vfmacc.vf      v17,    f0,     v1      \n\t"
+        ".endif                                 \n\t"
+        ".if OC_BLK > 2                         \n\t"
+        "vle.v          v2,     (t4)            \n\t"
+        "addi           t4,     t4,     16      \n\t"
+        "vfmacc.vf      v18,    f0,     v2      \n\t"
+        ".endif                                 \n\t"
+        ".if OC_BLK > 3                         \n\t"
+        "vle.v          v3,     (t5)            \n\t"
+        "addi           t5,     t5,     16      \n\t"
+        "vfmacc.vf      v19,    f0,     v3      \n\t"
+        ".endif                                 \n\t"
+        "addi           t1,     t1,     -1      \n\t"
+        "bnez           t1,     2b              \n\t"
+
+        "3:                                     \n\t"
+        "vfadd.vv       v16,    v16,    v20     \n\t"
+        ".if OC_BLK > 1                         \n\t"
+        "vfadd.vv       v17,    v17,    v21     \n\t"
+        ".endif                                 \n\t"
+        ".if OC_BLK > 2                         \n\t"
+        "vfadd.vv       v18,    v18,    v22     \n\t"
+        ".endif                                 \n\t"
+        ".if OC_BLK > 3                         \n\t"
+        "vfadd.vv       v19,    v19,    v23     \n\t"
+        ".endif                                 \n\t"
+        "mv             t2,     %[DST]          \n\t"
+        "vse.v          v16,    (t2)            \n\t"
+        "addi           t2,     t2,     16      \n\t"
+        ".if OC_BLK > 1                         \n\t"
+        "vse.v          v17,    (t2)            \n\t"
+        "addi           t2,     t2,     16      \n\t"
+        ".endif                                 \n\t"
+        ".if OC_BLK > 2                         \n\t"
+        "vse.v          v18,    (t2)            \n\t"
+        "addi           t2,     t2,     16      \n\t"
+        ".endif                                 \n\t"
+        ".if OC_BLK > 3                         \n\t"
+        "vse.v          v19,    (t2)            \n\t"
+        "addi           t2,     t2,     16      \n\t"
+        ".endif                                 \n\t"
+
+        :
+        : [OC_BLK] "i"(oc_blk), [SRC] "r"(src), [FLT] "r"(flt), [DST] "r"(dst), [BIAS] "r"(bias), [IC] "r"(channels), [FSTD] "r"(flt_blk_stride * 4)
+        : "memory", "t0", "t1", "t2", "t3", "t4", "t5", "ft0", "ft1", "ft2", "ft3", "v0", "v1", "v2", "v3", "v4", "v5", "v6", "v7", "v8", "v9", "v10", "v11", "v12", "v13", "v14", "v15", "v16", "v17", "v18", "v19", "v20", "v21", "v22", "v23", "v24", "v25", "v26", "v27", "v28", "v29", "v30", "v31");
+}
+
+typedef void (*fc_gemv_n4cx_kernel_riscv_fp32_func)(const float*, const float*, const float*, float*, int64_t, int64_t);
+static const fc_gemv_n4cx_kernel_riscv_fp32_func fc_gemv_n4cx_kernel_select[4]{
+    fc_gemv_n4cx_kernel_riscv_fp32<1>,
+    fc_gemv_n4cx_kernel_riscv_fp32<2>,
+    fc_gemv_n4cx_kernel_riscv_fp32<3>,
+    fc_gemv_n4cx_kernel_riscv_fp32<4>};
+
+void fc_gemv_n4cx_riscv_fp32(
+    const float* src,
+    const float* flt,
+    const float* bias,
+    float* dst,
+
+    const int64_t batch,
+    const int64_t channels,
+    const int64_t num_outs,
+    const int64_t src_stride,
+    const int64_t dst_stride)
+{
+    const int64_t oc_blk          = 4 * C_BLK();
+    const int64_t padded_channels = round_up(channels, C_BLK());
+    const int64_t padded_num_outs = round_up(num_outs, C_BLK());
+    const int64_t num_oc_blk      = div_up(padded_num_outs, oc_blk);
+
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t i = 0; i < num_oc_blk; i += 1) {
+        const int64_t oc     = i * oc_blk;
+        const int64_t oc_len = min(padded_num_outs - oc, oc_blk);
+        auto kernel_func     = fc_gemv_n4cx_kernel_select[oc_len / C_BLK() - 1];
+        // batch rows reuse the same filter block while it is still in cache
+        for (int64_t b = 0; b < batch; b += 1) {
+            auto src_ptr = src + b * src_stride;
+            auto dst_ptr = dst + b * dst_stride + oc;
+            if (oc + oc_len <= dst_stride) {
+                kernel_func(src_ptr, flt + oc * padded_channels, bias + oc, dst_ptr, channels, padded_channels * C_BLK());
+            } else {
+                float dst_tail[4 * C_BLK()];
+                kernel_func(src_ptr, flt + oc * padded_channels, bias + oc, dst_tail, channels, padded_channels * C_BLK());
+                memcpy(dst_ptr, dst_tail, (dst_stride - oc) * sizeof(float));
+            }
+        }
+    }
+}
+
+uint64_t fc_gemv_fp32_vec128_executor::cal_temp_buffer_size()
+{
+    return 0;
+}
+
+ppl::common::RetCode fc_gemv_fp32_vec128_executor::prepare()
+{
+    if (!fc_param_ || !src_shape_ || !dst_shape_) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+
+    LOG(DEBUG) << "FC gemv prepare";
+
+    return ppl::common::RC_SUCCESS;
+}
+
+ppl::common::RetCode fc_gemv_fp32_vec128_executor::execute()
+{
+    if (!fc_param_ || !cvt_filter_ || !cvt_bias_ || !src_ || !dst_) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+
+    LOG(DEBUG) << "FC gemv execute";
+
+    // ndarray rows are dense, n4cx rows are padded to C_BLK
+    const bool is_ndarray = src_shape_->GetDataFormat() == ppl::common::DATAFORMAT_NDARRAY;
+    fc_gemv_n4cx_riscv_fp32(
+        src_,
+        cvt_filter_,
+        cvt_bias_,
+        dst_,
+        src_shape_->GetDim(0),
+        fc_param_->channels,
+        fc_param_->num_output,
+        is_ndarray ? fc_param_->channels : round_up(fc_param_->channels, C_BLK()),
+        is_ndarray ? fc_param_->num_output : round_up(fc_param_->num_output, C_BLK()));
+
+    return ppl::common::RC_SUCCESS;
+}
+
+ppl::common::RetCode fc_gemv_fp32_vec128_manager::gen_cvt_weights(const float* filter, const float* bias)
+{
+    if (cvt_bias_ != nullptr || cvt_filter_ != nullptr) {
+        return ppl::common::RC_PERMISSION_DENIED;
+    }
+
+    const int32_t padded_oc = round_up(param_.num_output, C_BLK());
+    {
+        cvt_bias_size_ = padded_oc;
+        cvt_bias_      = (float*)allocator_->Alloc(cvt_bias_size_ * sizeof(float));
+        if (cvt_bias_ == nullptr) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        memcpy(cvt_bias_, bias, param_.num_output * sizeof(float));
+        memset(cvt_bias_ + param_.num_output, 0, (padded_oc - param_.num_output) * sizeof(float));
+    }
+
+    {
+        const int32_t padded_ic = round_up(param_.channels, C_BLK());
+        cvt_filter_size_        = padded_ic * padded_oc * sizeof(float);
+        cvt_filter_             = (float*)allocator_->Alloc(cvt_filter_size_);
+        if (cvt_filter_ == nullptr) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        fc_common_cvt_flt_to_nxcx<float, C_BLK()>(filter, cvt_filter_, param_.num_output, param_.channels);
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+fc_executor<float>* fc_gemv_fp32_vec128_manager::gen_executor()
+{
+    return new fc_gemv_fp32_vec128_executor(&param_, cvt_filter_, cvt_bias_);
+}
+
+}}}; // namespace ppl::kernel::riscv
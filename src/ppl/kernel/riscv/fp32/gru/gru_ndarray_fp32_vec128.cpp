@@ -0,0 +1,195 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <riscv-vector.h>
+
+#include "ppl/kernel/riscv/common/gru/gru_ndarray_common.h"
+#include "ppl/kernel/riscv/common/vector_math/vector_math_kernel.h"
+#include "ppl/kernel/riscv/fp32/fc/vec128/kernel/fc_ndarray_kernel_fp32_vec128.h"
+
+namespace ppl { namespace kernel { namespace riscv {
+
+#define ATOM_N()     ((int64_t)4)
+#define ATOM_K()     ((int64_t)4)
+#define FLT_ATOM_N() ((int64_t)16)
+
+inline void gru_reset_kernel_fp32(
+    const float* x_gate,
+    const float* h_gate,
+    const float* h,
+    const int64_t hidden_size,
+    const int64_t i,
+    const uint64_t vl,
+    float* rh)
+{
+    float32xm1_t rt = vfaddvv_float32xm1(vlev_float32xm1(x_gate + hidden_size + i, vl), vlev_float32xm1(h_gate + hidden_size + i, vl), vl);
+    rt              = vfsigmoid_float32xm1(rt, vl);
+    vsev_float32xm1(rh + i, vfmulvv_float32xm1(rt, vlev_float32xm1(h + i, vl), vl), vl);
+}
+
+static void gru_reset_fp32(
+    const float* x_gate,
+    const float* h_gate,
+    const float* h,
+    const int64_t hidden_size,
+    float* rh)
+{
+    const int64_t atom_c = 4;
+    const auto vl        = vsetvli(atom_c, RVV_E32, RVV_M1);
+
+    int64_t i = 0;
+    for (; i + atom_c <= hidden_size; i += atom_c) {
+        gru_reset_kernel_fp32(x_gate, h_gate, h, hidden_size, i, vl, rh);
+    }
+    if (i < hidden_size) {
+        const auto tail_vl = vsetvli(hidden_size - i, RVV_E32, RVV_M1);
+        gru_reset_kernel_fp32(x_gate, h_gate, h, hidden_size, i, tail_vl, rh);
+    }
+}
+
+template <bool linear_before_reset>
+inline void gru_cell_kernel_fp32(
+    const float* x_gate,
+    const float* h_gate,
+    const float* hh,
+    const int64_t hidden_size,
+    const int64_t i,
+    const uint64_t vl,
+    float* h)
+{
+    float32xm1_t zt = vfaddvv_float32xm1(vlev_float32xm1(x_gate + i, vl), vlev_float32xm1(h_gate + i, vl), vl);
+    float32xm1_t ht = vlev_float32xm1(hh + i, vl);
+    if (linear_before_reset) {
+        float32xm1_t rt = vfaddvv_float32xm1(vlev_float32xm1(x_gate + hidden_size + i, vl), vlev_float32xm1(h_gate + hidden_size + i, vl), vl);
+        ht              = vfmulvv_float32xm1(vfsigmoid_float32xm1(rt, vl), ht, vl);
+    }
+    zt = vfsigmoid_float32xm1(zt, vl);
+    ht = vftanh_float32xm1(vfaddvv_float32xm1(vlev_float32xm1(x_gate + 2 * hidden_size + i, vl), ht, vl), vl);
+
+    // (1 - z) * h~ + z * h_{t-1}
+    float32xm1_t h_prev = vlev_float32xm1(h + i, vl);
+    vsev_float32xm1(h + i, vfmaccvv_float32xm1(ht, zt, vfsubvv_float32xm1(h_prev, ht, vl), vl), vl);
+}
+
+template <bool linear_before_reset>
+static void gru_cell_fp32(
+    const float* x_gate,
+    const float* h_gate,
+    const float* hh,
+    const int64_t hidden_size,
+    float* h)
+{
+    const int64_t atom_c = 4;
+    const auto vl        = vsetvli(atom_c, RVV_E32, RVV_M1);
+
+    int64_t i = 0;
+    for (; i + atom_c <= hidden_size; i += atom_c) {
+        gru_cell_kernel_fp32<linear_before_reset>(x_gate, h_gate, hh, hidden_size, i, vl, h);
+    }
+    if (i < hidden_size) {
+        const auto tail_vl = vsetvli(hidden_size - i, RVV_E32, RVV_M1);
+        gru_cell_kernel_fp32<linear_before_reset>(x_gate, h_gate, hh, hidden_size, i, tail_vl, h);
+    }
+}
+
+uint64_t gru_ndarray_get_packed_W_bytes_fp32(
+    const rnn_direction_t direction,
+    const int64_t hidden_size,
+    const int64_t input_size)
+{
+    return gru_ndarray_common_packed_w_size<float, ATOM_K(), FLT_ATOM_N()>(direction, hidden_size, input_size);
+}
+
+ppl::common::RetCode gru_ndarray_pack_W_fp32(
+    const float* W,
+    const rnn_direction_t direction,
+    const int64_t hidden_size,
+    const int64_t input_size,
+    float* packed_W)
+{
+    gru_ndarray_common_pack_w<float, ATOM_K(), FLT_ATOM_N()>(W, direction, hidden_size, input_size, packed_W);
+    return ppl::common::RC_SUCCESS;
+}
+
+uint64_t gru_ndarray_get_packed_R_bytes_fp32(
+    const rnn_direction_t direction,
+    const int64_t hidden_size)
+{
+    return gru_ndarray_common_packed_r_size<float, ATOM_K(), FLT_ATOM_N()>(direction, hidden_size);
+}
+
+ppl::common::RetCode gru_ndarray_pack_R_fp32(
+    const float* R,
+    const rnn_direction_t direction,
+    const int64_t hidden_size,
+    float* packed_R)
+{
+    gru_ndarray_common_pack_r<float, ATOM_K(), FLT_ATOM_N()>(R, direction, hidden_size, packed_R);
+    return ppl::common::RC_SUCCESS;
+}
+
+uint64_t gru_ndarray_get_buffer_bytes_fp32(
+    const ppl::common::TensorShape* X_shape,
+    const rnn_direction_t direction,
+    const int64_t hidden_size,
+    const bool has_Y_h,
+    const bool packed_W,
+    const bool packed_R)
+{
+    return gru_ndarray_common_temp_buffer_size<float, ATOM_K(), FLT_ATOM_N()>(X_shape, direction, hidden_size, has_Y_h, packed_W, packed_R);
+}
+
+ppl::common::RetCode gru_ndarray_fp32(
+    const ppl::common::TensorShape* X_shape,
+    const float* X,
+    const float* W,
+    const float* R,
+    const float* bias,
+    const int32_t* sequence_lens,
+    const float* initial_h,
+    const rnn_direction_t direction,
+    const int64_t hidden_size,
+    const bool linear_before_reset,
+    const bool packed_W,
+    const bool packed_R,
+    void* temp_buffer,
+    float* Y,
+    float* Y_h)
+{
+    return gru_ndarray_common_execute<float, ATOM_N(), ATOM_K(), FLT_ATOM_N()>(
+        X_shape,
+        X,
+        W,
+        R,
+        bias,
+        sequence_lens,
+        initial_h,
+        direction,
+        hidden_size,
+        linear_before_reset,
+        packed_W,
+        packed_R,
+        temp_buffer,
+        fc_ndarray_select_gemm_kernel_fp32_vec128<true>,
+        fc_ndarray_select_gemm_kernel_fp32_vec128<false>,
+        gru_reset_fp32,
+        linear_before_reset ? gru_cell_fp32<true> : gru_cell_fp32<false>,
+        Y,
+        Y_h);
+}
+
+}}}; // namespace ppl::kernel::riscv
@@ -0,0 +1,147 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <math.h>
+#include <riscv-vector.h>
+
+#include "ppl/kernel/riscv/common/internal_include.h"
+
+namespace ppl { namespace kernel { namespace riscv {
+
+#define C_BLK() ((int64_t)4)
+
+// mean and 1 / sqrt(var + eps) of one row in one pass. sums are taken around the first element
+// of the row (shifted data), which keeps Σx² - (Σx)² / n from cancelling when |mean| >> std.
+static inline void layernorm_row_stat_fp32(
+    const float* src,
+    const int64_t len,
+    const float eps,
+    float* mean,
+    float* rstd)
+{
+    const auto vl     = vsetvli(C_BLK(), RVV_E32, RVV_M1);
+    const float shift = src[0];
+
+    float32xm1_t vsum0 = vfmvvf_float32xm1(0.0f, vl);
+    float32xm1_t vsum1 = vfmvvf_float32xm1(0.0f, vl);
+    float32xm1_t vsqr0 = vfmvvf_float32xm1(0.0f, vl);
+    float32xm1_t vsqr1 = vfmvvf_float32xm1(0.0f, vl);
+    int64_t i          = 0;
+    for (; i + 2 * C_BLK() <= len; i += 2 * C_BLK()) {
+        const float32xm1_t x0 = vfsubvf_float32xm1(vlev_float32xm1(src + i + 0 * C_BLK(), vl), shift, vl);
+        const float32xm1_t x1 = vfsubvf_float32xm1(vlev_float32xm1(src + i + 1 * C_BLK(), vl), shift, vl);
+        vsum0                 = vfaddvv_float32xm1(vsum0, x0, vl);
+        vsum1                 = vfaddvv_float32xm1(vsum1, x1, vl);
+        vsqr0                 = vfmaccvv_float32xm1(vsqr0, x0, x0, vl);
+        vsqr1                 = vfmaccvv_float32xm1(vsqr1, x1, x1, vl);
+    }
+    for (; i + C_BLK() <= len; i += C_BLK()) {
+        const float32xm1_t x0 = vfsubvf_float32xm1(vlev_float32xm1(src + i, vl), shift, vl);
+        vsum0                 = vfaddvv_float32xm1(vsum0, x0, vl);
+        vsqr0                 = vfmaccvv_float32xm1(vsqr0, x0, x0, vl);
+    }
+
+    float sum_data[C_BLK()];
+    float sqr_data[C_BLK()];
+    vsev_float32xm1(sum_data, vfaddvv_float32xm1(vsum0, vsum1, vl), vl);
+    vsev_float32xm1(sqr_data, vfaddvv_float32xm1(vsqr0, vsqr1, vl), vl);
+    float sum = 0.0f;
+    float sqr = 0.0f;
+    for (int64_t k = 0; k < C_BLK(); k++) {
+        sum += sum_data[k];
+        sqr += sqr_data[k];
+    }
+    for (; i < len; i++) {
+        const float x = src[i] - shift;
+        sum += x;
+        sqr += x * x;
+    }
+
+    const float shifted_mean = sum / len;
+    const float var          = sqr / len - shifted_mean * shifted_mean;
+    *mean                    = shift + shifted_mean;
+    *rstd                    = 1.0f / sqrtf((var > 0.0f ? var : 0.0f) + eps);
+}
+
+template <bool has_scale, bool has_shift>
+static void layernorm_ndarray_kernel_fp32(
+    const float* src,
+    const float* scale,
+    const float* shift,
+    const int64_t outer_dim,
+    const int64_t inner_dim,
+    const float eps,
+    float* dst)
+{
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t o = 0; o < outer_dim; o++) {
+        const float* src_ = src + o * inner_dim;
+        float* dst_       = dst + o * inner_dim;
+
+        float mean, rstd;
+        layernorm_row_stat_fp32(src_, inner_dim, eps, &mean, &rstd);
+
+        for (int64_t i = 0; i < inner_dim; i += C_BLK()) {
+            const auto vl  = vsetvli(inner_dim - i, RVV_E32, RVV_M1);
+            float32xm1_t y = vfmulvf_float32xm1(vfsubvf_float32xm1(vlev_float32xm1(src_ + i, vl), mean, vl), rstd, vl);
+            if (has_scale) y = vfmulvv_float32xm1(y, vlev_float32xm1(scale + i, vl), vl);
+            if (has_shift) y = vfaddvv_float32xm1(y, vlev_float32xm1(shift + i, vl), vl);
+            vsev_float32xm1(dst_ + i, y, vl);
+        }
+    }
+}
+
+ppl::common::RetCode layernorm_ndarray_fp32(
+    const ppl::common::TensorShape* src_shape,
+    const float* src,
+    const float* scale,
+    const float* shift,
+    const int64_t axis,
+    const float eps,
+    float* dst)
+{
+    const int64_t dim_count = src_shape->GetDimCount();
+    const int64_t real_axis = axis < 0 ? axis + dim_count : axis;
+    if (real_axis < 0 || real_axis >= dim_count) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+
+    int64_t outer_dim = 1;
+    int64_t inner_dim = 1;
+    for (int64_t i = 0; i < real_axis; i++) {
+        outer_dim *= src_shape->GetDim(i);
+    }
+    for (int64_t i = real_axis; i < dim_count; i++) {
+        inner_dim *= src_shape->GetDim(i);
+    }
+    if (inner_dim == 0) {
+        return ppl::common::RC_SUCCESS;
+    }
+
+    if (scale && shift) {
+        layernorm_ndarray_kernel_fp32<true, true>(src, scale, shift, outer_dim, inner_dim, eps, dst);
+    } else if (scale) {
+        layernorm_ndarray_kernel_fp32<true, false>(src, scale, shift, outer_dim, inner_dim, eps, dst);
+    } else if (shift) {
+        layernorm_ndarray_kernel_fp32<false, true>(src, scale, shift, outer_dim, inner_dim, eps, dst);
+    } else {
+        layernorm_ndarray_kernel_fp32<false, false>(src, scale, shift, outer_dim, inner_dim, eps, dst);
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+}}}; // namespace ppl::kernel::riscv
@@ -0,0 +1,181 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <riscv-vector.h>
+
+#include "ppl/kernel/riscv/common/lstm/lstm_ndarray_common.h"
+#include "ppl/kernel/riscv/common/vector_math/vector_math_kernel.h"
+#include "ppl/kernel/riscv/fp32/fc/vec128/kernel/fc_ndarray_kernel_fp32_vec128.h"
+
+namespace ppl { namespace kernel { namespace riscv {
+
+#define ATOM_N()     ((int64_t)4)
+#define ATOM_K()     ((int64_t)4)
+#define FLT_ATOM_N() ((int64_t)16)
+
+template <bool with_peephole>
+inline void lstm_cell_kernel_fp32(
+    const float* x_gate,
+    const float* h_gate,
+    const float* P,
+    const int64_t hidden_size,
+    const int64_t i,
+    const uint64_t vl,
+    float* c,
+    float* h)
+{
+    const int64_t gi = 0 * hidden_size + i;
+    const int64_t go = 1 * hidden_size + i;
+    const int64_t gf = 2 * hidden_size + i;
+    const int64_t gc = 3 * hidden_size + i;
+
+    float32xm1_t c_prev = vlev_float32xm1(c + i, vl);
+    float32xm1_t it     = vfaddvv_float32xm1(vlev_float32xm1(x_gate + gi, vl), vlev_float32xm1(h_gate + gi, vl), vl);
+    float32xm1_t ot     = vfaddvv_float32xm1(vlev_float32xm1(x_gate + go, vl), vlev_float32xm1(h_gate + go, vl), vl);
+    float32xm1_t ft     = vfaddvv_float32xm1(vlev_float32xm1(x_gate + gf, vl), vlev_float32xm1(h_gate + gf, vl), vl);
+    float32xm1_t ct     = vfaddvv_float32xm1(vlev_float32xm1(x_gate + gc, vl), vlev_float32xm1(h_gate + gc, vl), vl);
+    if (with_peephole) {
+        it = vfmaccvv_float32xm1(it, c_prev, vlev_float32xm1(P + 0 * hidden_size + i, vl), vl);
+        ft = vfmaccvv_float32xm1(ft, c_prev, vlev_float32xm1(P + 2 * hidden_size + i, vl), vl);
+    }
+    it = vfsigmoid_float32xm1(it, vl);
+    ft = vfsigmoid_float32xm1(ft, vl);
+    ct = vftanh_float32xm1(ct, vl);
+
+    float32xm1_t c_next = vfmaccvv_float32xm1(vfmulvv_float32xm1(ft, c_prev, vl), it, ct, vl);
+    if (with_peephole) {
+        ot = vfmaccvv_float32xm1(ot, c_next, vlev_float32xm1(P + 1 * hidden_size + i, vl), vl);
+    }
+    ot = vfsigmoid_float32xm1(ot, vl);
+
+    vsev_float32xm1(c + i, c_next, vl);
+    vsev_float32xm1(h + i, vfmulvv_float32xm1(ot, vftanh_float32xm1(c_next, vl), vl), vl);
+}
+
+template <bool with_peephole>
+static void lstm_cell_fp32(
+    const float* x_gate,
+    const float* h_gate,
+    const float* P,
+    const int64_t hidden_size,
+    float* c,
+    float* h)
+{
+    const int64_t atom_c = 4;
+    const auto vl        = vsetvli(atom_c, RVV_E32, RVV_M1);
+
+    int64_t i = 0;
+    for (; i + atom_c <= hidden_size; i += atom_c) {
+        lstm_cell_kernel_fp32<with_peephole>(x_gate, h_gate, P, hidden_size, i, vl, c, h);
+    }
+    if (i < hidden_size) {
+        const auto tail_vl = vsetvli(hidden_size - i, RVV_E32, RVV_M1);
+        lstm_cell_kernel_fp32<with_peephole>(x_gate, h_gate, P, hidden_size, i, tail_vl, c, h);
+    }
+}
+
+uint64_t lstm_ndarray_get_packed_W_bytes_fp32(
+    const rnn_direction_t direction,
+    const int64_t hidden_size,
+    const int64_t input_size)
+{
+    return lstm_ndarray_common_packed_w_size<float, ATOM_K(), FLT_ATOM_N()>(direction, hidden_size, input_size);
+}
+
+ppl::common::RetCode lstm_ndarray_pack_W_fp32(
+    const float* W,
+    const rnn_direction_t direction,
+    const int64_t hidden_size,
+    const int64_t input_size,
+    float* packed_W)
+{
+    lstm_ndarray_common_pack_w<float, ATOM_K(), FLT_ATOM_N()>(W, direction, hidden_size, input_size, packed_W);
+    return ppl::common::RC_SUCCESS;
+}
+
+uint64_t lstm_ndarray_get_packed_R_bytes_fp32(
+    const rnn_direction_t direction,
+    const int64_t hidden_size)
+{
+    return lstm_ndarray_common_packed_w_size<float, ATOM_K(), FLT_ATOM_N()>(direction, hidden_size, hidden_size);
+}
+
+ppl::common::RetCode lstm_ndarray_pack_R_fp32(
+    const float* R,
+    const rnn_direction_t direction,
+    const int64_t hidden_size,
+    float* packed_R)
+{
+    lstm_ndarray_common_pack_w<float, ATOM_K(), FLT_ATOM_N()>(R, direction, hidden_size, hidden_size, packed_R);
+    return ppl::common::RC_SUCCESS;
+}
+
+uint64_t lstm_ndarray_get_buffer_bytes_fp32(
+    const ppl::common::TensorShape* X_shape,
+    const rnn_direction_t direction,
+    const int64_t hidden_size,
+    const bool has_Y_h,
+    const bool has_Y_c,
+    const bool packed_W,
+    const bool packed_R)
+{
+    return lstm_ndarray_common_temp_buffer_size<float, ATOM_K(), FLT_ATOM_N()>(X_shape, direction, hidden_size, has_Y_h, has_Y_c, packed_W, packed_R);
+}
+
+ppl::common::RetCode lstm_ndarray_fp32(
+    const ppl::common::TensorShape* X_shape,
+    const float* X,
+    const float* W,
+    const float* R,
+    const float* P,
+    const float* bias,
+    const int32_t* sequence_lens,
+    const float* initial_h,
+    const float* initial_c,
+    const rnn_direction_t direction,
+    const int64_t hidden_size,
+    const bool packed_W,
+    const bool packed_R,
+    void* temp_buffer,
+    float* Y,
+    float* Y_h,
+    float* Y_c)
+{
+    return lstm_ndarray_common_execute<float, ATOM_N(), ATOM_K(), FLT_ATOM_N()>(
+        X_shape,
+        X,
+        W,
+        R,
+        P,
+        bias,
+        sequence_lens,
+        initial_h,
+        initial_c,
+        direction,
+        hidden_size,
+        packed_W,
+        packed_R,
+        temp_buffer,
+        fc_ndarray_select_gemm_kernel_fp32_vec128<true>,
+        fc_ndarray_select_gemm_kernel_fp32_vec128<false>,
+        P ? lstm_cell_fp32<true> : lstm_cell_fp32<false>,
+        Y,
+        Y_h,
+        Y_c);
+}
+
+}}}; // namespace ppl::kernel::riscv
@@ -0,0 +1,112 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/kernel/riscv/common/matmul/matmul_ndarray_common.h"
+#include "ppl/kernel/riscv/fp32/fc/vec128/kernel/fc_ndarray_kernel_fp32_vec128.h"
+
+namespace ppl { namespace kernel { namespace riscv {
+
+#define ATOM_N()     ((int64_t)4)
+#define ATOM_K()     ((int64_t)4)
+#define FLT_ATOM_N() ((int64_t)16)
+
+uint64_t matmul_ndarray_get_packed_b_bytes_fp32(
+    const ppl::common::TensorShape* B_shape,
+    const bool transB)
+{
+    matmul_ndarray_param param;
+    if (matmul_ndarray_common_parse_b(B_shape, transB, &param.k, &param.n, &param.b_batch) != ppl::common::RC_SUCCESS) {
+        return 0;
+    }
+    return matmul_ndarray_common_packed_b_size<float, ATOM_K(), FLT_ATOM_N()>(param);
+}
+
+ppl::common::RetCode matmul_ndarray_pack_b_fp32(
+    const ppl::common::TensorShape* B_shape,
+    const float* B,
+    const bool transB,
+    float* packed_B)
+{
+    matmul_ndarray_param param;
+    auto rc = matmul_ndarray_common_parse_b(B_shape, transB, &param.k, &param.n, &param.b_batch);
+    if (rc != ppl::common::RC_SUCCESS) {
+        return rc;
+    }
+    matmul_ndarray_common_pack_b<float, ATOM_K(), FLT_ATOM_N()>(B, param, transB, packed_B);
+    return ppl::common::RC_SUCCESS;
+}
+
+uint64_t matmul_ndarray_get_buffer_bytes_fp32(
+    const ppl::common::TensorShape* A_shape,
+    const ppl::common::TensorShape* B_shape,
+    const bool transA,
+    const bool transB,
+    const bool packedB)
+{
+    matmul_ndarray_param param;
+    if (matmul_ndarray_common_parse_param(A_shape, B_shape, transA, transB, &param) != ppl::common::RC_SUCCESS) {
+        return 0;
+    }
+    return matmul_ndarray_common_temp_buffer_size<float, ATOM_K(), FLT_ATOM_N()>(param, matmul_ndarray_common_tunning_param(), packedB);
+}
+
+ppl::common::RetCode matmul_ndarray_fp32(
+    const ppl::common::TensorShape* A_shape,
+    const ppl::common::TensorShape* B_shape,
+    const float* A,
+    const float* B,
+    const bool transA,
+    const bool transB,
+    const bool packedB,
+    void* temp_buffer,
+    float* Y)
+{
+    matmul_ndarray_param param;
+    auto rc = matmul_ndarray_common_parse_param(A_shape, B_shape, transA, transB, &param);
+    if (rc != ppl::common::RC_SUCCESS) {
+        return rc;
+    }
+    if (param.batch * param.m * param.n == 0) {
+        return ppl::common::RC_SUCCESS;
+    }
+    if (param.k == 0) {
+        memset(Y, 0, param.batch * param.m * param.n * sizeof(float));
+        return ppl::common::RC_SUCCESS;
+    }
+
+    const float* packed_B = B;
+    uint8_t* buffer      = (uint8_t*)temp_buffer;
+    if (!packedB) {
+        packed_B = (float*)buffer;
+        matmul_ndarray_common_pack_b<float, ATOM_K(), FLT_ATOM_N()>(B, param, transB, (float*)buffer);
+        buffer += round_up(matmul_ndarray_common_packed_b_size<float, ATOM_K(), FLT_ATOM_N()>(param), 64);
+    }
+
+    return matmul_ndarray_common_execute<float, ATOM_N(), ATOM_K(), FLT_ATOM_N()>(
+        A,
+        packed_B,
+        nullptr,
+        param,
+        matmul_ndarray_common_tunning_param(),
+        transA,
+        buffer,
+        fc_ndarray_select_gemm_kernel_fp32_vec128<true>,
+        fc_ndarray_select_gemm_kernel_fp32_vec128<false>,
+        Y);
+}
+
+}}}; // namespace ppl::kernel::riscv
@@ -15,6 +15,8 @@
 // // specific language governing permissions and limitations
 // // under the License.
 
+#include <riscv-vector.h>
+
 #include <algorithm>
 #include <vector>
 
@@ -22,46 +24,77 @@
 
 namespace ppl { namespace kernel { namespace riscv {
 
-inline float calc_iou(const float *p_boxes, int64_t i0, int64_t i1, bool centered)
+// boxes are converted once per batch to [x1, y1, x2, y2, area] planes shared by every class
+static void nms_prepare_boxes(
+    const float *p_boxes,
+    const int64_t num_boxes,
+    const bool centered,
+    float *planes)
 {
-    const float *b0 = p_boxes + i0 * 4;
-    const float *b1 = p_boxes + i1 * 4;
-    float x_min, x_max, y_min, y_max;
-    float w0, w1, h0, h1;
-    if (centered == true) { // tf_format: [x_center, y_center, width, height]
-        w0    = b0[2];
-        w1    = b1[2];
-        h0    = b0[3];
-        h1    = b1[3];
-        x_min = min(b0[0] - w0 / 2, b1[0] - w1 / 2);
-        x_max = max(b0[0] + w0 / 2, b1[0] + w1 / 2);
-        y_min = min(b0[1] - h0 / 2, b1[1] - h1 / 2);
-        y_max = max(b0[1] + h0 / 2, b1[1] + h1 / 2);
-    } else { // pytorch_format: [y1, x1, y2, x2]
-        w0    = abs(b0[1] - b0[3]);
-        w1    = abs(b1[1] - b1[3]);
-        h0    = abs(b0[0] - b0[2]);
-        h1    = abs(b1[0] - b1[2]);
-        x_min = min(min(b0[1], b0[3]), min(b1[1], b1[3]));
-        x_max = max(max(b0[1], b0[3]), max(b1[1], b1[3]));
-        y_min = min(min(b0[0], b0[2]), min(b1[0], b1[2]));
-        y_max = max(max(b0[0], b0[2]), max(b1[0], b1[2]));
+    float *x1   = planes + 0 * num_boxes;
+    float *y1   = planes + 1 * num_boxes;
+    float *x2   = planes + 2 * num_boxes;
+    float *y2   = planes + 3 * num_boxes;
+    float *area = planes + 4 * num_boxes;
+    for (int64_t i = 0; i < num_boxes; i++) {
+        const float *b = p_boxes + i * 4;
+        if (centered == true) { // tf_format: [x_center, y_center, width, height]
+            x1[i]   = b[0] - b[2] / 2;
+            x2[i]   = b[0] + b[2] / 2;
+            y1[i]   = b[1] - b[3] / 2;
+            y2[i]   = b[1] + b[3] / 2;
+            area[i] = b[2] * b[3];
+        } else { // pytorch_format: [y1, x1, y2, x2]
+            x1[i]   = min(b[1], b[3]);
+            x2[i]   = max(b[1], b[3]);
+            y1[i]   = min(b[0], b[2]);
+            y2[i]   = max(b[0], b[2]);
+            area[i] = (x2[i] - x1[i]) * (y2[i] - y1[i]);
+        }
     }
+}
 
-    if (w0 + w1 <= x_max - x_min || h0 + h1 <= y_max - y_min) {
-        return 0;
-    }
+// iou of one candidate against all kept boxes at once, kept boxes are stored as planes of kept_cap
+static bool nms_is_suppressed(
+    const float *kept,
+    const int64_t kept_cap,
+    const int64_t num_kept,
+    const float *planes,
+    const int64_t num_boxes,
+    const int64_t idx,
+    const float iou_threshold)
+{
+    const float cx1   = planes[0 * num_boxes + idx];
+    const float cy1   = planes[1 * num_boxes + idx];
+    const float cx2   = planes[2 * num_boxes + idx];
+    const float cy2   = planes[3 * num_boxes + idx];
+    const float carea = planes[4 * num_boxes + idx];
+
+    const float *kx1   = kept + 0 * kept_cap;
+    const float *ky1   = kept + 1 * kept_cap;
+    const float *kx2   = kept + 2 * kept_cap;
+    const float *ky2   = kept + 3 * kept_cap;
+    const float *karea = kept + 4 * kept_cap;
+    for (int64_t j = 0; j < num_kept;) {
+        const auto vl = vsetvli(num_kept - j, RVV_E32, RVV_M2);
 
-    float area0 = w0 * h0, area1 = w1 * h1;
-    float iw = w0 + w1 - (x_max - x_min);
-    float ih = h0 + h1 - (y_max - y_min);
-    float I  = ih * iw;
-    float U  = area0 + area1 - I;
+        float32xm2_t iw = vfsubvv_float32xm2(vfminvf_float32xm2(vlev_float32xm2(kx2 + j, vl), cx2, vl), vfmaxvf_float32xm2(vlev_float32xm2(kx1 + j, vl), cx1, vl), vl);
+        float32xm2_t ih = vfsubvv_float32xm2(vfminvf_float32xm2(vlev_float32xm2(ky2 + j, vl), cy2, vl), vfmaxvf_float32xm2(vlev_float32xm2(ky1 + j, vl), cy1, vl), vl);
+        iw              = vfmaxvf_float32xm2(iw, 0.0f, vl);
+        ih              = vfmaxvf_float32xm2(ih, 0.0f, vl);
 
-    return I / U;
+        const float32xm2_t inter = vfmulvv_float32xm2(iw, ih, vl);
+        const float32xm2_t uni   = vfsubvv_float32xm2(vfaddvf_float32xm2(vlev_float32xm2(karea + j, vl), carea, vl), inter, vl);
+        const float32xm2_t iou   = vfdivvv_float32xm2(inter, uni, vl);
+        if (vmfirstm_e32xm2(vmfgtvf_e32xm2_float32xm2(iou, iou_threshold, vl), vl) >= 0) {
+            return true;
+        }
+        j += vl;
+    }
+    return false;
 }
 
-static ppl::common::RetCode nms_ndarray_naive(
+static ppl::common::RetCode nms_ndarray_kernel(
     const float *boxes,
     const float *scommons,
     const uint32_t num_boxes_in,
@@ -74,50 +107,74 @@ static ppl::common::RetCode nms_ndarray_naive(
     int64_t *dst,
     int64_t *num_boxes_out)
 {
-    std::vector<uint32_t> sorted_index_;
-    std::vector<uint32_t> selected_index_;
-    sorted_index_.resize(num_boxes_in);
-    selected_index_.resize(num_boxes_in);
-    uint32_t *sorted_index   = sorted_index_.data();
-    uint32_t *selected_index = selected_index_.data();
+    const int64_t num_boxes = num_boxes_in;
+    const int64_t num_tasks = (int64_t)batch * num_classes;
+    // selection stops right after the max-th box is kept, so at most max(maxoutput, 1) boxes per class
+    const int64_t kept_cap = max<int64_t>(1, min<int64_t>(maxoutput_boxes_per_batch_per_class, num_boxes));
+    if (num_tasks == 0 || num_boxes == 0) {
+        *num_boxes_out = 0;
+        return ppl::common::RC_SUCCESS;
+    }
 
-    uint64_t out_idx = 0;
+    std::vector<float> box_planes(batch * 5 * num_boxes);
+    PRAGMA_OMP_PARALLEL_FOR()
     for (int64_t n = 0; n < batch; n++) {
-        const float *p_boxes = boxes + n * num_boxes_in * 4;
-        for (int64_t c = 0; c < num_classes; c++) {
-            int64_t selected_num    = 0;
-            const float *p_scommons = scommons + (n * num_classes + c) * num_boxes_in;
-            argsort(p_scommons, sorted_index, num_boxes_in);
-            for (int64_t i = 0; i < num_boxes_in; i++) {
-                int64_t idx = sorted_index[i];
-                if (p_scommons[idx] <= scommon_threshold) {
-                    break;
-                }
-                bool keep = true;
-                for (int64_t j = 0; j < selected_num; j++) {
-                    float iou = calc_iou(p_boxes, idx, selected_index[j], center_point_box);
-                    if (iou > iou_threshold) {
-                        keep = false;
-                        break;
-                    }
-                }
-                if (keep) { // box i has not been suppressed
-                    selected_index[selected_num++] = idx;
-                }
-                if (selected_num >= maxoutput_boxes_per_batch_per_class) {
-                    break;
+        nms_prepare_boxes(boxes + n * num_boxes * 4, num_boxes, center_point_box, box_planes.data() + n * 5 * num_boxes);
+    }
+
+    const int64_t num_threads = PPL_OMP_MAX_THREADS();
+    std::vector<uint32_t> candidate_buffer(num_threads * num_boxes);
+    std::vector<float> kept_buffer(num_threads * 5 * kept_cap);
+    std::vector<uint32_t> selected_index(num_tasks * kept_cap);
+    std::vector<int64_t> selected_num(num_tasks);
+
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t t = 0; t < num_tasks; t++) {
+        const int64_t n         = t / num_classes;
+        const float *planes     = box_planes.data() + n * 5 * num_boxes;
+        const float *p_scommons = scommons + t * num_boxes;
+        uint32_t *candidates    = candidate_buffer.data() + PPL_OMP_THREAD_ID() * num_boxes;
+        float *kept             = kept_buffer.data() + PPL_OMP_THREAD_ID() * 5 * kept_cap;
+        uint32_t *l_selected    = selected_index.data() + t * kept_cap;
+
+        // only boxes above the score threshold are sorted, stable to keep the index order of equal scores
+        int64_t num_candidates = 0;
+        for (int64_t i = 0; i < num_boxes; i++) {
+            if (p_scommons[i] > scommon_threshold) {
+                candidates[num_candidates++] = i;
+            }
+        }
+        std::stable_sort(candidates, candidates + num_candidates, [p_scommons](const uint32_t &ind0, const uint32_t &ind1) {
+            return p_scommons[ind0] > p_scommons[ind1];
+        });
+
+        int64_t l_selected_num = 0;
+        for (int64_t i = 0; i < num_candidates; i++) {
+            const int64_t idx = candidates[i];
+            if (!nms_is_suppressed(kept, kept_cap, l_selected_num, planes, num_boxes, idx, iou_threshold)) {
+                for (int64_t p = 0; p < 5; p++) {
+                    kept[p * kept_cap + l_selected_num] = planes[p * num_boxes + idx];
                 }
+                l_selected[l_selected_num++] = idx;
             }
-            // process result
-            for (int64_t i = 0; i < selected_num; i++) {
-                int64_t *p_dst = dst + out_idx * 3;
-
-                p_dst[0] = n;
-                p_dst[1] = c;
-                p_dst[2] = selected_index[i];
-                out_idx++;
+            if (l_selected_num >= maxoutput_boxes_per_batch_per_class) {
+                break;
             }
         }
+        selected_num[t] = l_selected_num;
+    }
+
+    // process result
+    uint64_t out_idx = 0;
+    for (int64_t t = 0; t < num_tasks; t++) {
+        for (int64_t i = 0; i < selected_num[t]; i++) {
+            int64_t *p_dst = dst + out_idx * 3;
+
+            p_dst[0] = t / num_classes;
+            p_dst[1] = t % num_classes;
+            p_dst[2] = selected_index[t * kept_cap + i];
+            out_idx++;
+        }
     }
 
     *num_boxes_out = out_idx;
@@ -137,7 +194,7 @@ ppl::common::RetCode non_max_suppression_ndarray_fp32(
     int64_t *dst,
     int64_t *num_boxes_out)
 {
-    return nms_ndarray_naive(boxes, scommons, num_boxes_in, batch, num_classes, center_point_box, maxoutput_boxes_per_batch_per_class, iou_threshold, scommon_threshold, dst, num_boxes_out);
+    return nms_ndarray_kernel(boxes, scommons, num_boxes_in, batch, num_classes, center_point_box, maxoutput_boxes_per_batch_per_class, iou_threshold, scommon_threshold, dst, num_boxes_out);
 }
 
-}}}; // namespace ppl::kernel::riscv
\ No newline at end of file
+}}}; // namespace ppl::kernel::riscv
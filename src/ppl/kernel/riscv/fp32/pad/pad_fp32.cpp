@@ -0,0 +1,90 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/kernel/riscv/common/pad/pad_common.h"
+
+namespace ppl { namespace kernel { namespace riscv {
+
+ppl::common::RetCode pad_ndarray_constant_fp32(
+    const ppl::common::TensorShape* src_shape,
+    const ppl::common::TensorShape* dst_shape,
+    const float* src,
+    const int64_t* start_pads,
+    const int64_t* end_pads,
+    const float constant_value,
+    float* dst)
+{
+    return pad_ndarray_common<float, PAD_MODE_CONSTANT>(src_shape, dst_shape, src, start_pads, end_pads, constant_value, dst);
+}
+
+ppl::common::RetCode pad_ndarray_reflect_fp32(
+    const ppl::common::TensorShape* src_shape,
+    const ppl::common::TensorShape* dst_shape,
+    const float* src,
+    const int64_t* start_pads,
+    const int64_t* end_pads,
+    float* dst)
+{
+    return pad_ndarray_common<float, PAD_MODE_REFLECT>(src_shape, dst_shape, src, start_pads, end_pads, (float)0, dst);
+}
+
+ppl::common::RetCode pad_ndarray_edge_fp32(
+    const ppl::common::TensorShape* src_shape,
+    const ppl::common::TensorShape* dst_shape,
+    const float* src,
+    const int64_t* start_pads,
+    const int64_t* end_pads,
+    float* dst)
+{
+    return pad_ndarray_common<float, PAD_MODE_EDGE>(src_shape, dst_shape, src, start_pads, end_pads, (float)0, dst);
+}
+
+ppl::common::RetCode pad_n4cx_constant_fp32(
+    const ppl::common::TensorShape* src_shape,
+    const ppl::common::TensorShape* dst_shape,
+    const float* src,
+    const int64_t* start_pads,
+    const int64_t* end_pads,
+    const float constant_value,
+    float* dst)
+{
+    return pad_nbcx_common<float, PAD_MODE_CONSTANT>(src_shape, dst_shape, src, start_pads, end_pads, constant_value, 4, dst);
+}
+
+ppl::common::RetCode pad_n4cx_reflect_fp32(
+    const ppl::common::TensorShape* src_shape,
+    const ppl::common::TensorShape* dst_shape,
+    const float* src,
+    const int64_t* start_pads,
+    const int64_t* end_pads,
+    float* dst)
+{
+    return pad_nbcx_common<float, PAD_MODE_REFLECT>(src_shape, dst_shape, src, start_pads, end_pads, (float)0, 4, dst);
+}
+
+ppl::common::RetCode pad_n4cx_edge_fp32(
+    const ppl::common::TensorShape* src_shape,
+    const ppl::common::TensorShape* dst_shape,
+    const float* src,
+    const int64_t* start_pads,
+    const int64_t* end_pads,
+    float* dst)
+{
+    return pad_nbcx_common<float, PAD_MODE_EDGE>(src_shape, dst_shape, src, start_pads, end_pads, (float)0, 4, dst);
+}
+
+}}}; // namespace ppl::kernel::riscv
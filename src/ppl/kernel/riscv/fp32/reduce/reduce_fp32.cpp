@@ -16,13 +16,44 @@
 // under the License.
 
 #include <algorithm>
+#include <cstring>
+#include <type_traits>
+
+#include "ppl/kernel/riscv/common/reduce/reduce_ndarray_common.h"
 #include "ppl/kernel/riscv/fp32/reduce/reduce_n4cx_fp32.h"
-#include "ppl/kernel/riscv/fp32/reduce/reduce_ndarray_fp32.h"
-#include "ppl/kernel/riscv/fp32/reduce/reduce_single_axis_ndarray_fp32.h"
 #include "ppl/common/log.h"
 
 namespace ppl { namespace kernel { namespace riscv {
 
+// channel reduces of n4cx must skip padded channels, only the original max / min / sum / mean kernels do
+template <reduce_op_type_t op>
+static ppl::common::RetCode reduce_n4cx_channel_fp32(
+    const float* src,
+    float* dst,
+
+    const ppl::common::TensorShape* src_shape,
+    const ppl::common::TensorShape* dst_shape,
+    const int32_t* axes,
+    const int32_t num_axes,
+    std::true_type)
+{
+    return reduce_n4cx_fp32<op>(src, dst, src_shape, dst_shape, axes, num_axes, 1);
+}
+
+template <reduce_op_type_t op>
+static ppl::common::RetCode reduce_n4cx_channel_fp32(
+    const float* src,
+    float* dst,
+
+    const ppl::common::TensorShape* src_shape,
+    const ppl::common::TensorShape* dst_shape,
+    const int32_t* axes,
+    const int32_t num_axes,
+    std::false_type)
+{
+    return ppl::common::RC_UNSUPPORTED;
+}
+
 template <reduce_op_type_t op>
 ppl::common::RetCode reduce_fp32(
     const float* src,
@@ -33,7 +64,8 @@ ppl::common::RetCode reduce_fp32(
     const int32_t* axes,
     const int32_t num_axes)
 {
-    if (src_shape->CalcElementsExcludingPadding() == dst_shape->CalcElementsExcludingPadding()) {
+    // reducing only size 1 dims is a copy, except for ops that transform single elements
+    if (op <= REDUCE_PROD && src_shape->CalcElementsExcludingPadding() == dst_shape->CalcElementsExcludingPadding()) {
         memcpy(dst, src, src_shape->CalcBytesIncludingPadding());
         return ppl::common::RC_SUCCESS;
     }
@@ -41,28 +73,31 @@ ppl::common::RetCode reduce_fp32(
         return ppl::common::RC_UNSUPPORTED;
     }
 
+    const int64_t dim_count                        = src_shape->GetDimCount();
     int32_t real_axes[PPL_RISCV_TENSOR_MAX_DIMS()] = {0};
     for (int64_t i = 0; i < num_axes; i++) {
-        real_axes[i] = axes[i] >= 0 ? axes[i] : axes[i] + src_shape->GetDimCount();
+        real_axes[i] = axes[i] >= 0 ? axes[i] : axes[i] + dim_count;
     }
     std::sort(real_axes, real_axes + num_axes);
 
-    bool continous_reduce_axis = true;
-    for (int64_t i = 0; i < num_axes - 1; i++) {
-        if (real_axes[i + 1] - real_axes[i] != 1) {
-            continous_reduce_axis = false;
-            break;
-        }
-    }
-
     if (src_shape->GetDataFormat() == ppl::common::DATAFORMAT_NDARRAY) {
-        if (continous_reduce_axis) {
-            return reduce_single_axis_ndarray_fp32<op>(src, dst, src_shape, dst_shape, real_axes, num_axes);
-        } else {
-            return reduce_ndarray_fp32<op>(src, dst, src_shape, dst_shape, real_axes, num_axes);
-        }
+        return reduce_ndarray_common<float, op>(src, dst, src_shape->GetDims(), dim_count, real_axes, num_axes);
     } else if (src_shape->GetDataFormat() == ppl::common::DATAFORMAT_N4CX) {
-        return reduce_n4cx_fp32<op>(src, dst, src_shape, dst_shape, real_axes, num_axes, 1);
+        if (std::find(real_axes, real_axes + num_axes, 1) != real_axes + num_axes) {
+            return reduce_n4cx_channel_fp32<op>(
+                src, dst, src_shape, dst_shape, real_axes, num_axes, std::integral_constant<bool, op <= REDUCE_MEAN>());
+        }
+        // without the channel axis n4cx is an ndarray of [N, C / 4, ..., 4]
+        if (dim_count + 1 > PPL_RISCV_TENSOR_MAX_DIMS()) {
+            return ppl::common::RC_UNSUPPORTED;
+        }
+        int64_t blk_dims[PPL_RISCV_TENSOR_MAX_DIMS()];
+        for (int64_t i = 0; i < dim_count; i++) {
+            blk_dims[i] = src_shape->GetDim(i);
+        }
+        blk_dims[1]         = div_up(blk_dims[1], 4);
+        blk_dims[dim_count] = 4;
+        return reduce_ndarray_common<float, op>(src, dst, blk_dims, dim_count + 1, real_axes, num_axes);
     }
 
     return ppl::common::RC_UNSUPPORTED;
@@ -116,4 +151,64 @@ ppl::common::RetCode reduce_sum_fp32(
     return reduce_fp32<REDUCE_SUM>(src, dst, src_shape, dst_shape, axes, num_axes);
 }
 
+ppl::common::RetCode reduce_prod_fp32(
+    const float* src,
+    float* dst,
+
+    const ppl::common::TensorShape* src_shape,
+    const ppl::common::TensorShape* dst_shape,
+    const int32_t* axes,
+    const int32_t num_axes)
+{
+    return reduce_fp32<REDUCE_PROD>(src, dst, src_shape, dst_shape, axes, num_axes);
+}
+
+ppl::common::RetCode reduce_sum_square_fp32(
+    const float* src,
+    float* dst,
+
+    const ppl::common::TensorShape* src_shape,
+    const ppl::common::TensorShape* dst_shape,
+    const int32_t* axes,
+    const int32_t num_axes)
+{
+    return reduce_fp32<REDUCE_SUM_SQUARE>(src, dst, src_shape, dst_shape, axes, num_axes);
+}
+
+ppl::common::RetCode reduce_l1_fp32(
+    const float* src,
+    float* dst,
+
+    const ppl::common::TensorShape* src_shape,
+    const ppl::common::TensorShape* dst_shape,
+    const int32_t* axes,
+    const int32_t num_axes)
+{
+    return reduce_fp32<REDUCE_L1>(src, dst, src_shape, dst_shape, axes, num_axes);
+}
+
+ppl::common::RetCode reduce_l2_fp32(
+    const float* src,
+    float* dst,
+
+    const ppl::common::TensorShape* src_shape,
+    const ppl::common::TensorShape* dst_shape,
+    const int32_t* axes,
+    const int32_t num_axes)
+{
+    return reduce_fp32<REDUCE_L2>(src, dst, src_shape, dst_shape, axes, num_axes);
+}
+
+ppl::common::RetCode reduce_log_sum_exp_fp32(
+    const float* src,
+    float* dst,
+
+    const ppl::common::TensorShape* src_shape,
+    const ppl::common::TensorShape* dst_shape,
+    const int32_t* axes,
+    const int32_t num_axes)
+{
+    return reduce_fp32<REDUCE_LOG_SUM_EXP>(src, dst, src_shape, dst_shape, axes, num_axes);
+}
+
 }}}; //  namespace ppl::kernel::riscv
@@ -0,0 +1,153 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <riscv-vector.h>
+
+#include "ppl/kernel/riscv/common/reorder/reorder_common.h"
+
+namespace ppl { namespace kernel { namespace riscv {
+
+static void reorder_ndarray_n4cx_block_fp32(const float* src, const int64_t inner, const int64_t c_len, const int64_t i_len, float* dst)
+{
+    const int64_t c_blk  = 4;
+    const int64_t stride = inner * sizeof(float);
+    const auto vl        = vsetvli(c_blk, RVV_E32, RVV_M1);
+
+    if (c_len == c_blk) {
+        int64_t i = 0;
+        for (; i + 4 <= i_len; i += 4) {
+            vsev_float32xm1(dst + (i + 0) * c_blk, vlsev_float32xm1(src + i + 0, stride, vl), vl);
+            vsev_float32xm1(dst + (i + 1) * c_blk, vlsev_float32xm1(src + i + 1, stride, vl), vl);
+            vsev_float32xm1(dst + (i + 2) * c_blk, vlsev_float32xm1(src + i + 2, stride, vl), vl);
+            vsev_float32xm1(dst + (i + 3) * c_blk, vlsev_float32xm1(src + i + 3, stride, vl), vl);
+        }
+        for (; i < i_len; i++) {
+            vsev_float32xm1(dst + i * c_blk, vlsev_float32xm1(src + i, stride, vl), vl);
+        }
+    } else {
+        for (int64_t i = 0; i < i_len; i++) {
+            for (int64_t c = 0; c < c_blk; c++) {
+                dst[i * c_blk + c] = c < c_len ? src[c * inner + i] : 0.0f;
+            }
+        }
+    }
+}
+
+static void reorder_n4cx_ndarray_block_fp32(const float* src, const int64_t inner, const int64_t c_len, const int64_t i_len, float* dst)
+{
+    const int64_t c_blk  = 4;
+    const int64_t stride = inner * sizeof(float);
+    const auto vl        = vsetvli(c_len, RVV_E32, RVV_M1);
+
+    int64_t i = 0;
+    for (; i + 4 <= i_len; i += 4) {
+        vssev_float32xm1(dst + i + 0, stride, vlev_float32xm1(src + (i + 0) * c_blk, vl), vl);
+        vssev_float32xm1(dst + i + 1, stride, vlev_float32xm1(src + (i + 1) * c_blk, vl), vl);
+        vssev_float32xm1(dst + i + 2, stride, vlev_float32xm1(src + (i + 2) * c_blk, vl), vl);
+        vssev_float32xm1(dst + i + 3, stride, vlev_float32xm1(src + (i + 3) * c_blk, vl), vl);
+    }
+    for (; i < i_len; i++) {
+        vssev_float32xm1(dst + i, stride, vlev_float32xm1(src + i * c_blk, vl), vl);
+    }
+}
+
+static void reorder_ndarray_fp32_n8cx_fp16_block(const float* src, const int64_t inner, const int64_t c_len, const int64_t i_len, __fp16* dst)
+{
+    const int64_t c_blk  = 8;
+    const int64_t stride = inner * sizeof(float);
+    const auto vl        = vsetvli(c_blk, RVV_E16, RVV_M1);
+
+    if (c_len == c_blk) {
+        int64_t i = 0;
+        for (; i + 2 <= i_len; i += 2) {
+            vsev_float16xm1(dst + (i + 0) * c_blk, vfncvtffv_float16xm1_float32xm2(vlsev_float32xm2(src + i + 0, stride, vl), vl), vl);
+            vsev_float16xm1(dst + (i + 1) * c_blk, vfncvtffv_float16xm1_float32xm2(vlsev_float32xm2(src + i + 1, stride, vl), vl), vl);
+        }
+        for (; i < i_len; i++) {
+            vsev_float16xm1(dst + i * c_blk, vfncvtffv_float16xm1_float32xm2(vlsev_float32xm2(src + i, stride, vl), vl), vl);
+        }
+    } else {
+        for (int64_t i = 0; i < i_len; i++) {
+            for (int64_t c = 0; c < c_blk; c++) {
+                dst[i * c_blk + c] = c < c_len ? (__fp16)src[c * inner + i] : (__fp16)0.0f;
+            }
+        }
+    }
+}
+
+// two n4cx blocks make one n8cx block, the upper half is 0 when the second n4cx block does not exist
+static void reorder_n4cx_fp32_n8cx_fp16_block(const float* src, const int64_t inner, const int64_t c_len, const int64_t i_len, __fp16* dst)
+{
+    const int64_t src_c_blk = 4;
+    const int64_t dst_c_blk = 8;
+    const float* src_hi     = src + src_c_blk * inner;
+
+    if (c_len == dst_c_blk) {
+        const auto vl = vsetvli(src_c_blk, RVV_E16, RVV_M1);
+        for (int64_t i = 0; i < i_len; i++) {
+            vsev_float16xm1(dst + i * dst_c_blk + 0, vfncvtffv_float16xm1_float32xm2(vlev_float32xm2(src + i * src_c_blk, vl), vl), vl);
+            vsev_float16xm1(dst + i * dst_c_blk + src_c_blk, vfncvtffv_float16xm1_float32xm2(vlev_float32xm2(src_hi + i * src_c_blk, vl), vl), vl);
+        }
+    } else {
+        // lanes at or beyond c_len are zeroed instead of taking the n4cx padding lanes
+        const auto dst_vl       = vsetvli(dst_c_blk, RVV_E16, RVV_M1);
+        const auto lo_vl        = vsetvli(min(c_len, src_c_blk), RVV_E16, RVV_M1);
+        const auto hi_vl        = vsetvli(max<int64_t>(c_len - src_c_blk, 0), RVV_E16, RVV_M1);
+        const float16xm1_t zero = vfmvvf_float16xm1((__fp16)0.0f, dst_vl);
+        for (int64_t i = 0; i < i_len; i++) {
+            vsev_float16xm1(dst + i * dst_c_blk, zero, dst_vl);
+            vsev_float16xm1(dst + i * dst_c_blk + 0, vfncvtffv_float16xm1_float32xm2(vlev_float32xm2(src + i * src_c_blk, lo_vl), lo_vl), lo_vl);
+            if (c_len > src_c_blk) {
+                vsev_float16xm1(dst + i * dst_c_blk + src_c_blk, vfncvtffv_float16xm1_float32xm2(vlev_float32xm2(src_hi + i * src_c_blk, hi_vl), hi_vl), hi_vl);
+            }
+        }
+    }
+}
+
+ppl::common::RetCode reorder_ndarray_n4cx_fp32(
+    const ppl::common::TensorShape* src_shape,
+    const float* src,
+    float* dst)
+{
+    return reorder_common<float, float, 1, 4>(src_shape, src, reorder_ndarray_n4cx_block_fp32, dst);
+}
+
+ppl::common::RetCode reorder_n4cx_ndarray_fp32(
+    const ppl::common::TensorShape* src_shape,
+    const float* src,
+    float* dst)
+{
+    return reorder_common<float, float, 4, 1>(src_shape, src, reorder_n4cx_ndarray_block_fp32, dst);
+}
+
+ppl::common::RetCode reorder_ndarray_fp32_n8cx_fp16(
+    const ppl::common::TensorShape* src_shape,
+    const float* src,
+    __fp16* dst)
+{
+    return reorder_common<float, __fp16, 1, 8>(src_shape, src, reorder_ndarray_fp32_n8cx_fp16_block, dst);
+}
+
+ppl::common::RetCode reorder_n4cx_fp32_n8cx_fp16(
+    const ppl::common::TensorShape* src_shape,
+    const float* src,
+    __fp16* dst)
+{
+    return reorder_common<float, __fp16, 4, 8>(src_shape, src, reorder_n4cx_fp32_n8cx_fp16_block, dst);
+}
+
+}}}; // namespace ppl::kernel::riscv
@@ -0,0 +1,118 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <math.h>
+#include <riscv-vector.h>
+
+#include "ppl/kernel/riscv/common/internal_include.h"
+
+namespace ppl { namespace kernel { namespace riscv {
+
+#define C_BLK() ((int64_t)4)
+
+// 1 / sqrt(mean(x²) + eps) of one row
+static inline float rmsnorm_row_rrms_fp32(const float* src, const int64_t len, const float eps)
+{
+    const auto vl = vsetvli(C_BLK(), RVV_E32, RVV_M1);
+
+    float32xm1_t vsqr0 = vfmvvf_float32xm1(0.0f, vl);
+    float32xm1_t vsqr1 = vfmvvf_float32xm1(0.0f, vl);
+    int64_t i          = 0;
+    for (; i + 2 * C_BLK() <= len; i += 2 * C_BLK()) {
+        const float32xm1_t x0 = vlev_float32xm1(src + i + 0 * C_BLK(), vl);
+        const float32xm1_t x1 = vlev_float32xm1(src + i + 1 * C_BLK(), vl);
+        vsqr0                 = vfmaccvv_float32xm1(vsqr0, x0, x0, vl);
+        vsqr1                 = vfmaccvv_float32xm1(vsqr1, x1, x1, vl);
+    }
+    for (; i + C_BLK() <= len; i += C_BLK()) {
+        const float32xm1_t x0 = vlev_float32xm1(src + i, vl);
+        vsqr0                 = vfmaccvv_float32xm1(vsqr0, x0, x0, vl);
+    }
+
+    float sqr_data[C_BLK()];
+    vsev_float32xm1(sqr_data, vfaddvv_float32xm1(vsqr0, vsqr1, vl), vl);
+    float sqr = 0.0f;
+    for (int64_t k = 0; k < C_BLK(); k++) {
+        sqr += sqr_data[k];
+    }
+    for (; i < len; i++) {
+        sqr += src[i] * src[i];
+    }
+
+    return 1.0f / sqrtf(sqr / len + eps);
+}
+
+template <bool has_scale>
+static void rmsnorm_ndarray_kernel_fp32(
+    const float* src,
+    const float* scale,
+    const int64_t outer_dim,
+    const int64_t inner_dim,
+    const float eps,
+    float* dst)
+{
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t o = 0; o < outer_dim; o++) {
+        const float* src_ = src + o * inner_dim;
+        float* dst_       = dst + o * inner_dim;
+
+        const float rrms = rmsnorm_row_rrms_fp32(src_, inner_dim, eps);
+
+        for (int64_t i = 0; i < inner_dim; i += C_BLK()) {
+            const auto vl  = vsetvli(inner_dim - i, RVV_E32, RVV_M1);
+            float32xm1_t y = vfmulvf_float32xm1(vlev_float32xm1(src_ + i, vl), rrms, vl);
+            if (has_scale) y = vfmulvv_float32xm1(y, vlev_float32xm1(scale + i, vl), vl);
+            vsev_float32xm1(dst_ + i, y, vl);
+        }
+    }
+}
+
+ppl::common::RetCode rmsnorm_ndarray_fp32(
+    const ppl::common::TensorShape* src_shape,
+    const float* src,
+    const float* scale,
+    const int64_t axis,
+    const float eps,
+    float* dst)
+{
+    const int64_t dim_count = src_shape->GetDimCount();
+    const int64_t real_axis = axis < 0 ? axis + dim_count : axis;
+    if (real_axis < 0 || real_axis >= dim_count) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+
+    int64_t outer_dim = 1;
+    int64_t inner_dim = 1;
+    for (int64_t i = 0; i < real_axis; i++) {
+        outer_dim *= src_shape->GetDim(i);
+    }
+    for (int64_t i = real_axis; i < dim_count; i++) {
+        inner_dim *= src_shape->GetDim(i);
+    }
+    if (inner_dim == 0) {
+        return ppl::common::RC_SUCCESS;
+    }
+
+    if (scale) {
+        rmsnorm_ndarray_kernel_fp32<true>(src, scale, outer_dim, inner_dim, eps, dst);
+    } else {
+        rmsnorm_ndarray_kernel_fp32<false>(src, scale, outer_dim, inner_dim, eps, dst);
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+}}}; // namespace ppl::kernel::riscv
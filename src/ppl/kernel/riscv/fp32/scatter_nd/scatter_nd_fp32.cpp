@@ -15,10 +15,39 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <riscv-vector.h>
+
 #include "ppl/kernel/riscv/common/scatter_nd/scatter_nd_common.h"
 
 namespace ppl { namespace kernel { namespace riscv {
 
+static void scatter_nd_apply_fp32(const float *updates, const int64_t len, const int32_t reduction, float *dst)
+{
+    for (int64_t i = 0; i < len;) {
+        const auto vl        = vsetvli(len - i, RVV_E32, RVV_M4);
+        const float32xm4_t u = vlev_float32xm4(updates + i, vl);
+        float32xm4_t r       = u;
+        switch (reduction) {
+            case SCATTER_REDUCTION_ADD:
+                r = vfaddvv_float32xm4(vlev_float32xm4(dst + i, vl), u, vl);
+                break;
+            case SCATTER_REDUCTION_MUL:
+                r = vfmulvv_float32xm4(vlev_float32xm4(dst + i, vl), u, vl);
+                break;
+            case SCATTER_REDUCTION_MAX:
+                r = vfmaxvv_float32xm4(vlev_float32xm4(dst + i, vl), u, vl);
+                break;
+            case SCATTER_REDUCTION_MIN:
+                r = vfminvv_float32xm4(vlev_float32xm4(dst + i, vl), u, vl);
+                break;
+            default:
+                break;
+        }
+        vsev_float32xm4(dst + i, r, vl);
+        i += vl;
+    }
+}
+
 ppl::common::RetCode scatter_nd_ndarray_fp32(
     const float *src,
     const float *updates,
@@ -28,6 +57,7 @@ ppl::common::RetCode scatter_nd_ndarray_fp32(
     const int64_t inner_dim,
     const int64_t num_indices,
     const int64_t indices_dim,
+    const int32_t reduction,
     float *dst)
 {
     return scatter_nd_ndarray_common<float>(
@@ -39,6 +69,32 @@ ppl::common::RetCode scatter_nd_ndarray_fp32(
         inner_dim,
         num_indices,
         indices_dim,
+        reduction,
+        scatter_nd_apply_fp32,
+        dst);
+}
+
+ppl::common::RetCode scatter_nd_ndarray_fp32(
+    const float *src,
+    const float *updates,
+    const int64_t *indices,
+    const int32_t *strides,
+    const int64_t src_length,
+    const int64_t inner_dim,
+    const int64_t num_indices,
+    const int64_t indices_dim,
+    float *dst)
+{
+    return scatter_nd_ndarray_fp32(
+        src,
+        updates,
+        indices,
+        strides,
+        src_length,
+        inner_dim,
+        num_indices,
+        indices_dim,
+        SCATTER_REDUCTION_NONE,
         dst);
 }
 
@@ -15,21 +15,232 @@
 // specific language governing permissions and limitations
 // under the License.
 
-#include <cmath>
+#include <cfloat>
+#include <cstring>
 #include <riscv-vector.h>
 
 #include "ppl/kernel/riscv/common/internal_include.h"
+#include "ppl/kernel/riscv/common/vector_math/vector_math_kernel.h"
 
 namespace ppl { namespace kernel { namespace riscv {
 
 #define C_BLK() ((int64_t)4)
 
+// online softmax: every lane keeps a running max and Σ(exp(src - max)). the sum is rescaled by
+// exp(old_max - new_max) once per 4 vectors, so the first pass costs ~1.25 exp per element and
+// the second pass recomputes exp(src - max) on its way to dst.
+static inline void softmax_online_update4_fp32(
+    const float32xm1_t x0,
+    const float32xm1_t x1,
+    const float32xm1_t x2,
+    const float32xm1_t x3,
+    float32xm1_t* vmax,
+    float32xm1_t* vsum,
+    const uint64_t vl)
+{
+    const float32xm1_t new_max = vfmaxvv_float32xm1(
+        vfmaxvv_float32xm1(*vmax, vfmaxvv_float32xm1(x0, x1, vl), vl), vfmaxvv_float32xm1(x2, x3, vl), vl);
+    float32xm1_t sum = vfmulvv_float32xm1(*vsum, vfexp_float32xm1(vfsubvv_float32xm1(*vmax, new_max, vl), vl), vl);
+    sum              = vfaddvv_float32xm1(sum, vfexp_float32xm1(vfsubvv_float32xm1(x0, new_max, vl), vl), vl);
+    sum              = vfaddvv_float32xm1(sum, vfexp_float32xm1(vfsubvv_float32xm1(x1, new_max, vl), vl), vl);
+    sum              = vfaddvv_float32xm1(sum, vfexp_float32xm1(vfsubvv_float32xm1(x2, new_max, vl), vl), vl);
+    sum              = vfaddvv_float32xm1(sum, vfexp_float32xm1(vfsubvv_float32xm1(x3, new_max, vl), vl), vl);
+    *vmax            = new_max;
+    *vsum            = sum;
+}
+
+static inline void softmax_online_update1_fp32(
+    const float32xm1_t x,
+    float32xm1_t* vmax,
+    float32xm1_t* vsum,
+    const uint64_t vl)
+{
+    const float32xm1_t new_max = vfmaxvv_float32xm1(*vmax, x, vl);
+    const float32xm1_t sum     = vfmulvv_float32xm1(*vsum, vfexp_float32xm1(vfsubvv_float32xm1(*vmax, new_max, vl), vl), vl);
+    *vsum                      = vfaddvv_float32xm1(sum, vfexp_float32xm1(vfsubvv_float32xm1(x, new_max, vl), vl), vl);
+    *vmax                      = new_max;
+}
+
+// fold the per lane (max, sum) pairs into one max and 1 / sum
+static inline void softmax_online_merge_lanes_fp32(
+    const float32xm1_t vmax,
+    const float32xm1_t vsum,
+    const uint64_t vl,
+    float* fmax,
+    float* recp_sum)
+{
+    float max_data[C_BLK()];
+    float sum_data[C_BLK()];
+    vsev_float32xm1(max_data, vmax, vl);
+    float max_val = max_data[0];
+    for (int64_t k = 1; k < C_BLK(); k++) {
+        max_val = max_data[k] > max_val ? max_data[k] : max_val;
+    }
+    vsev_float32xm1(sum_data, vfmulvv_float32xm1(vsum, vfexp_float32xm1(vfsubvf_float32xm1(vmax, max_val, vl), vl), vl), vl);
+    float sum = 0.0f;
+    for (int64_t k = 0; k < C_BLK(); k++) {
+        sum += sum_data[k];
+    }
+    *fmax     = max_val;
+    *recp_sum = 1.0f / sum;
+}
+
+// softmax over a contiguous row of len elements
+static void softmax_contiguous_fp32(const float* src, float* dst, const int64_t len)
+{
+    const auto vl = vsetvli(C_BLK(), RVV_E32, RVV_M1);
+
+    float32xm1_t vmax = vfmvvf_float32xm1(-FLT_MAX, vl);
+    float32xm1_t vsum = vfmvvf_float32xm1(0.0f, vl);
+    int64_t i         = 0;
+    for (; i + 4 * C_BLK() <= len; i += 4 * C_BLK()) {
+        softmax_online_update4_fp32(
+            vlev_float32xm1(src + i + 0 * C_BLK(), vl),
+            vlev_float32xm1(src + i + 1 * C_BLK(), vl),
+            vlev_float32xm1(src + i + 2 * C_BLK(), vl),
+            vlev_float32xm1(src + i + 3 * C_BLK(), vl),
+            &vmax,
+            &vsum,
+            vl);
+    }
+    for (; i + C_BLK() <= len; i += C_BLK()) {
+        softmax_online_update1_fp32(vlev_float32xm1(src + i, vl), &vmax, &vsum, vl);
+    }
+    if (i < len) {
+        // padded lanes only add ~exp(-FLT_MAX) to the merged sum
+        float tail[C_BLK()] = {-FLT_MAX, -FLT_MAX, -FLT_MAX, -FLT_MAX};
+        memcpy(tail, src + i, (len - i) * sizeof(float));
+        softmax_online_update1_fp32(vlev_float32xm1(tail, vl), &vmax, &vsum, vl);
+    }
+
+    float fmax, recp_sum;
+    softmax_online_merge_lanes_fp32(vmax, vsum, vl, &fmax, &recp_sum);
+
+    for (i = 0; i < len; i += C_BLK()) {
+        const auto tail_vl   = vsetvli(len - i, RVV_E32, RVV_M1);
+        const float32xm1_t e = vfexp_float32xm1(vfsubvf_float32xm1(vlev_float32xm1(src + i, tail_vl), fmax, tail_vl), tail_vl);
+        vsev_float32xm1(dst + i, vfmulvf_float32xm1(e, recp_sum, tail_vl), tail_vl);
+    }
+}
+
+// softmax over axis_dim rows of stride inner_dim, vl independent lanes along the contiguous inner dim
+static void softmax_strided_fp32(
+    const float* src,
+    float* dst,
+    const int64_t axis_dim,
+    const int64_t inner_dim,
+    const uint64_t vl)
+{
+    float32xm1_t vmax = vfmvvf_float32xm1(-FLT_MAX, vl);
+    float32xm1_t vsum = vfmvvf_float32xm1(0.0f, vl);
+    int64_t a         = 0;
+    for (; a + 4 <= axis_dim; a += 4) {
+        softmax_online_update4_fp32(
+            vlev_float32xm1(src + (a + 0) * inner_dim, vl),
+            vlev_float32xm1(src + (a + 1) * inner_dim, vl),
+            vlev_float32xm1(src + (a + 2) * inner_dim, vl),
+            vlev_float32xm1(src + (a + 3) * inner_dim, vl),
+            &vmax,
+            &vsum,
+            vl);
+    }
+    for (; a < axis_dim; a++) {
+        softmax_online_update1_fp32(vlev_float32xm1(src + a * inner_dim, vl), &vmax, &vsum, vl);
+    }
+
+    const float32xm1_t vrecp_sum = vfrdivvf_float32xm1(vsum, 1.0f, vl);
+    for (a = 0; a < axis_dim; a++) {
+        const float32xm1_t e = vfexp_float32xm1(vfsubvv_float32xm1(vlev_float32xm1(src + a * inner_dim, vl), vmax, vl), vl);
+        vsev_float32xm1(dst + a * inner_dim, vfmulvv_float32xm1(e, vrecp_sum, vl), vl);
+    }
+}
+
+// softmax over [outer_dim, axis_dim, inner_dim]
+static void softmax_outer_axis_inner_fp32(
+    const float* src,
+    float* dst,
+    const int64_t outer_dim,
+    const int64_t axis_dim,
+    const int64_t inner_dim)
+{
+    if (inner_dim == 1) {
+        PRAGMA_OMP_PARALLEL_FOR()
+        for (int64_t i = 0; i < outer_dim; i++) {
+            softmax_contiguous_fp32(src + i * axis_dim, dst + i * axis_dim, axis_dim);
+        }
+        return;
+    }
+
+    const int64_t num_inner_blk = div_up(inner_dim, C_BLK());
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t t = 0; t < outer_dim * num_inner_blk; t++) {
+        const int64_t i      = t / num_inner_blk;
+        const int64_t j      = (t % num_inner_blk) * C_BLK();
+        const auto vl        = vsetvli(inner_dim - j, RVV_E32, RVV_M1);
+        const int64_t offset = i * axis_dim * inner_dim + j;
+        softmax_strided_fp32(src + offset, dst + offset, axis_dim, inner_dim, vl);
+    }
+}
+
+// softmax over the channels of one pixel of n4cx, blocks are hw * C_BLK() apart
+static void softmax_n4cx_channel_fp32(
+    const float* src,
+    float* dst,
+    const int64_t channels,
+    const int64_t blk_stride)
+{
+    const auto vl         = vsetvli(C_BLK(), RVV_E32, RVV_M1);
+    const int64_t full_bc = channels / C_BLK();
+    const int64_t tail_c  = channels - full_bc * C_BLK();
+
+    float32xm1_t vmax = vfmvvf_float32xm1(-FLT_MAX, vl);
+    float32xm1_t vsum = vfmvvf_float32xm1(0.0f, vl);
+    int64_t bc        = 0;
+    for (; bc + 4 <= full_bc; bc += 4) {
+        softmax_online_update4_fp32(
+            vlev_float32xm1(src + (bc + 0) * blk_stride, vl),
+            vlev_float32xm1(src + (bc + 1) * blk_stride, vl),
+            vlev_float32xm1(src + (bc + 2) * blk_stride, vl),
+            vlev_float32xm1(src + (bc + 3) * blk_stride, vl),
+            &vmax,
+            &vsum,
+            vl);
+    }
+    for (; bc < full_bc; bc++) {
+        softmax_online_update1_fp32(vlev_float32xm1(src + bc * blk_stride, vl), &vmax, &vsum, vl);
+    }
+    if (tail_c > 0) {
+        float tail[C_BLK()] = {-FLT_MAX, -FLT_MAX, -FLT_MAX, -FLT_MAX};
+        memcpy(tail, src + full_bc * blk_stride, tail_c * sizeof(float));
+        softmax_online_update1_fp32(vlev_float32xm1(tail, vl), &vmax, &vsum, vl);
+    }
+
+    float fmax, recp_sum;
+    softmax_online_merge_lanes_fp32(vmax, vsum, vl, &fmax, &recp_sum);
+
+    for (bc = 0; bc < full_bc; bc++) {
+        const float32xm1_t e = vfexp_float32xm1(vfsubvf_float32xm1(vlev_float32xm1(src + bc * blk_stride, vl), fmax, vl), vl);
+        vsev_float32xm1(dst + bc * blk_stride, vfmulvf_float32xm1(e, recp_sum, vl), vl);
+    }
+    if (tail_c > 0) {
+        // padded channels are written as 0
+        float tail[C_BLK()];
+        const float32xm1_t e = vfexp_float32xm1(vfsubvf_float32xm1(vlev_float32xm1(src + full_bc * blk_stride, vl), fmax, vl), vl);
+        vsev_float32xm1(tail, vfmulvf_float32xm1(e, recp_sum, vl), vl);
+        for (int64_t k = tail_c; k < C_BLK(); k++) {
+            tail[k] = 0.0f;
+        }
+        memcpy(dst + full_bc * blk_stride, tail, C_BLK() * sizeof(float));
+    }
+}
+
 ppl::common::RetCode softmax_ndarray_fp32(
     const ppl::common::TensorShape* shape,
     const int64_t axis,
     const float* src,
     float* dst)
 {
+    // opset < 13: dims from axis on are flattened into one row
     int64_t outer_dim = 1;
     int64_t inner_dim = 1;
     for (int64_t i = 0; i < axis; i++) {
@@ -39,46 +250,81 @@ ppl::common::RetCode softmax_ndarray_fp32(
         inner_dim *= shape->GetDim(i);
     }
 
-    const auto vl = vsetvli(C_BLK(), RVV_E32, RVV_M1);
+    softmax_outer_axis_inner_fp32(src, dst, outer_dim, inner_dim, 1);
+    return ppl::common::RC_SUCCESS;
+}
 
-    for (int64_t i = 0; i < outer_dim; i++) {
-        const float* src_  = src + i * inner_dim;
-        float* dst_        = dst + i * inner_dim;
-        // find max
-        float32xm1_t vfmax = vfmvvf_float32xm1(-__FLT_MAX__, vl);
-        float fmax         = (float)(-__FLT_MAX__);
-        int64_t j          = 0;
-        for (; j + C_BLK() < inner_dim; j += C_BLK()) {
-            vfmax = vfmaxvv_float32xm1(vfmax, vlev_float32xm1(src_ + j, vl), vl);
-        }
-        for (; j < inner_dim; j++) {
-            fmax = std::max(fmax, src_[j]);
-        }
-        float max_data[C_BLK()];
-        vsev_float32xm1(max_data, vfmax, vl);
-        for (int64_t k = 0; k < C_BLK(); k++) {
-            fmax = std::max(fmax, max_data[k]);
-        }
-        vfmax = vfmvvf_float32xm1(fmax, vl);
-        // src - max
-        for (j = 0; j + C_BLK() < inner_dim; j += C_BLK()) {
-            const float* src_p = src_ + j;
-            float* dst_p       = dst_ + j;
-            vsev_float32xm1(dst_p, vfsubvv_float32xm1(vlev_float32xm1(src_p, vl), vfmax, vl), vl);
-        }
-        for (; j < inner_dim; j++) {
-            dst_[j] = src_[j] - fmax;
+ppl::common::RetCode softmax13_ndarray_fp32(
+    const ppl::common::TensorShape* shape,
+    const int64_t axis,
+    const float* src,
+    float* dst)
+{
+    const int64_t dim_count = shape->GetDimCount();
+    const int64_t real_axis = axis < 0 ? axis + dim_count : axis;
+    if (real_axis < 0 || real_axis >= dim_count) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+
+    int64_t outer_dim = 1;
+    int64_t inner_dim = 1;
+    for (int64_t i = 0; i < real_axis; i++) {
+        outer_dim *= shape->GetDim(i);
+    }
+    for (int64_t i = real_axis + 1; i < dim_count; i++) {
+        inner_dim *= shape->GetDim(i);
+    }
+
+    softmax_outer_axis_inner_fp32(src, dst, outer_dim, shape->GetDim(real_axis), inner_dim);
+    return ppl::common::RC_SUCCESS;
+}
+
+ppl::common::RetCode softmax13_n4cx_fp32(
+    const ppl::common::TensorShape* shape,
+    const int64_t axis,
+    const float* src,
+    float* dst)
+{
+    const int64_t dim_count = shape->GetDimCount();
+    const int64_t real_axis = axis < 0 ? axis + dim_count : axis;
+    if (dim_count < 2 || real_axis < 0 || real_axis >= dim_count) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+
+    const int64_t batch    = shape->GetDim(0);
+    const int64_t channels = shape->GetDim(1);
+    const int64_t pad_c    = round_up(channels, C_BLK());
+    int64_t hw             = 1;
+    for (int64_t i = 2; i < dim_count; i++) {
+        hw *= shape->GetDim(i);
+    }
+
+    if (real_axis == 1) {
+        PRAGMA_OMP_PARALLEL_FOR()
+        for (int64_t t = 0; t < batch * hw; t++) {
+            const int64_t n      = t / hw;
+            const int64_t offset = n * pad_c * hw + (t % hw) * C_BLK();
+            softmax_n4cx_channel_fp32(src + offset, dst + offset, channels, hw * C_BLK());
         }
-        // Σ(exp(src - max))
-        float sum = 0.0f;
-        for (j = 0; j < inner_dim; j++) {
-            sum += exp((float)dst_[j]);
+        return ppl::common::RC_SUCCESS;
+    }
+
+    // any other axis keeps channels in lanes: view n4cx as [n, c / 4, d2, ..., 4]
+    int64_t outer_dim = 1;
+    int64_t inner_dim = C_BLK();
+    if (real_axis > 0) {
+        outer_dim = batch * pad_c / C_BLK();
+        for (int64_t i = 2; i < real_axis; i++) {
+            outer_dim *= shape->GetDim(i);
         }
-        // final result
-        for (j = 0; j < inner_dim; j++) {
-            dst_[j] = (float)(exp((float)dst_[j]) * (1.0f / sum));
+        for (int64_t i = real_axis + 1; i < dim_count; i++) {
+            inner_dim *= shape->GetDim(i);
         }
+    } else {
+        inner_dim = pad_c * hw;
     }
+
+    softmax_outer_axis_inner_fp32(src, dst, outer_dim, shape->GetDim(real_axis), inner_dim);
     return ppl::common::RC_SUCCESS;
 }
 
@@ -15,11 +15,29 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <riscv-vector.h>
+
 #include "ppl/kernel/riscv/common/internal_include.h"
 #include "ppl/kernel/riscv/common/topk/topk_common.h"
 
 namespace ppl { namespace kernel { namespace riscv {
 
+static int64_t topk_find_fp32(const float *src, const int64_t len, const float thr, const bool largest)
+{
+    int64_t i = 0;
+    while (i < len) {
+        const auto vl           = vsetvli(len - i, RVV_E32, RVV_M4);
+        const float32xm4_t data = vlev_float32xm4(src + i, vl);
+        const e32xm4_t mask     = largest ? vmfgtvf_e32xm4_float32xm4(data, thr, vl) : vmfltvf_e32xm4_float32xm4(data, thr, vl);
+        const int64_t first     = vmfirstm_e32xm4(mask, vl);
+        if (first >= 0) {
+            return i + first;
+        }
+        i += vl;
+    }
+    return len;
+}
+
 uint64_t topk_ndarray_get_buffer_bytes_fp32(
     const ppl::common::TensorShape *src_shape,
     const int32_t axis)
@@ -49,6 +67,7 @@ ppl::common::RetCode topk_ndarray_fp32(
         axis,
         largest,
         sorted,
+        topk_find_fp32,
         temp_buffer,
         values,
         indices);
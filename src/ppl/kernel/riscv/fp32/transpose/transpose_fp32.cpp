@@ -15,10 +15,42 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <riscv-vector.h>
+
 #include "ppl/kernel/riscv/common/transpose/transpose_common.h"
 
 namespace ppl { namespace kernel { namespace riscv {
 
+// each dst column segment is gathered with one strided load, 4 src columns are in flight at a time
+static void transpose_tile_fp32(
+    const float* src,
+    const int64_t src_ld,
+    const int64_t rows,
+    const int64_t cols,
+    const int64_t dst_ld,
+    float* dst)
+{
+    const int64_t atom       = 4;
+    const int64_t src_stride = src_ld * sizeof(float);
+
+    for (int64_t r = 0; r < rows; r += atom) {
+        const auto vl     = vsetvli(rows - r, RVV_E32, RVV_M1);
+        const float* src_p = src + r * src_ld;
+        float* dst_p       = dst + r;
+
+        int64_t c = 0;
+        for (; c + atom <= cols; c += atom) {
+            vsev_float32xm1(dst_p + (c + 0) * dst_ld, vlsev_float32xm1(src_p + c + 0, src_stride, vl), vl);
+            vsev_float32xm1(dst_p + (c + 1) * dst_ld, vlsev_float32xm1(src_p + c + 1, src_stride, vl), vl);
+            vsev_float32xm1(dst_p + (c + 2) * dst_ld, vlsev_float32xm1(src_p + c + 2, src_stride, vl), vl);
+            vsev_float32xm1(dst_p + (c + 3) * dst_ld, vlsev_float32xm1(src_p + c + 3, src_stride, vl), vl);
+        }
+        for (; c < cols; c++) {
+            vsev_float32xm1(dst_p + c * dst_ld, vlsev_float32xm1(src_p + c, src_stride, vl), vl);
+        }
+    }
+}
+
 ppl::common::RetCode transpose_ndarray_fp32(
     const float* src,
     float* dst,
@@ -27,7 +59,7 @@ ppl::common::RetCode transpose_ndarray_fp32(
     const ppl::common::TensorShape* src_shape,
     const ppl::common::TensorShape* dst_shape)
 {
-    return transpose_ndarray<float>(src, dst, perm, src_shape, dst_shape);
+    return transpose_ndarray<float>(src, dst, perm, src_shape, dst_shape, transpose_tile_fp32);
 }
 
 ppl::common::RetCode transpose_ndarray_continous2d_fp32(
@@ -0,0 +1,91 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <riscv-vector.h>
+
+#include "ppl/kernel/riscv/common/argmax/argmax_common.h"
+
+namespace ppl { namespace kernel { namespace riscv {
+
+// chunks without a better element are skipped with one vector compare, the rare improving chunk is rescanned
+template <bool is_min>
+static int64_t argmax_line_int64(const int64_t* src, const int64_t len)
+{
+    int64_t best = src[0];
+    int64_t idx  = 0;
+    for (int64_t i = 1; i < len;) {
+        const auto vl         = vsetvli(len - i, RVV_E64, RVV_M4);
+        const int64xm4_t v    = vlev_int64xm4(src + i, vl);
+        const e64xm4_t better = is_min ? vmsltvx_e64xm4_int64xm4(v, best, vl) : vmsgtvx_e64xm4_int64xm4(v, best, vl);
+        const int64_t first   = vmfirstm_e64xm4(better, vl);
+        if (first >= 0) {
+            for (int64_t k = i + first; k < i + (int64_t)vl; k++) {
+                if (is_min ? src[k] < best : src[k] > best) {
+                    best = src[k];
+                    idx  = k;
+                }
+            }
+        }
+        i += vl;
+    }
+    return idx;
+}
+
+// index lanes are as wide as the values, so dst itself holds the running indices
+template <bool is_min>
+static void argmax_columns_int64(const int64_t* src, const int64_t argmax_dim, const int64_t inner_dim, const int64_t width, int64_t* dst)
+{
+    int64_t best[ARGMAX_INNER_BLK()];
+    for (int64_t j = 0; j < width;) {
+        const auto vl = vsetvli(width - j, RVV_E64, RVV_M1);
+        vsev_int64xm1(best + j, vlev_int64xm1(src + j, vl), vl);
+        vsev_int64xm1(dst + j, vmvvx_int64xm1(0, vl), vl);
+        j += vl;
+    }
+    for (int64_t k = 1; k < argmax_dim; k++) {
+        const int64_t* src_k = src + k * inner_dim;
+        for (int64_t j = 0; j < width;) {
+            const auto vl         = vsetvli(width - j, RVV_E64, RVV_M1);
+            const int64xm1_t v    = vlev_int64xm1(src_k + j, vl);
+            const int64xm1_t b    = vlev_int64xm1(best + j, vl);
+            const e64xm1_t better = is_min ? vmsltvv_e64xm1_int64xm1(v, b, vl) : vmsgtvv_e64xm1_int64xm1(v, b, vl);
+            vsev_int64xm1(best + j, is_min ? vminvv_int64xm1(b, v, vl) : vmaxvv_int64xm1(b, v, vl), vl);
+            vsev_mask_int64xm1(dst + j, vmvvx_int64xm1(k, vl), better, vl);
+            j += vl;
+        }
+    }
+}
+
+ppl::common::RetCode argmax_ndarray_int64(
+    const ppl::common::TensorShape* src_shape,
+    const int64_t* src,
+    const int64_t axis,
+    int64_t* dst)
+{
+    return argmax_ndarray_common<int64_t>(src_shape, src, axis, argmax_line_int64<false>, argmax_columns_int64<false>, dst);
+}
+
+ppl::common::RetCode argmin_ndarray_int64(
+    const ppl::common::TensorShape* src_shape,
+    const int64_t* src,
+    const int64_t axis,
+    int64_t* dst)
+{
+    return argmax_ndarray_common<int64_t>(src_shape, src, axis, argmax_line_int64<true>, argmax_columns_int64<true>, dst);
+}
+
+}}}; // namespace ppl::kernel::riscv
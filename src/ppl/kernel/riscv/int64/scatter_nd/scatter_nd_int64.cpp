@@ -0,0 +1,101 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <riscv-vector.h>
+
+#include "ppl/kernel/riscv/common/scatter_nd/scatter_nd_common.h"
+
+namespace ppl { namespace kernel { namespace riscv {
+
+static void scatter_nd_apply_int64(const int64_t *updates, const int64_t len, const int32_t reduction, int64_t *dst)
+{
+    for (int64_t i = 0; i < len;) {
+        const auto vl      = vsetvli(len - i, RVV_E64, RVV_M2);
+        const int64xm2_t u = vlev_int64xm2(updates + i, vl);
+        int64xm2_t r       = u;
+        switch (reduction) {
+            case SCATTER_REDUCTION_ADD:
+                r = vaddvv_int64xm2(vlev_int64xm2(dst + i, vl), u, vl);
+                break;
+            case SCATTER_REDUCTION_MUL:
+                r = vmulvv_int64xm2(vlev_int64xm2(dst + i, vl), u, vl);
+                break;
+            case SCATTER_REDUCTION_MAX:
+                r = vmaxvv_int64xm2(vlev_int64xm2(dst + i, vl), u, vl);
+                break;
+            case SCATTER_REDUCTION_MIN:
+                r = vminvv_int64xm2(vlev_int64xm2(dst + i, vl), u, vl);
+                break;
+            default:
+                break;
+        }
+        vsev_int64xm2(dst + i, r, vl);
+        i += vl;
+    }
+}
+
+ppl::common::RetCode scatter_nd_ndarray_int64(
+    const int64_t *src,
+    const int64_t *updates,
+    const int64_t *indices,
+    const int32_t *strides,
+    const int64_t src_length,
+    const int64_t inner_dim,
+    const int64_t num_indices,
+    const int64_t indices_dim,
+    const int32_t reduction,
+    int64_t *dst)
+{
+    return scatter_nd_ndarray_common<int64_t>(
+        src,
+        updates,
+        indices,
+        strides,
+        src_length,
+        inner_dim,
+        num_indices,
+        indices_dim,
+        reduction,
+        scatter_nd_apply_int64,
+        dst);
+}
+
+ppl::common::RetCode scatter_nd_ndarray_int64(
+    const int64_t *src,
+    const int64_t *updates,
+    const int64_t *indices,
+    const int32_t *strides,
+    const int64_t src_length,
+    const int64_t inner_dim,
+    const int64_t num_indices,
+    const int64_t indices_dim,
+    int64_t *dst)
+{
+    return scatter_nd_ndarray_int64(
+        src,
+        updates,
+        indices,
+        strides,
+        src_length,
+        inner_dim,
+        num_indices,
+        indices_dim,
+        SCATTER_REDUCTION_NONE,
+        dst);
+}
+
+}}}; // namespace ppl::kernel::riscv
@@ -0,0 +1,119 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include <vector>
+
+#include "ppl/kernel/riscv/fp32/argmax.h"
+#include "ppl/kernel/riscv/fp16/argmax.h"
+#include "ppl/kernel/riscv/int64/argmax.h"
+#include "test_utils.h"
+
+using namespace ppl::kernel::riscv;
+
+template <typename T>
+using argmax_test_func_t = ppl::common::RetCode (*)(const ppl::common::TensorShape*, const T*, const int64_t, int64_t*);
+
+// first index of the extreme element, 0 for an empty axis
+template <typename T>
+static std::vector<int64_t> argmax_ref(const std::vector<T>& src, const int64_t outer, const int64_t axis_dim, const int64_t inner, const bool is_min)
+{
+    std::vector<int64_t> dst(outer * inner, 0);
+    for (int64_t o = 0; o < outer; o++) {
+        for (int64_t i = 0; i < inner; i++) {
+            int64_t best = 0;
+            for (int64_t a = 1; a < axis_dim; a++) {
+                const T val      = src[(o * axis_dim + a) * inner + i];
+                const T best_val = src[(o * axis_dim + best) * inner + i];
+                if (is_min ? val < best_val : val > best_val) {
+                    best = a;
+                }
+            }
+            dst[o * inner + i] = best;
+        }
+    }
+    return dst;
+}
+
+template <typename T>
+static void test_argmax(
+    riscv_test_checker& checker,
+    const char* tag,
+    argmax_test_func_t<T> func,
+    const bool is_min,
+    const std::vector<int64_t>& dims,
+    const int32_t axis)
+{
+    const int64_t num_dims = dims.size();
+    const int64_t outer    = dims_product(dims, 0, axis);
+    const int64_t axis_dim = dims[axis];
+    const int64_t inner    = dims_product(dims, axis + 1, num_dims);
+    ppl::common::TensorShape src_shape;
+    src_shape.Reshape(dims);
+    src_shape.SetDataFormat(ppl::common::DATAFORMAT_NDARRAY);
+
+    // few distinct values so that the first of equal extremes matters
+    std::vector<T> src(outer * axis_dim * inner + 1);
+    for (auto& x : src) {
+        x = (T)(rand() % 41 - 20);
+    }
+    const std::vector<int64_t> ref = argmax_ref(src, outer, axis_dim, inner, is_min);
+    std::vector<int64_t> dst(ref.size() + 1, 777);
+
+    // the axis may also be given from the back
+    const int64_t axis_arg = rand() % 2 ? axis : axis - num_dims;
+    if (!checker.expect(tag, func(&src_shape, src.data(), axis_arg, dst.data()) == ppl::common::RC_SUCCESS)) {
+        return;
+    }
+    for (int64_t i = 0; i < (int64_t)ref.size(); i++) {
+        checker.check(tag, dst[i], ref[i], 0);
+    }
+    checker.check(tag, dst[ref.size()], 777, 0);
+}
+
+static void test_argmax_all(riscv_test_checker& checker, const std::vector<int64_t>& dims, const int32_t axis)
+{
+    test_argmax<float>(checker, "argmax_ndarray_fp32", argmax_ndarray_fp32, false, dims, axis);
+    test_argmax<float>(checker, "argmin_ndarray_fp32", argmin_ndarray_fp32, true, dims, axis);
+    test_argmax<__fp16>(checker, "argmax_ndarray_fp16", argmax_ndarray_fp16, false, dims, axis);
+    test_argmax<__fp16>(checker, "argmin_ndarray_fp16", argmin_ndarray_fp16, true, dims, axis);
+    test_argmax<int64_t>(checker, "argmax_ndarray_int64", argmax_ndarray_int64, false, dims, axis);
+    test_argmax<int64_t>(checker, "argmin_ndarray_int64", argmin_ndarray_int64, true, dims, axis);
+}
+
+int main()
+{
+    riscv_test_checker checker("argmax");
+
+    for (int64_t it = 0; it < 200; it++) {
+        const int64_t num_dims = 1 + rand() % 4;
+        std::vector<int64_t> dims(num_dims);
+        for (auto& d : dims) {
+            d = 1 + rand() % 9;
+        }
+        // long lines and more than one column block
+        if (it % 4 == 0) {
+            dims[rand() % num_dims] = 1 + rand() % 700;
+        }
+        test_argmax_all(checker, dims, rand() % num_dims);
+    }
+
+    // an empty axis gives index 0, empty outer dims write nothing
+    test_argmax_all(checker, {3, 0, 5}, 1);
+    test_argmax_all(checker, {4, 0}, 1);
+    test_argmax_all(checker, {0, 6, 2}, 1);
+
+    return checker.finish();
+}
@@ -0,0 +1,265 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include <vector>
+
+#include "ppl/kernel/riscv/fp32/concat.h"
+#include "ppl/kernel/riscv/fp32/split.h"
+#include "ppl/kernel/riscv/fp16/concat.h"
+#include "ppl/kernel/riscv/fp16/split.h"
+#include "ppl/kernel/riscv/int64/concat.h"
+#include "test_utils.h"
+
+using namespace ppl::kernel::riscv;
+
+// entries without a kernel are nullptr
+template <typename T>
+struct concat_api_t {
+    const char* name;
+    int64_t c_blk;
+    ppl::common::RetCode (*concat)(const T**, T*, const ppl::common::TensorShape**, const int32_t, const int32_t);
+    ppl::common::RetCode (*concat_interleave)(const T**, T*, const ppl::common::TensorShape**, const int32_t, const int32_t, const int32_t);
+    ppl::common::RetCode (*split)(const ppl::common::TensorShape*, const ppl::common::TensorShape**, const T*, const int32_t, const int32_t, T**);
+};
+
+// logical concat of ndarray parts along axis
+template <typename T>
+static std::vector<T> concat_ref(const std::vector<std::vector<T>>& parts, const std::vector<std::vector<int64_t>>& part_dims, const int32_t axis)
+{
+    const int64_t num_dims = part_dims[0].size();
+    const int64_t outer    = dims_product(part_dims[0], 0, axis);
+    std::vector<T> dst;
+    for (int64_t o = 0; o < outer; o++) {
+        for (size_t n = 0; n < parts.size(); n++) {
+            const int64_t run = dims_product(part_dims[n], axis, num_dims);
+            dst.insert(dst.end(), parts[n].begin() + o * run, parts[n].begin() + (o + 1) * run);
+        }
+    }
+    return dst;
+}
+
+// every logical element of an nbcx tensor matches ref and every padding lane is 0
+template <typename T>
+static void check_nbcx(riscv_test_checker& checker, const char* tag, const std::vector<T>& got, const std::vector<T>& ref, const std::vector<int64_t>& dims, const int64_t c_blk)
+{
+    const int64_t batch    = dims[0];
+    const int64_t channels = dims[1];
+    const int64_t spatial  = dims_product(dims, 2, dims.size());
+    const int64_t padded_c = (channels + c_blk - 1) / c_blk * c_blk;
+    for (int64_t n = 0; n < batch; n++) {
+        for (int64_t c = 0; c < padded_c; c++) {
+            for (int64_t s = 0; s < spatial; s++) {
+                const T expect = c < channels ? ref[(n * channels + c) * spatial + s] : (T)0;
+                checker.check(tag, got[nbcx_offset(padded_c, spatial, c_blk, n, c, s)], expect, 0);
+            }
+        }
+    }
+    checker.check(tag, got[batch * padded_c * spatial], 77, 0);
+}
+
+// parts of [N, C_i, H_i, W] blocked by c_blk, concat on axis then split back
+template <typename T>
+static void test_concat_nbcx(riscv_test_checker& checker, const concat_api_t<T>& api, const std::vector<std::vector<int64_t>>& part_dims, const int32_t axis)
+{
+    const int32_t num_parts = part_dims.size();
+    const int64_t c_blk     = api.c_blk;
+
+    // channel interleave is needed when a part other than the last ends inside a block
+    bool interleave = false;
+    for (int32_t n = 0; axis == 1 && n < num_parts - 1; n++) {
+        interleave = interleave || part_dims[n][1] % c_blk != 0;
+    }
+    if (interleave && (!api.concat_interleave || !api.split)) {
+        return;
+    }
+
+    // the interleave path must clear padding, the block copies carry the zero padding of their inputs
+    const T pad_val = interleave ? (T)-7 : (T)0;
+    std::vector<std::vector<T>> parts(num_parts), packed(num_parts);
+    std::vector<ppl::common::TensorShape> shapes(num_parts);
+    std::vector<const ppl::common::TensorShape*> shape_ptrs(num_parts);
+    std::vector<const T*> src_ptrs(num_parts);
+    for (int32_t n = 0; n < num_parts; n++) {
+        parts[n].resize(dims_product(part_dims[n], 0, 4));
+        for (auto& x : parts[n]) {
+            x = (T)(rand() % 1000);
+        }
+        packed[n] = to_nbcx(parts[n], part_dims[n], c_blk, pad_val);
+        shapes[n].Reshape(part_dims[n]);
+        shape_ptrs[n] = &shapes[n];
+        src_ptrs[n]   = packed[n].data();
+    }
+    std::vector<int64_t> dst_dims = part_dims[0];
+    for (int32_t n = 1; n < num_parts; n++) {
+        dst_dims[axis] += part_dims[n][axis];
+    }
+    const std::vector<T> ref = concat_ref(parts, part_dims, axis);
+    const int64_t dst_len    = dst_dims[0] * ((dst_dims[1] + c_blk - 1) / c_blk * c_blk) * dst_dims[2] * dst_dims[3];
+
+    // the axis may also be given from the back when no interleave is needed
+    std::vector<T> dst(dst_len + 1, (T)77);
+    const ppl::common::RetCode rc = interleave ? api.concat_interleave(src_ptrs.data(), dst.data(), shape_ptrs.data(), num_parts, axis, 1)
+                                               : api.concat(src_ptrs.data(), dst.data(), shape_ptrs.data(), num_parts, rand() % 2 ? axis : axis - 4);
+    if (checker.expect(api.name, rc == ppl::common::RC_SUCCESS)) {
+        check_nbcx(checker, api.name, dst, ref, dst_dims, c_blk);
+    }
+
+    if (!api.split) {
+        return;
+    }
+    ppl::common::TensorShape src_shape;
+    src_shape.Reshape(dst_dims);
+    std::vector<T> src = to_nbcx(ref, dst_dims, c_blk, (T)0);
+    std::vector<std::vector<T>> outs(num_parts);
+    std::vector<T*> out_ptrs(num_parts);
+    for (int32_t n = 0; n < num_parts; n++) {
+        // stale data in the padding lanes must not survive the split
+        outs[n].assign(packed[n].size(), (T)-3);
+        outs[n].push_back((T)77);
+        out_ptrs[n] = outs[n].data();
+    }
+    if (checker.expect(api.name, api.split(&src_shape, shape_ptrs.data(), src.data(), axis, num_parts, out_ptrs.data()) == ppl::common::RC_SUCCESS)) {
+        for (int32_t n = 0; n < num_parts; n++) {
+            check_nbcx(checker, api.name, outs[n], parts[n], part_dims[n], c_blk);
+        }
+    }
+}
+
+// ndarray parts differing only on axis, concat then split back
+template <typename T>
+static void test_concat_ndarray(riscv_test_checker& checker, const concat_api_t<T>& api, const std::vector<std::vector<int64_t>>& part_dims, const int32_t axis)
+{
+    const int32_t num_parts = part_dims.size();
+    const int64_t num_dims  = part_dims[0].size();
+    std::vector<std::vector<T>> parts(num_parts);
+    std::vector<ppl::common::TensorShape> shapes(num_parts);
+    std::vector<const ppl::common::TensorShape*> shape_ptrs(num_parts);
+    std::vector<const T*> src_ptrs(num_parts);
+    for (int32_t n = 0; n < num_parts; n++) {
+        parts[n].resize(dims_product(part_dims[n], 0, num_dims) + 1);
+        for (auto& x : parts[n]) {
+            x = (T)(rand() % 1000);
+        }
+        parts[n].pop_back();
+        shapes[n].Reshape(part_dims[n]);
+        shape_ptrs[n] = &shapes[n];
+        src_ptrs[n]   = parts[n].data();
+    }
+    std::vector<int64_t> dst_dims = part_dims[0];
+    for (int32_t n = 1; n < num_parts; n++) {
+        dst_dims[axis] += part_dims[n][axis];
+    }
+    const std::vector<T> ref = concat_ref(parts, part_dims, axis);
+
+    std::vector<T> dst(ref.size() + 1, (T)77);
+    if (checker.expect(api.name, api.concat(src_ptrs.data(), dst.data(), shape_ptrs.data(), num_parts, rand() % 2 ? axis : axis - num_dims) == ppl::common::RC_SUCCESS)) {
+        for (size_t i = 0; i < ref.size(); i++) {
+            checker.check(api.name, dst[i], ref[i], 0);
+        }
+        checker.check(api.name, dst[ref.size()], 77, 0);
+    }
+
+    if (!api.split) {
+        return;
+    }
+    ppl::common::TensorShape src_shape;
+    src_shape.Reshape(dst_dims);
+    std::vector<std::vector<T>> outs(num_parts);
+    std::vector<T*> out_ptrs(num_parts);
+    for (int32_t n = 0; n < num_parts; n++) {
+        outs[n].assign(parts[n].size() + 1, (T)77);
+        out_ptrs[n] = outs[n].data();
+    }
+    if (checker.expect(api.name, api.split(&src_shape, shape_ptrs.data(), ref.data(), axis, num_parts, out_ptrs.data()) == ppl::common::RC_SUCCESS)) {
+        for (int32_t n = 0; n < num_parts; n++) {
+            for (size_t i = 0; i < parts[n].size(); i++) {
+                checker.check(api.name, outs[n][i], parts[n][i], 0);
+            }
+            checker.check(api.name, outs[n][parts[n].size()], 77, 0);
+        }
+    }
+}
+
+template <typename T>
+static void test_concat_random_nbcx(riscv_test_checker& checker, const concat_api_t<T>& api, const int64_t it)
+{
+    const int64_t batch  = 1 + rand() % 3;
+    const int64_t width  = 1 + rand() % (it % 4 ? 5 : 300);
+    const int32_t num    = 1 + rand() % 4;
+    const bool aligned   = rand() % 3 == 0;
+    const int64_t c_blk  = api.c_blk;
+    const int64_t height = 1 + rand() % 4;
+    std::vector<std::vector<int64_t>> part_dims(num);
+    for (auto& d : part_dims) {
+        d = {batch, aligned ? c_blk * (1 + rand() % 3) : 1 + rand() % (3 * c_blk), height, width};
+    }
+    test_concat_nbcx(checker, api, part_dims, 1);
+
+    // spatial concat, all parts share the channel count
+    const int64_t channels = 1 + rand() % (2 * c_blk);
+    for (auto& d : part_dims) {
+        d = {batch, channels, 1 + rand() % 3, width};
+    }
+    test_concat_nbcx(checker, api, part_dims, 2);
+}
+
+template <typename T>
+static void test_concat_random_ndarray(riscv_test_checker& checker, const concat_api_t<T>& api, const int64_t it)
+{
+    const int64_t num_dims = 1 + rand() % 4;
+    std::vector<int64_t> dims(num_dims);
+    for (auto& d : dims) {
+        d = 1 + rand() % 5;
+    }
+    if (it % 7 == 0) {
+        dims.back() = 1 + rand() % 3000;
+    }
+    const int32_t axis = rand() % num_dims;
+    const int32_t num  = 1 + rand() % (it % 5 ? 4 : 9);
+    std::vector<std::vector<int64_t>> part_dims(num, dims);
+    for (auto& d : part_dims) {
+        d[axis] = 1 + rand() % 4;
+    }
+    test_concat_ndarray(checker, api, part_dims, axis);
+}
+
+int main()
+{
+    riscv_test_checker checker("concat");
+
+    const concat_api_t<float> n4cx_fp32       = {"concat_split_n4cx_fp32", 4, concat_n4cx_fp32, concat_n4cx_interleave_channels_fp32, split_n4cx_fp32};
+    const concat_api_t<__fp16> n8cx_fp16      = {"concat_split_n8cx_fp16", 8, concat_n8cx_fp16, concat_n8cx_interleave_channels_fp16, split_n8cx_fp16};
+    const concat_api_t<int64_t> n2cx_int64    = {"concat_n2cx_int64", 2, concat_n2cx_int64, nullptr, nullptr};
+    const concat_api_t<float> ndarray_fp32    = {"concat_split_ndarray_fp32", 1, concat_ndarray_fp32, nullptr, split_ndarray_fp32};
+    const concat_api_t<__fp16> ndarray_fp16   = {"concat_split_ndarray_fp16", 1, concat_ndarray_fp16, nullptr, split_ndarray_fp16};
+    const concat_api_t<int64_t> ndarray_int64 = {"concat_ndarray_int64", 1, concat_ndarray_int64, nullptr, nullptr};
+
+    for (int64_t it = 0; it < 200; it++) {
+        test_concat_random_nbcx(checker, n4cx_fp32, it);
+        test_concat_random_nbcx(checker, n8cx_fp16, it);
+        test_concat_random_nbcx(checker, n2cx_int64, it);
+        test_concat_random_ndarray(checker, ndarray_fp32, it);
+        test_concat_random_ndarray(checker, ndarray_fp16, it);
+        test_concat_random_ndarray(checker, ndarray_int64, it);
+    }
+
+    // a channel count below one block in the middle, and a single part
+    test_concat_nbcx<float>(checker, n4cx_fp32, {{1, 4, 2, 3}, {1, 1, 2, 3}, {1, 6, 2, 3}}, 1);
+    test_concat_nbcx<__fp16>(checker, n8cx_fp16, {{2, 3, 1, 5}, {2, 13, 1, 5}}, 1);
+    test_concat_nbcx<__fp16>(checker, n8cx_fp16, {{2, 5, 3, 4}}, 1);
+
+    return checker.finish();
+}
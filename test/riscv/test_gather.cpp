@@ -0,0 +1,189 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include <vector>
+
+#include "ppl/kernel/riscv/fp32/gather.h"
+#include "ppl/kernel/riscv/fp32/gather_elements.h"
+#include "ppl/kernel/riscv/fp32/gather_nd.h"
+#include "ppl/kernel/riscv/fp16/gather_elements.h"
+#include "ppl/kernel/riscv/fp16/gather_nd.h"
+#include "ppl/kernel/riscv/int64/gather_elements.h"
+#include "ppl/kernel/riscv/int64/gather_nd.h"
+#include "test_utils.h"
+
+using namespace ppl::kernel::riscv;
+
+template <typename T>
+using gather_elements_test_func_t = ppl::common::RetCode (*)(const ppl::common::TensorShape*, const ppl::common::TensorShape*, const T*, const int64_t*, const int64_t, T*);
+
+template <typename T>
+using gather_nd_test_func_t = ppl::common::RetCode (*)(const T*, const int64_t*, const int64_t*, const int64_t, const int64_t, const int64_t, T*);
+
+template <typename T>
+static std::vector<T> random_values(const int64_t len)
+{
+    std::vector<T> values(len + 1);
+    for (auto& x : values) {
+        x = (T)(rand() % 1000);
+    }
+    return values;
+}
+
+// [outer, gather, inner] indexed on the middle dim, indices may count from the back
+static void test_gather(riscv_test_checker& checker, const int64_t outer, const int64_t gather_dim, const int64_t inner, const int64_t num_indices, const int64_t indices_dim)
+{
+    const std::vector<float> src = random_values<float>(outer * gather_dim * inner);
+    std::vector<int64_t> indices(num_indices * indices_dim + 1);
+    for (auto& x : indices) {
+        x = rand() % (2 * gather_dim) - gather_dim;
+    }
+    const int64_t dst_len = outer * num_indices * indices_dim * inner;
+    std::vector<float> dst(dst_len + 1, 777.0f);
+    if (!checker.expect("gather_ndarray_fp32 rc", gather_ndarray_fp32(src.data(), dst.data(), indices.data(), outer, gather_dim, inner, num_indices, indices_dim) == ppl::common::RC_SUCCESS)) {
+        return;
+    }
+    for (int64_t o = 0; o < outer; o++) {
+        for (int64_t k = 0; k < num_indices * indices_dim; k++) {
+            const int64_t g = indices[k] < 0 ? indices[k] + gather_dim : indices[k];
+            for (int64_t i = 0; i < inner; i++) {
+                checker.check("gather_ndarray_fp32", dst[(o * num_indices * indices_dim + k) * inner + i], src[(o * gather_dim + g) * inner + i], 0);
+            }
+        }
+    }
+    checker.check("gather_ndarray_fp32 overrun", dst[dst_len], 777.0f, 0);
+}
+
+// dst[p] = src[p with the axis coord replaced by indices[p]], indices may be smaller than src off the axis
+template <typename T>
+static void test_gather_elements(
+    riscv_test_checker& checker,
+    const char* tag,
+    gather_elements_test_func_t<T> func,
+    const std::vector<int64_t>& src_dims,
+    const std::vector<int64_t>& indices_dims,
+    const int32_t axis)
+{
+    const int64_t num_dims    = src_dims.size();
+    const int64_t src_len     = dims_product(src_dims, 0, num_dims);
+    const int64_t indices_len = dims_product(indices_dims, 0, num_dims);
+    ppl::common::TensorShape src_shape, indices_shape;
+    src_shape.Reshape(src_dims);
+    indices_shape.Reshape(indices_dims);
+
+    const std::vector<T> src = random_values<T>(src_len);
+    std::vector<int64_t> indices(indices_len + 1);
+    for (auto& x : indices) {
+        x = rand() % (2 * src_dims[axis]) - src_dims[axis];
+    }
+    std::vector<T> dst(indices_len + 1, (T)777);
+    const int64_t axis_arg = rand() % 2 ? axis : axis - num_dims;
+    if (!checker.expect(tag, func(&src_shape, &indices_shape, src.data(), indices.data(), axis_arg, dst.data()) == ppl::common::RC_SUCCESS)) {
+        return;
+    }
+    for (int64_t p = 0; p < indices_len; p++) {
+        int64_t rem = p, offset = 0, stride = 1;
+        for (int64_t i = num_dims - 1; i >= 0; i--) {
+            int64_t coord = rem % indices_dims[i];
+            rem /= indices_dims[i];
+            if (i == axis) {
+                coord = indices[p] < 0 ? indices[p] + src_dims[i] : indices[p];
+            }
+            offset += coord * stride;
+            stride *= src_dims[i];
+        }
+        checker.check(tag, dst[p], src[offset], 0);
+    }
+    checker.check(tag, dst[indices_len], 777, 0);
+}
+
+// the leading indices_dim dims are indexed, each index selects an inner_dim slice
+template <typename T>
+static void test_gather_nd(riscv_test_checker& checker, const char* tag, gather_nd_test_func_t<T> func, const std::vector<int64_t>& src_dims, const int64_t indices_dim, const int64_t num_indices)
+{
+    const int64_t num_dims  = src_dims.size();
+    const int64_t inner_dim = dims_product(src_dims, indices_dim, num_dims);
+    std::vector<int64_t> strides(indices_dim);
+    for (int64_t i = indices_dim - 1, stride = inner_dim; i >= 0; i--) {
+        strides[i] = stride;
+        stride *= src_dims[i];
+    }
+    const std::vector<T> src = random_values<T>(dims_product(src_dims, 0, num_dims));
+    std::vector<int64_t> indices(num_indices * indices_dim + 1);
+    for (int64_t k = 0; k < num_indices; k++) {
+        for (int64_t i = 0; i < indices_dim; i++) {
+            indices[k * indices_dim + i] = rand() % src_dims[i];
+        }
+    }
+    const int64_t dst_len = num_indices * inner_dim;
+    std::vector<T> dst(dst_len + 1, (T)777);
+    if (!checker.expect(tag, func(src.data(), indices.data(), strides.data(), inner_dim, num_indices, indices_dim, dst.data()) == ppl::common::RC_SUCCESS)) {
+        return;
+    }
+    for (int64_t k = 0; k < num_indices; k++) {
+        int64_t offset = 0;
+        for (int64_t i = 0; i < indices_dim; i++) {
+            offset += indices[k * indices_dim + i] * strides[i];
+        }
+        for (int64_t j = 0; j < inner_dim; j++) {
+            checker.check(tag, dst[k * inner_dim + j], src[offset + j], 0);
+        }
+    }
+    checker.check(tag, dst[dst_len], 777, 0);
+}
+
+int main()
+{
+    riscv_test_checker checker("gather");
+
+    for (int64_t it = 0; it < 300; it++) {
+        // narrow inner slices are gathered element-wise, wide ones are bulk copied
+        test_gather(checker, 1 + rand() % 4, 1 + rand() % 20, 1 + rand() % (it % 3 ? 5 : 70), 1 + rand() % 4, 1 + rand() % 30);
+
+        const int64_t num_dims = 1 + rand() % 4;
+        std::vector<int64_t> src_dims(num_dims), indices_dims(num_dims);
+        for (int64_t i = 0; i < num_dims; i++) {
+            src_dims[i]     = 1 + rand() % 6;
+            indices_dims[i] = 1 + rand() % src_dims[i];
+        }
+        const int32_t axis = rand() % num_dims;
+        indices_dims[axis] = 1 + rand() % 8;
+        test_gather_elements<float>(checker, "gather_elements_ndarray_fp32", gather_elements_ndarray_fp32, src_dims, indices_dims, axis);
+        test_gather_elements<__fp16>(checker, "gather_elements_ndarray_fp16", gather_elements_ndarray_fp16, src_dims, indices_dims, axis);
+        test_gather_elements<int64_t>(checker, "gather_elements_ndarray_int64", gather_elements_ndarray_int64, src_dims, indices_dims, axis);
+
+        const int64_t rank = 1 + rand() % 4;
+        std::vector<int64_t> nd_dims(rank);
+        for (auto& d : nd_dims) {
+            d = 1 + rand() % 6;
+        }
+        if (it % 5 == 0) {
+            nd_dims.back() = 1 + rand() % 100;
+        }
+        const int64_t indices_dim = 1 + rand() % rank;
+        const int64_t num_indices = 1 + rand() % 20;
+        test_gather_nd<float>(checker, "gather_nd_ndarray_fp32", gather_nd_ndarray_fp32, nd_dims, indices_dim, num_indices);
+        test_gather_nd<__fp16>(checker, "gather_nd_ndarray_fp16", gather_nd_ndarray_fp16, nd_dims, indices_dim, num_indices);
+        test_gather_nd<int64_t>(checker, "gather_nd_ndarray_int64", gather_nd_ndarray_int64, nd_dims, indices_dim, num_indices);
+    }
+
+    // empty indices write nothing
+    test_gather(checker, 3, 4, 5, 0, 2);
+    test_gather_elements<float>(checker, "gather_elements_ndarray_fp32", gather_elements_ndarray_fp32, {3, 4}, {3, 0}, 0);
+    test_gather_nd<float>(checker, "gather_nd_ndarray_fp32", gather_nd_ndarray_fp32, {4, 5, 6}, 2, 0);
+
+    return checker.finish();
+}
@@ -0,0 +1,158 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <vector>
+
+#include "ppl/kernel/riscv/fp32/layernorm.h"
+#include "ppl/kernel/riscv/fp32/rmsnorm.h"
+#include "ppl/kernel/riscv/fp16/layernorm.h"
+#include "ppl/kernel/riscv/fp16/rmsnorm.h"
+#include "test_utils.h"
+
+using namespace ppl::kernel::riscv;
+
+// normalizes each row of len elements, scale and shift may be empty
+template <typename T>
+static std::vector<double> layernorm_ref(const std::vector<T>& src, const std::vector<T>& scale, const std::vector<T>& shift, const int64_t len, const double eps)
+{
+    std::vector<double> dst(src.size());
+    for (size_t r = 0; r < src.size() / len; r++) {
+        const T* row = src.data() + r * len;
+        double mean  = 0;
+        for (int64_t i = 0; i < len; i++) {
+            mean += row[i];
+        }
+        mean /= len;
+        double var = 0;
+        for (int64_t i = 0; i < len; i++) {
+            var += ((double)row[i] - mean) * ((double)row[i] - mean);
+        }
+        const double rstd = 1.0 / std::sqrt(var / len + eps);
+        for (int64_t i = 0; i < len; i++) {
+            dst[r * len + i] = ((double)row[i] - mean) * rstd * (scale.empty() ? 1.0 : (double)scale[i]) + (shift.empty() ? 0.0 : (double)shift[i]);
+        }
+    }
+    return dst;
+}
+
+template <typename T>
+static std::vector<double> rmsnorm_ref(const std::vector<T>& src, const std::vector<T>& scale, const int64_t len, const double eps)
+{
+    std::vector<double> dst(src.size());
+    for (size_t r = 0; r < src.size() / len; r++) {
+        const T* row = src.data() + r * len;
+        double sum   = 0;
+        for (int64_t i = 0; i < len; i++) {
+            sum += (double)row[i] * row[i];
+        }
+        const double rms = 1.0 / std::sqrt(sum / len + eps);
+        for (int64_t i = 0; i < len; i++) {
+            dst[r * len + i] = row[i] * rms * (scale.empty() ? 1.0 : (double)scale[i]);
+        }
+    }
+    return dst;
+}
+
+int main()
+{
+    riscv_test_checker checker("layernorm");
+    const int64_t rows = 3;
+
+    for (int64_t len : {1, 3, 4, 7, 8, 9, 17, 64, 77}) {
+        for (int32_t mode = 0; mode < 4; mode++) {
+            const bool has_scale = mode & 1;
+            const bool has_shift = mode & 2;
+            ppl::common::TensorShape shape;
+            shape.Reshape({rows, len});
+
+            std::vector<float> src(rows * len), scale, shift;
+            std::vector<__fp16> src_fp16(rows * len), scale_fp16, shift_fp16;
+            for (int64_t i = 0; i < rows * len; i++) {
+                src[i]      = rand_float(-2.0f, 2.0f);
+                src_fp16[i] = (__fp16)src[i];
+            }
+            for (int64_t i = 0; has_scale && i < len; i++) {
+                scale.push_back(rand_float(0.5f, 1.5f));
+                scale_fp16.push_back((__fp16)scale.back());
+            }
+            for (int64_t i = 0; has_shift && i < len; i++) {
+                shift.push_back(rand_float(0.0f, 1.0f));
+                shift_fp16.push_back((__fp16)shift.back());
+            }
+            const float* scale_ptr       = has_scale ? scale.data() : nullptr;
+            const float* shift_ptr       = has_shift ? shift.data() : nullptr;
+            const __fp16* scale_fp16_ptr = has_scale ? scale_fp16.data() : nullptr;
+            const __fp16* shift_fp16_ptr = has_shift ? shift_fp16.data() : nullptr;
+            std::vector<float> dst(rows * len);
+            std::vector<__fp16> dst_fp16(rows * len);
+
+            std::vector<double> ref = layernorm_ref(src, scale, shift, len, 1e-5);
+            checker.expect("layernorm_ndarray_fp32 rc", layernorm_ndarray_fp32(&shape, src.data(), scale_ptr, shift_ptr, -1, 1e-5f, dst.data()) == ppl::common::RC_SUCCESS);
+            for (int64_t i = 0; i < rows * len; i++) {
+                checker.check("layernorm_ndarray_fp32", dst[i], ref[i], 1e-4);
+            }
+            ref = layernorm_ref(src_fp16, scale_fp16, shift_fp16, len, 1e-5);
+            checker.expect("layernorm_ndarray_fp16 rc", layernorm_ndarray_fp16(&shape, src_fp16.data(), scale_fp16_ptr, shift_fp16_ptr, 1, 1e-5f, dst_fp16.data()) == ppl::common::RC_SUCCESS);
+            for (int64_t i = 0; i < rows * len; i++) {
+                checker.check("layernorm_ndarray_fp16", dst_fp16[i], ref[i], len == 1 ? 1e-2 : 5e-3);
+            }
+
+            ref = rmsnorm_ref(src, scale, len, 1e-6);
+            checker.expect("rmsnorm_ndarray_fp32 rc", rmsnorm_ndarray_fp32(&shape, src.data(), scale_ptr, 1, 1e-6f, dst.data()) == ppl::common::RC_SUCCESS);
+            for (int64_t i = 0; i < rows * len; i++) {
+                checker.check("rmsnorm_ndarray_fp32", dst[i], ref[i], 1e-5);
+            }
+            ref = rmsnorm_ref(src_fp16, scale_fp16, len, 1e-6);
+            checker.expect("rmsnorm_ndarray_fp16 rc", rmsnorm_ndarray_fp16(&shape, src_fp16.data(), scale_fp16_ptr, -1, 1e-6f, dst_fp16.data()) == ppl::common::RC_SUCCESS);
+            for (int64_t i = 0; i < rows * len; i++) {
+                checker.check("rmsnorm_ndarray_fp16", dst_fp16[i], ref[i], 3e-3);
+            }
+        }
+    }
+
+    // a large mean must not lose the variance
+    {
+        ppl::common::TensorShape shape;
+        shape.Reshape({2, 33});
+        std::vector<float> src(66), dst(66);
+        for (auto& v : src) {
+            v = 1000.0f + rand_float(-2.0f, 2.0f);
+        }
+        const std::vector<double> ref = layernorm_ref(src, std::vector<float>(), std::vector<float>(), 33, 1e-5);
+        layernorm_ndarray_fp32(&shape, src.data(), nullptr, nullptr, 1, 1e-5f, dst.data());
+        for (int64_t i = 0; i < 66; i++) {
+            checker.check("layernorm_ndarray_fp32 offset", dst[i], ref[i], 2e-2);
+        }
+    }
+
+    // axis 0 normalizes the whole tensor
+    {
+        ppl::common::TensorShape shape;
+        shape.Reshape({2, 3, 5});
+        std::vector<float> src(30), dst(30);
+        for (auto& v : src) {
+            v = rand_float(0.0f, 1.0f);
+        }
+        const std::vector<double> ref = layernorm_ref(src, std::vector<float>(), std::vector<float>(), 30, 1e-5);
+        layernorm_ndarray_fp32(&shape, src.data(), nullptr, nullptr, 0, 1e-5f, dst.data());
+        for (int64_t i = 0; i < 30; i++) {
+            checker.check("layernorm_ndarray_fp32 axis 0", dst[i], ref[i], 1e-4);
+        }
+    }
+
+    return checker.finish();
+}
@@ -0,0 +1,166 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <vector>
+
+#include "ppl/kernel/riscv/fp32/matmul.h"
+#include "ppl/kernel/riscv/fp16/matmul.h"
+#include "test_utils.h"
+
+using namespace ppl::kernel::riscv;
+
+struct matmul_test_case_t {
+    std::vector<int64_t> a_batch;
+    std::vector<int64_t> b_batch;
+    int64_t m;
+    int64_t n;
+    int64_t k;
+    bool trans_a;
+    bool trans_b;
+    bool packed_b;
+    bool a_vector; // A is 1-D of k, needs m == 1 and no batch
+    bool b_vector; // B is 1-D of k, needs n == 1 and no batch
+};
+
+static std::vector<int64_t> matmul_operand_dims(const std::vector<int64_t>& batch, const int64_t rows, const int64_t cols, const bool trans)
+{
+    std::vector<int64_t> dims = batch;
+    dims.push_back(trans ? cols : rows);
+    dims.push_back(trans ? rows : cols);
+    return dims;
+}
+
+// numpy matmul with batch broadcasting
+static std::vector<double> matmul_ref(const matmul_test_case_t& tc, const std::vector<float>& A, const std::vector<float>& B, int64_t* batch)
+{
+    const int64_t num_dims = std::max(tc.a_batch.size(), tc.b_batch.size());
+    std::vector<int64_t> a_dims(num_dims, 1), b_dims(num_dims, 1), y_dims(num_dims);
+    std::copy(tc.a_batch.begin(), tc.a_batch.end(), a_dims.begin() + num_dims - tc.a_batch.size());
+    std::copy(tc.b_batch.begin(), tc.b_batch.end(), b_dims.begin() + num_dims - tc.b_batch.size());
+    for (int64_t i = 0; i < num_dims; i++) {
+        y_dims[i] = std::max(a_dims[i], b_dims[i]);
+    }
+    *batch = dims_product(y_dims, 0, num_dims);
+
+    std::vector<double> Y(*batch * tc.m * tc.n);
+    for (int64_t b = 0; b < *batch; b++) {
+        int64_t rem      = b;
+        int64_t a_idx    = 0;
+        int64_t b_idx    = 0;
+        int64_t a_stride = 1;
+        int64_t b_stride = 1;
+        for (int64_t i = num_dims - 1; i >= 0; i--) {
+            const int64_t pos = rem % y_dims[i];
+            rem /= y_dims[i];
+            a_idx += (a_dims[i] == 1 ? 0 : pos) * a_stride;
+            b_idx += (b_dims[i] == 1 ? 0 : pos) * b_stride;
+            a_stride *= a_dims[i];
+            b_stride *= b_dims[i];
+        }
+        const float* A_ = A.data() + a_idx * tc.m * tc.k;
+        const float* B_ = B.data() + b_idx * tc.k * tc.n;
+        for (int64_t i = 0; i < tc.m; i++) {
+            for (int64_t j = 0; j < tc.n; j++) {
+                double acc = 0;
+                for (int64_t l = 0; l < tc.k; l++) {
+                    acc += (double)(tc.trans_a ? A_[l * tc.m + i] : A_[i * tc.k + l]) * (tc.trans_b ? B_[j * tc.k + l] : B_[l * tc.n + j]);
+                }
+                Y[(b * tc.m + i) * tc.n + j] = acc;
+            }
+        }
+    }
+    return Y;
+}
+
+static void run_case(riscv_test_checker& checker, const matmul_test_case_t& tc)
+{
+    ppl::common::TensorShape A_shape, B_shape;
+    A_shape.Reshape(tc.a_vector ? std::vector<int64_t>{tc.k} : matmul_operand_dims(tc.a_batch, tc.m, tc.k, tc.trans_a));
+    B_shape.Reshape(tc.b_vector ? std::vector<int64_t>{tc.k} : matmul_operand_dims(tc.b_batch, tc.k, tc.n, tc.trans_b));
+
+    // small integers keep both fp32 and fp16 sums exact
+    std::vector<float> A(A_shape.CalcElementsExcludingPadding()), B(B_shape.CalcElementsExcludingPadding());
+    for (auto& v : A) {
+        v = float(rand() % 7 - 3);
+    }
+    for (auto& v : B) {
+        v = float(rand() % 5 - 2);
+    }
+    int64_t batch                 = 1;
+    const std::vector<double> ref = matmul_ref(tc, A, B, &batch);
+    const int64_t y_len           = batch * tc.m * tc.n;
+
+    {
+        std::vector<float> packed_B(tc.packed_b ? matmul_ndarray_get_packed_b_bytes_fp32(&B_shape, tc.trans_b) / sizeof(float) : 0);
+        if (tc.packed_b) {
+            matmul_ndarray_pack_b_fp32(&B_shape, B.data(), tc.trans_b, packed_B.data());
+        }
+        std::vector<uint8_t> temp(matmul_ndarray_get_buffer_bytes_fp32(&A_shape, &B_shape, tc.trans_a, tc.trans_b, tc.packed_b));
+        std::vector<float> Y(y_len + 1, 777.0f);
+        const float* B_ptr = tc.packed_b ? packed_B.data() : B.data();
+        checker.expect("matmul_ndarray_fp32 rc", matmul_ndarray_fp32(&A_shape, &B_shape, A.data(), B_ptr, tc.trans_a, tc.trans_b, tc.packed_b, temp.data(), Y.data()) == ppl::common::RC_SUCCESS);
+        for (int64_t i = 0; i < y_len; i++) {
+            checker.check("matmul_ndarray_fp32", Y[i], ref[i], 0);
+        }
+        checker.check("matmul_ndarray_fp32 overrun", Y[y_len], 777.0f, 0);
+    }
+
+    {
+        std::vector<__fp16> A_fp16(A.begin(), A.end()), B_fp16(B.begin(), B.end());
+        std::vector<__fp16> packed_B(tc.packed_b ? matmul_ndarray_get_packed_b_bytes_fp16(&B_shape, tc.trans_b) / sizeof(__fp16) : 0);
+        if (tc.packed_b) {
+            matmul_ndarray_pack_b_fp16(&B_shape, B_fp16.data(), tc.trans_b, packed_B.data());
+        }
+        std::vector<uint8_t> temp(matmul_ndarray_get_buffer_bytes_fp16(&A_shape, &B_shape, tc.trans_a, tc.trans_b, tc.packed_b));
+        std::vector<__fp16> Y(y_len + 1, (__fp16)77.0f);
+        const __fp16* B_ptr = tc.packed_b ? packed_B.data() : B_fp16.data();
+        checker.expect("matmul_ndarray_fp16 rc", matmul_ndarray_fp16(&A_shape, &B_shape, A_fp16.data(), B_ptr, tc.trans_a, tc.trans_b, tc.packed_b, temp.data(), Y.data()) == ppl::common::RC_SUCCESS);
+        for (int64_t i = 0; i < y_len; i++) {
+            checker.check("matmul_ndarray_fp16", Y[i], ref[i], 0);
+        }
+        checker.check("matmul_ndarray_fp16 overrun", Y[y_len], 77.0f, 0);
+    }
+}
+
+int main()
+{
+    riscv_test_checker checker("matmul");
+    const std::vector<std::vector<int64_t>> a_batches = {{}, {3}, {2, 1}};
+    const std::vector<std::vector<int64_t>> b_batches = {{}, {1}, {4}};
+
+    for (int64_t i = 0; i < 150; i++) {
+        matmul_test_case_t tc;
+        const int64_t b = rand() % 3;
+        tc.a_batch      = a_batches[b];
+        tc.b_batch      = b_batches[b];
+        tc.m            = 1 + rand() % 20;
+        tc.n            = 1 + rand() % 40;
+        tc.k            = 1 + rand() % 30;
+        tc.trans_a      = rand() % 2;
+        tc.trans_b      = rand() % 2;
+        tc.packed_b     = rand() % 2;
+        tc.a_vector     = false;
+        tc.b_vector     = false;
+        run_case(checker, tc);
+    }
+    // vector operands on either side
+    run_case(checker, {{}, {}, 1, 5, 7, false, false, false, true, false});
+    run_case(checker, {{2, 3}, {}, 6, 1, 6, false, false, true, false, true});
+
+    return checker.finish();
+}
@@ -0,0 +1,183 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include <algorithm>
+#include <vector>
+
+#include "ppl/kernel/riscv/fp32/non_max_suppression.h"
+#include "test_utils.h"
+
+using namespace ppl::kernel::riscv;
+
+// [x1, y1, x2, y2] of one box in either input format
+static void nms_ref_corners(const float* b, const bool centered, float* corners)
+{
+    if (centered) {
+        corners[0] = b[0] - b[2] / 2;
+        corners[1] = b[1] - b[3] / 2;
+        corners[2] = b[0] + b[2] / 2;
+        corners[3] = b[1] + b[3] / 2;
+    } else {
+        corners[0] = std::min(b[1], b[3]);
+        corners[1] = std::min(b[0], b[2]);
+        corners[2] = std::max(b[1], b[3]);
+        corners[3] = std::max(b[0], b[2]);
+    }
+}
+
+// same float operation order as the kernel so that ious on the threshold agree
+static float nms_ref_iou(const float* b0, const float* b1, const bool centered)
+{
+    float c0[4], c1[4];
+    nms_ref_corners(b0, centered, c0);
+    nms_ref_corners(b1, centered, c1);
+    const float area0 = centered ? b0[2] * b0[3] : (c0[2] - c0[0]) * (c0[3] - c0[1]);
+    const float area1 = centered ? b1[2] * b1[3] : (c1[2] - c1[0]) * (c1[3] - c1[1]);
+    const float iw    = std::max(std::min(c1[2], c0[2]) - std::max(c1[0], c0[0]), 0.0f);
+    const float ih    = std::max(std::min(c1[3], c0[3]) - std::max(c1[1], c0[1]), 0.0f);
+    const float inter = iw * ih;
+    return inter / (area1 + area0 - inter);
+}
+
+// greedy nms over each batch and class, equal scores keep the index order
+static std::vector<int64_t> nms_ref(
+    const std::vector<float>& boxes,
+    const std::vector<float>& scores,
+    const int64_t num_boxes,
+    const int64_t batch,
+    const int64_t num_classes,
+    const bool centered,
+    const int64_t max_output,
+    const float iou_threshold,
+    const float score_threshold)
+{
+    std::vector<int64_t> dst;
+    for (int64_t n = 0; n < batch; n++) {
+        const float* p_boxes = boxes.data() + n * num_boxes * 4;
+        for (int64_t c = 0; c < num_classes; c++) {
+            const float* p_scores = scores.data() + (n * num_classes + c) * num_boxes;
+            std::vector<int64_t> order(num_boxes);
+            for (int64_t i = 0; i < num_boxes; i++) {
+                order[i] = i;
+            }
+            std::stable_sort(order.begin(), order.end(), [p_scores](const int64_t a, const int64_t b) {
+                return p_scores[a] > p_scores[b];
+            });
+            std::vector<int64_t> kept;
+            for (auto idx : order) {
+                if (p_scores[idx] <= score_threshold) {
+                    break;
+                }
+                bool keep = true;
+                for (auto k : kept) {
+                    if (nms_ref_iou(p_boxes + k * 4, p_boxes + idx * 4, centered) > iou_threshold) {
+                        keep = false;
+                        break;
+                    }
+                }
+                if (keep) {
+                    kept.push_back(idx);
+                }
+                // checked after the first box, so max_output 0 still keeps one box per class
+                if ((int64_t)kept.size() >= max_output) {
+                    break;
+                }
+            }
+            for (auto k : kept) {
+                dst.push_back(n);
+                dst.push_back(c);
+                dst.push_back(k);
+            }
+        }
+    }
+    return dst;
+}
+
+static void test_nms(
+    riscv_test_checker& checker,
+    const int64_t num_boxes,
+    const int64_t batch,
+    const int64_t num_classes,
+    const bool centered,
+    const int64_t max_output,
+    const float iou_threshold,
+    const float score_threshold)
+{
+    // integer coords and few score levels give many exact ties
+    std::vector<float> boxes(batch * num_boxes * 4 + 1);
+    for (int64_t i = 0; i < batch * num_boxes; i++) {
+        const float x = rand() % 100, y = rand() % 100, w = 1 + rand() % 30, h = 1 + rand() % 30;
+        float* b      = boxes.data() + i * 4;
+        if (centered) {
+            b[0] = x;
+            b[1] = y;
+            b[2] = w;
+            b[3] = h;
+        } else if (rand() % 2) {
+            b[0] = y;
+            b[1] = x;
+            b[2] = y + h;
+            b[3] = x + w;
+        } else {
+            b[0] = y + h;
+            b[1] = x + w;
+            b[2] = y;
+            b[3] = x;
+        }
+    }
+    std::vector<float> scores(batch * num_classes * num_boxes + 1);
+    for (auto& s : scores) {
+        s = (rand() % 50) / 50.0f;
+    }
+
+    const std::vector<int64_t> ref = nms_ref(boxes, scores, num_boxes, batch, num_classes, centered, max_output, iou_threshold, score_threshold);
+    std::vector<int64_t> dst(batch * num_classes * std::max<int64_t>(num_boxes, 1) * 3 + 1, 777);
+    int64_t num_out = -1;
+    const ppl::common::RetCode rc =
+        non_max_suppression_ndarray_fp32(boxes.data(), scores.data(), num_boxes, batch, num_classes, centered, max_output, iou_threshold, score_threshold, dst.data(), &num_out);
+    if (!checker.expect("non_max_suppression_ndarray_fp32 rc", rc == ppl::common::RC_SUCCESS) ||
+        !checker.check("non_max_suppression_ndarray_fp32 num", num_out, ref.size() / 3, 0)) {
+        return;
+    }
+    for (int64_t i = 0; i < (int64_t)ref.size(); i++) {
+        checker.check("non_max_suppression_ndarray_fp32", dst[i], ref[i], 0);
+    }
+    checker.check("non_max_suppression_ndarray_fp32 overrun", dst[ref.size()], 777, 0);
+}
+
+int main()
+{
+    riscv_test_checker checker("nms");
+
+    for (int64_t it = 0; it < 300; it++) {
+        const int64_t num_boxes   = 1 + rand() % 400;
+        const int64_t batch       = 1 + rand() % 3;
+        const int64_t num_classes = 1 + rand() % 4;
+        const bool centered       = rand() % 2;
+        const int64_t max_output  = rand() % 5 == 0 ? 0 : 1 + rand() % 60;
+        const float iou_threshold = (rand() % 10) / 10.0f;
+        // a negative threshold keeps the zero scores
+        const float score_threshold = (rand() % 5) / 5.0f - 0.2f;
+        test_nms(checker, num_boxes, batch, num_classes, centered, max_output, iou_threshold, score_threshold);
+    }
+
+    // no boxes, no classes, and a max output above the box count
+    test_nms(checker, 0, 2, 3, false, 10, 0.5f, 0.0f);
+    test_nms(checker, 20, 2, 0, true, 10, 0.5f, 0.0f);
+    test_nms(checker, 20, 1, 2, false, 1000, 0.5f, -1.0f);
+
+    return checker.finish();
+}
@@ -0,0 +1,195 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <vector>
+
+#include "ppl/kernel/riscv/fp32/pad.h"
+#include "ppl/kernel/riscv/fp16/pad.h"
+#include "ppl/kernel/riscv/int64/pad.h"
+#include "test_utils.h"
+
+using namespace ppl::kernel::riscv;
+
+enum pad_mode_t {
+    PAD_CONSTANT = 0,
+    PAD_REFLECT  = 1,
+    PAD_EDGE     = 2,
+};
+
+// src index of dst index idx - start_pad, -1 for a constant pad
+static int64_t pad_src_index(int64_t idx, const int64_t len, const pad_mode_t mode)
+{
+    if (idx >= 0 && idx < len) {
+        return idx;
+    }
+    if (mode == PAD_CONSTANT) {
+        return -1;
+    }
+    if (mode == PAD_EDGE) {
+        return idx < 0 ? 0 : len - 1;
+    }
+    while (idx < 0 || idx >= len) {
+        idx = idx < 0 ? -idx : 2 * (len - 1) - idx;
+    }
+    return idx;
+}
+
+// src offset of each dst element, -1 for constant pads
+static std::vector<int64_t> pad_ref(const std::vector<int64_t>& src_dims, const std::vector<int64_t>& dst_dims, const std::vector<int64_t>& start_pads, const pad_mode_t mode)
+{
+    const int64_t dst_len = dims_product(dst_dims, 0, dst_dims.size());
+    std::vector<int64_t> ref(dst_len);
+    for (int64_t i = 0; i < dst_len; i++) {
+        int64_t rem = i, src_offset = 0, src_stride = 1;
+        for (int64_t d = dst_dims.size() - 1; d >= 0; d--) {
+            const int64_t s = pad_src_index(rem % dst_dims[d] - start_pads[d], src_dims[d], mode);
+            rem /= dst_dims[d];
+            if (s < 0) {
+                src_offset = -1;
+                break;
+            }
+            src_offset += s * src_stride;
+            src_stride *= src_dims[d];
+        }
+        ref[i] = src_offset;
+    }
+    return ref;
+}
+
+static void test_ndarray(riscv_test_checker& checker, const std::vector<int64_t>& src_dims, const std::vector<int64_t>& start_pads, const std::vector<int64_t>& end_pads, const pad_mode_t mode)
+{
+    std::vector<int64_t> dst_dims(src_dims.size());
+    for (size_t d = 0; d < src_dims.size(); d++) {
+        dst_dims[d] = src_dims[d] + start_pads[d] + end_pads[d];
+    }
+    ppl::common::TensorShape src_shape, dst_shape;
+    src_shape.Reshape(src_dims);
+    dst_shape.Reshape(dst_dims);
+    const int64_t src_len          = dims_product(src_dims, 0, src_dims.size());
+    const int64_t dst_len          = dims_product(dst_dims, 0, dst_dims.size());
+    const std::vector<int64_t> ref = pad_ref(src_dims, dst_dims, start_pads, mode);
+
+    std::vector<float> src(src_len), dst(dst_len);
+    std::vector<__fp16> src_fp16(src_len), dst_fp16(dst_len);
+    std::vector<int64_t> src_int64(src_len), dst_int64(dst_len);
+    for (int64_t i = 0; i < src_len; i++) {
+        src[i]       = float(i + 1);
+        src_fp16[i]  = (__fp16)src[i];
+        src_int64[i] = i + 1;
+    }
+
+    ppl::common::RetCode rc[3];
+    if (mode == PAD_CONSTANT) {
+        rc[0] = pad_ndarray_constant_fp32(&src_shape, &dst_shape, src.data(), start_pads.data(), end_pads.data(), -5.0f, dst.data());
+        rc[1] = pad_ndarray_constant_fp16(&src_shape, &dst_shape, src_fp16.data(), start_pads.data(), end_pads.data(), (__fp16)-5.0f, dst_fp16.data());
+        rc[2] = pad_ndarray_constant_int64(&src_shape, &dst_shape, src_int64.data(), start_pads.data(), end_pads.data(), -5, dst_int64.data());
+    } else if (mode == PAD_REFLECT) {
+        rc[0] = pad_ndarray_reflect_fp32(&src_shape, &dst_shape, src.data(), start_pads.data(), end_pads.data(), dst.data());
+        rc[1] = pad_ndarray_reflect_fp16(&src_shape, &dst_shape, src_fp16.data(), start_pads.data(), end_pads.data(), dst_fp16.data());
+        rc[2] = pad_ndarray_reflect_int64(&src_shape, &dst_shape, src_int64.data(), start_pads.data(), end_pads.data(), dst_int64.data());
+    } else {
+        rc[0] = pad_ndarray_edge_fp32(&src_shape, &dst_shape, src.data(), start_pads.data(), end_pads.data(), dst.data());
+        rc[1] = pad_ndarray_edge_fp16(&src_shape, &dst_shape, src_fp16.data(), start_pads.data(), end_pads.data(), dst_fp16.data());
+        rc[2] = pad_ndarray_edge_int64(&src_shape, &dst_shape, src_int64.data(), start_pads.data(), end_pads.data(), dst_int64.data());
+    }
+    checker.expect("pad_ndarray_fp32 rc", rc[0] == ppl::common::RC_SUCCESS);
+    checker.expect("pad_ndarray_fp16 rc", rc[1] == ppl::common::RC_SUCCESS);
+    checker.expect("pad_ndarray_int64 rc", rc[2] == ppl::common::RC_SUCCESS);
+    for (int64_t i = 0; i < dst_len; i++) {
+        const double expect = ref[i] < 0 ? -5.0 : double(ref[i] + 1);
+        checker.check("pad_ndarray_fp32", dst[i], expect, 0);
+        checker.check("pad_ndarray_fp16", dst_fp16[i], (float)(__fp16)expect, 0);
+        checker.check("pad_ndarray_int64", dst_int64[i], expect, 0);
+    }
+}
+
+// channel pads are not allowed on nbcx, reflect and edge only
+static void test_nbcx(riscv_test_checker& checker, const std::vector<int64_t>& src_dims, const std::vector<int64_t>& start_pads, const std::vector<int64_t>& end_pads, const pad_mode_t mode)
+{
+    std::vector<int64_t> dst_dims(src_dims.size());
+    for (size_t d = 0; d < src_dims.size(); d++) {
+        dst_dims[d] = src_dims[d] + start_pads[d] + end_pads[d];
+    }
+    ppl::common::TensorShape src_shape, dst_shape;
+    src_shape.Reshape(src_dims);
+    dst_shape.Reshape(dst_dims);
+    const int64_t src_len          = dims_product(src_dims, 0, src_dims.size());
+    const int64_t channels         = dst_dims[1];
+    const int64_t dst_spatial      = dims_product(dst_dims, 2, dst_dims.size());
+    const std::vector<int64_t> ref = pad_ref(src_dims, dst_dims, start_pads, mode);
+
+    std::vector<float> src(src_len);
+    std::vector<__fp16> src_fp16(src_len);
+    for (int64_t i = 0; i < src_len; i++) {
+        src[i]      = float(i + 1);
+        src_fp16[i] = (__fp16)src[i];
+    }
+    const std::vector<float> src_n4cx  = to_nbcx(src, src_dims, 4, 0.0f);
+    const std::vector<__fp16> src_n8cx = to_nbcx(src_fp16, src_dims, 8, (__fp16)0.0f);
+    std::vector<float> dst_n4cx(dst_dims[0] * ((channels + 3) / 4 * 4) * dst_spatial);
+    std::vector<__fp16> dst_n8cx(dst_dims[0] * ((channels + 7) / 8 * 8) * dst_spatial);
+
+    ppl::common::RetCode rc[2];
+    if (mode == PAD_REFLECT) {
+        rc[0] = pad_n4cx_reflect_fp32(&src_shape, &dst_shape, src_n4cx.data(), start_pads.data(), end_pads.data(), dst_n4cx.data());
+        rc[1] = pad_n8cx_reflect_fp16(&src_shape, &dst_shape, src_n8cx.data(), start_pads.data(), end_pads.data(), dst_n8cx.data());
+    } else {
+        rc[0] = pad_n4cx_edge_fp32(&src_shape, &dst_shape, src_n4cx.data(), start_pads.data(), end_pads.data(), dst_n4cx.data());
+        rc[1] = pad_n8cx_edge_fp16(&src_shape, &dst_shape, src_n8cx.data(), start_pads.data(), end_pads.data(), dst_n8cx.data());
+    }
+    checker.expect("pad_n4cx_fp32 rc", rc[0] == ppl::common::RC_SUCCESS);
+    checker.expect("pad_n8cx_fp16 rc", rc[1] == ppl::common::RC_SUCCESS);
+    for (int64_t n = 0; n < dst_dims[0]; n++) {
+        for (int64_t c = 0; c < channels; c++) {
+            for (int64_t s = 0; s < dst_spatial; s++) {
+                const double expect = double(ref[(n * channels + c) * dst_spatial + s] + 1);
+                checker.check("pad_n4cx_fp32", dst_n4cx[nbcx_offset(channels, dst_spatial, 4, n, c, s)], expect, 0);
+                checker.check("pad_n8cx_fp16", dst_n8cx[nbcx_offset(channels, dst_spatial, 8, n, c, s)], (float)(__fp16)expect, 0);
+            }
+        }
+    }
+}
+
+int main()
+{
+    riscv_test_checker checker("pad");
+
+    for (int64_t i = 0; i < 400; i++) {
+        const int64_t num_dims = 1 + rand() % 4;
+        const pad_mode_t mode  = pad_mode_t(rand() % 3);
+        std::vector<int64_t> src_dims(num_dims), start_pads(num_dims), end_pads(num_dims);
+        for (int64_t d = 0; d < num_dims; d++) {
+            src_dims[d] = 1 + rand() % 6;
+            // reflect pads must stay below the dim
+            const int64_t max_pad = mode == PAD_REFLECT ? src_dims[d] - 1 : 4;
+            start_pads[d]         = rand() % (max_pad + 1);
+            end_pads[d]           = rand() % (max_pad + 1);
+            if (mode == PAD_CONSTANT && rand() % 4 == 0) {
+                // negative pads crop
+                start_pads[d] = -(rand() % src_dims[d]);
+            }
+        }
+        test_ndarray(checker, src_dims, start_pads, end_pads, mode);
+        if (num_dims >= 3 && mode != PAD_CONSTANT) {
+            start_pads[1] = 0;
+            end_pads[1]   = 0;
+            test_nbcx(checker, src_dims, start_pads, end_pads, mode);
+        }
+    }
+
+    return checker.finish();
+}
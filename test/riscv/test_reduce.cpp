@@ -0,0 +1,251 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <float.h>
+#include <algorithm>
+#include <vector>
+
+#include "ppl/kernel/riscv/fp32/reduce.h"
+#include "ppl/kernel/riscv/fp16/reduce.h"
+#include "test_utils.h"
+
+using namespace ppl::kernel::riscv;
+
+enum reduce_test_op_t {
+    TEST_REDUCE_MAX = 0,
+    TEST_REDUCE_MIN,
+    TEST_REDUCE_SUM,
+    TEST_REDUCE_MEAN,
+    TEST_REDUCE_PROD,
+    TEST_REDUCE_SUM_SQUARE,
+    TEST_REDUCE_L1,
+    TEST_REDUCE_L2,
+    TEST_REDUCE_LOG_SUM_EXP,
+    TEST_REDUCE_OP_COUNT,
+};
+
+typedef ppl::common::RetCode (*reduce_fp32_func_t)(const float*, float*, const ppl::common::TensorShape*, const ppl::common::TensorShape*, const int32_t*, const int32_t);
+typedef ppl::common::RetCode (*reduce_fp16_func_t)(const __fp16*, __fp16*, const ppl::common::TensorShape*, const ppl::common::TensorShape*, const int32_t*, const int32_t);
+
+static const reduce_fp32_func_t reduce_fp32_funcs[TEST_REDUCE_OP_COUNT] = {
+    reduce_max_fp32, reduce_min_fp32, reduce_sum_fp32, reduce_mean_fp32, reduce_prod_fp32,
+    reduce_sum_square_fp32, reduce_l1_fp32, reduce_l2_fp32, reduce_log_sum_exp_fp32};
+static const reduce_fp16_func_t reduce_fp16_funcs[TEST_REDUCE_OP_COUNT] = {
+    reduce_max_fp16, reduce_min_fp16, reduce_sum_fp16, reduce_mean_fp16, reduce_prod_fp16,
+    reduce_sum_square_fp16, reduce_l1_fp16, reduce_l2_fp16, reduce_log_sum_exp_fp16};
+
+// reduces the dims flagged in reduced, dst keeps them as size 1. An empty reduce gives the init value.
+static std::vector<double> reduce_ref(const int32_t op, const std::vector<int64_t>& dims, const std::vector<bool>& reduced, const std::vector<double>& src)
+{
+    const int64_t num_dims = dims.size();
+    std::vector<int64_t> dst_dims(num_dims);
+    for (int64_t i = 0; i < num_dims; i++) {
+        dst_dims[i] = reduced[i] ? 1 : dims[i];
+    }
+    const int64_t dst_len = dims_product(dst_dims, 0, num_dims);
+    std::vector<std::vector<double>> groups(dst_len);
+    for (int64_t e = 0; e < (int64_t)src.size(); e++) {
+        int64_t rem = e, dst_idx = 0, dst_stride = 1;
+        for (int64_t i = num_dims - 1; i >= 0; i--) {
+            dst_idx += (reduced[i] ? 0 : rem % dims[i]) * dst_stride;
+            rem /= dims[i];
+            dst_stride *= dst_dims[i];
+        }
+        groups[dst_idx].push_back(src[e]);
+    }
+
+    std::vector<double> dst(dst_len);
+    for (int64_t i = 0; i < dst_len; i++) {
+        const std::vector<double>& g = groups[i];
+        double acc                   = op == TEST_REDUCE_MAX ? -FLT_MAX : op == TEST_REDUCE_MIN ? FLT_MAX : op == TEST_REDUCE_PROD ? 1.0 : 0.0;
+        double max_val               = -INFINITY;
+        for (auto x : g) {
+            max_val = std::max(max_val, x);
+        }
+        for (auto x : g) {
+            switch (op) {
+                case TEST_REDUCE_MAX:
+                    acc = std::max(acc, x);
+                    break;
+                case TEST_REDUCE_MIN:
+                    acc = std::min(acc, x);
+                    break;
+                case TEST_REDUCE_PROD:
+                    acc *= x;
+                    break;
+                case TEST_REDUCE_SUM_SQUARE:
+                case TEST_REDUCE_L2:
+                    acc += x * x;
+                    break;
+                case TEST_REDUCE_L1:
+                    acc += std::fabs(x);
+                    break;
+                case TEST_REDUCE_LOG_SUM_EXP:
+                    acc += std::exp(x - max_val);
+                    break;
+                default:
+                    acc += x;
+                    break;
+            }
+        }
+        if (op == TEST_REDUCE_MEAN) {
+            acc /= g.size();
+        } else if (op == TEST_REDUCE_L2) {
+            acc = std::sqrt(acc);
+        } else if (op == TEST_REDUCE_LOG_SUM_EXP) {
+            acc = g.empty() ? -INFINITY : std::log(acc) + max_val;
+        }
+        dst[i] = acc;
+    }
+    return dst;
+}
+
+// runs one op on ndarray, or on nbcx when c_blk > 1, and compares the logical dst
+static void test_reduce(
+    riscv_test_checker& checker,
+    const int32_t op,
+    const bool is_fp16,
+    const int64_t c_blk,
+    const std::vector<int64_t>& dims,
+    const std::vector<bool>& reduced,
+    const std::vector<int32_t>& axes)
+{
+    const int64_t num_dims = dims.size();
+    const int64_t src_len  = dims_product(dims, 0, num_dims);
+    std::vector<int64_t> dst_dims(num_dims);
+    for (int64_t i = 0; i < num_dims; i++) {
+        dst_dims[i] = reduced[i] ? 1 : dims[i];
+    }
+    ppl::common::TensorShape src_shape, dst_shape;
+    src_shape.Reshape(dims);
+    dst_shape.Reshape(dst_dims);
+    src_shape.SetDataType(is_fp16 ? ppl::common::DATATYPE_FLOAT16 : ppl::common::DATATYPE_FLOAT32);
+    src_shape.SetDataFormat(c_blk == 1 ? ppl::common::DATAFORMAT_NDARRAY : c_blk == 4 ? ppl::common::DATAFORMAT_N4CX : ppl::common::DATAFORMAT_N8CX);
+
+    // prod stays near 1, fp16 stays small so that long sums do not overflow
+    std::vector<double> src(src_len);
+    for (auto& x : src) {
+        x = op == TEST_REDUCE_PROD ? rand_float(0.9f, 1.1f) : is_fp16 ? rand_float(-1.0f, 1.0f) : rand_float(-5.0f, 5.0f);
+        x = is_fp16 ? (double)(__fp16)x : (double)(float)x;
+    }
+    const std::vector<double> ref = reduce_ref(op, dims, reduced, src);
+
+    const int64_t dst_channels = c_blk == 1 ? 1 : dst_dims[1];
+    const int64_t dst_spatial  = c_blk == 1 ? (int64_t)ref.size() : dims_product(dst_dims, 2, num_dims);
+    const int64_t padded_len   = c_blk == 1 ? (int64_t)ref.size() : dst_dims[0] * ((dst_channels + c_blk - 1) / c_blk * c_blk) * dst_spatial;
+    std::vector<double> dst(padded_len + 1);
+    ppl::common::RetCode rc;
+    if (is_fp16) {
+        std::vector<__fp16> src_fp16(src.begin(), src.end());
+        if (c_blk > 1) {
+            src_fp16 = to_nbcx(src_fp16, dims, c_blk, (__fp16)0.0f);
+        }
+        src_fp16.push_back((__fp16)0.0f); // keeps the pointer valid for empty tensors
+        std::vector<__fp16> dst_fp16(padded_len + 1, (__fp16)7.0f);
+        rc = reduce_fp16_funcs[op](src_fp16.data(), dst_fp16.data(), &src_shape, &dst_shape, axes.data(), axes.size());
+        std::copy(dst_fp16.begin(), dst_fp16.end(), dst.begin());
+    } else {
+        std::vector<float> src_fp32(src.begin(), src.end());
+        if (c_blk > 1) {
+            src_fp32 = to_nbcx(src_fp32, dims, c_blk, 0.0f);
+        }
+        src_fp32.push_back(0.0f); // keeps the pointer valid for empty tensors
+        std::vector<float> dst_fp32(padded_len + 1, 7.0f);
+        rc = reduce_fp32_funcs[op](src_fp32.data(), dst_fp32.data(), &src_shape, &dst_shape, axes.data(), axes.size());
+        std::copy(dst_fp32.begin(), dst_fp32.end(), dst.begin());
+    }
+
+    const char* tag  = is_fp16 ? "reduce_fp16" : "reduce_fp32";
+    const double tol = is_fp16 ? 2e-2 : 1e-3;
+    if (!checker.expect(tag, rc == ppl::common::RC_SUCCESS)) {
+        return;
+    }
+    for (int64_t n = 0; n < (c_blk == 1 ? 1 : dst_dims[0]); n++) {
+        for (int64_t c = 0; c < dst_channels; c++) {
+            for (int64_t s = 0; s < dst_spatial; s++) {
+                const int64_t i = (n * dst_channels + c) * dst_spatial + s;
+                // rounds the reference too, e.g. the empty max init -FLT_MAX is -inf in fp16
+                const double expect = is_fp16 ? (double)(__fp16)ref[i] : ref[i];
+                checker.check(tag, dst[c_blk == 1 ? i : nbcx_offset(dst_channels, dst_spatial, c_blk, n, c, s)], expect, tol);
+            }
+        }
+    }
+    checker.check(tag, dst[padded_len], 7.0, 0);
+}
+
+int main()
+{
+    riscv_test_checker checker("reduce");
+
+    for (int64_t it = 0; it < 150; it++) {
+        const int64_t num_dims = 1 + rand() % 5;
+        std::vector<int64_t> dims(num_dims);
+        for (auto& d : dims) {
+            d = 1 + rand() % (it % 3 == 0 ? 40 : 7);
+        }
+        if (it % 10 == 0) {
+            // few outputs over a long reduce split the reduce space across threads
+            dims = {2, 5000 + rand() % 20000};
+        }
+        std::vector<bool> reduced(dims.size(), false);
+        std::vector<int32_t> axes;
+        for (int64_t i = 0; i < (int64_t)dims.size(); i++) {
+            if (rand() % 2) {
+                reduced[i] = true;
+                axes.push_back(rand() % 2 ? i : i - dims.size());
+            }
+        }
+        if (axes.empty()) {
+            reduced.back() = true;
+            axes.push_back(dims.size() - 1);
+        }
+        const int32_t op   = rand() % TEST_REDUCE_OP_COUNT;
+        const bool is_fp16 = rand() % 2;
+        test_reduce(checker, op, is_fp16, 1, dims, reduced, axes);
+        // nbcx without the channel axis runs on the ndarray path with a trailing block dim,
+        // reducing only size 1 dims is a plain copy that needs the channel padding in the shape
+        bool any_reduce = false;
+        for (int64_t i = 0; i < (int64_t)dims.size(); i++) {
+            any_reduce = any_reduce || (reduced[i] && dims[i] > 1);
+        }
+        if (dims.size() >= 3 && !reduced[1] && any_reduce) {
+            test_reduce(checker, op, is_fp16, is_fp16 ? 8 : 4, dims, reduced, axes);
+        }
+    }
+
+    // empty reduced dims give the init value, empty kept dims give nothing to write
+    for (int32_t op = 0; op < TEST_REDUCE_OP_COUNT; op++) {
+        test_reduce(checker, op, false, 1, {2, 0, 3}, {false, true, false}, {1});
+        test_reduce(checker, op, true, 1, {2, 0, 3}, {false, true, true}, {1, 2});
+        test_reduce(checker, op, false, 1, {0, 5}, {false, true}, {1});
+        test_reduce(checker, op, true, 1, {3, 0}, {true, false}, {0});
+    }
+
+    // padded channels would pollute the ops without a blocked channel kernel
+    {
+        ppl::common::TensorShape src_shape, dst_shape;
+        src_shape.Reshape({1, 5, 2, 2});
+        dst_shape.Reshape({1, 1, 2, 2});
+        src_shape.SetDataType(ppl::common::DATATYPE_FLOAT32);
+        src_shape.SetDataFormat(ppl::common::DATAFORMAT_N4CX);
+        std::vector<float> src(32, 1.0f), dst(16);
+        const int32_t axes[1] = {1};
+        checker.expect("reduce_prod_fp32 n4cx channel", reduce_prod_fp32(src.data(), dst.data(), &src_shape, &dst_shape, axes, 1) == ppl::common::RC_UNSUPPORTED);
+    }
+
+    return checker.finish();
+}
@@ -0,0 +1,86 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <vector>
+
+#include "ppl/kernel/riscv/fp32/reorder.h"
+#include "ppl/kernel/riscv/fp16/reorder.h"
+#include "test_utils.h"
+
+using namespace ppl::kernel::riscv;
+
+// reorders a [N, C, S] tensor from src_c_blk to dst_c_blk blocking, 1 is ndarray. Padding lanes of the src are
+// nan and padding lanes of the dst must come out zero.
+template <typename SrcT, typename DstT>
+static void test_reorder(
+    riscv_test_checker& checker,
+    const char* tag,
+    ppl::common::RetCode (*reorder)(const ppl::common::TensorShape*, const SrcT*, DstT*),
+    const int64_t src_c_blk,
+    const int64_t dst_c_blk,
+    const std::vector<int64_t>& dims)
+{
+    const int64_t batch    = dims[0];
+    const int64_t channels = dims[1];
+    const int64_t spatial  = dims_product(dims, 2, dims.size());
+    ppl::common::TensorShape shape;
+    shape.Reshape(dims);
+
+    std::vector<SrcT> logical(batch * channels * spatial);
+    for (int64_t i = 0; i < (int64_t)logical.size(); i++) {
+        logical[i] = (SrcT)float(i % 1000 - 500);
+    }
+    const std::vector<SrcT> src = to_nbcx(logical, dims, src_c_blk, (SrcT)NAN);
+    const int64_t dst_len       = batch * ((channels + dst_c_blk - 1) / dst_c_blk * dst_c_blk) * spatial;
+    std::vector<DstT> dst(dst_len + 1, (DstT)99.0f);
+
+    checker.expect(tag, reorder(&shape, src.data(), dst.data()) == ppl::common::RC_SUCCESS);
+    for (int64_t n = 0; n < batch; n++) {
+        for (int64_t c = 0; c < (channels + dst_c_blk - 1) / dst_c_blk * dst_c_blk; c++) {
+            for (int64_t s = 0; s < spatial; s++) {
+                const double expect = c < channels ? (double)logical[(n * channels + c) * spatial + s] : 0.0;
+                checker.check(tag, dst[nbcx_offset(channels, spatial, dst_c_blk, n, c, s)], expect, 0);
+            }
+        }
+    }
+    checker.check(tag, dst[dst_len], 99.0, 0);
+}
+
+int main()
+{
+    riscv_test_checker checker("reorder");
+
+    for (int64_t i = 0; i < 300; i++) {
+        std::vector<int64_t> dims = {1 + rand() % 3, 1 + rand() % 20};
+        for (int64_t d = rand() % 3; d > 0; d--) {
+            dims.push_back(1 + rand() % 13);
+        }
+        if (i % 50 == 0) {
+            dims = {2, 1 + rand() % 20, 3, 1000};
+        }
+        test_reorder<float, float>(checker, "reorder_ndarray_n4cx_fp32", reorder_ndarray_n4cx_fp32, 1, 4, dims);
+        test_reorder<float, float>(checker, "reorder_n4cx_ndarray_fp32", reorder_n4cx_ndarray_fp32, 4, 1, dims);
+        test_reorder<float, __fp16>(checker, "reorder_ndarray_fp32_n8cx_fp16", reorder_ndarray_fp32_n8cx_fp16, 1, 8, dims);
+        test_reorder<float, __fp16>(checker, "reorder_n4cx_fp32_n8cx_fp16", reorder_n4cx_fp32_n8cx_fp16, 4, 8, dims);
+        test_reorder<__fp16, __fp16>(checker, "reorder_ndarray_n8cx_fp16", reorder_ndarray_n8cx_fp16, 1, 8, dims);
+        test_reorder<__fp16, __fp16>(checker, "reorder_n8cx_ndarray_fp16", reorder_n8cx_ndarray_fp16, 8, 1, dims);
+        test_reorder<__fp16, float>(checker, "reorder_n8cx_fp16_ndarray_fp32", reorder_n8cx_fp16_ndarray_fp32, 8, 1, dims);
+        test_reorder<__fp16, float>(checker, "reorder_n8cx_fp16_n4cx_fp32", reorder_n8cx_fp16_n4cx_fp32, 8, 4, dims);
+    }
+
+    return checker.finish();
+}
@@ -0,0 +1,312 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <vector>
+
+#include "ppl/kernel/riscv/fp32/lstm.h"
+#include "ppl/kernel/riscv/fp32/gru.h"
+#include "ppl/kernel/riscv/fp16/lstm.h"
+#include "ppl/kernel/riscv/fp16/gru.h"
+#include "test_utils.h"
+
+using namespace ppl::kernel::riscv;
+
+template <typename T>
+struct lstm_api_t {
+    uint64_t (*get_packed_W_bytes)(const rnn_direction_t, const int64_t, const int64_t);
+    ppl::common::RetCode (*pack_W)(const T*, const rnn_direction_t, const int64_t, const int64_t, T*);
+    uint64_t (*get_packed_R_bytes)(const rnn_direction_t, const int64_t);
+    ppl::common::RetCode (*pack_R)(const T*, const rnn_direction_t, const int64_t, T*);
+    uint64_t (*get_buffer_bytes)(const ppl::common::TensorShape*, const rnn_direction_t, const int64_t, const bool, const bool, const bool, const bool);
+    ppl::common::RetCode (*execute)(
+        const ppl::common::TensorShape*, const T*, const T*, const T*, const T*, const T*, const int32_t*, const T*, const T*,
+        const rnn_direction_t, const int64_t, const bool, const bool, void*, T*, T*, T*);
+};
+
+template <typename T>
+struct gru_api_t {
+    uint64_t (*get_packed_W_bytes)(const rnn_direction_t, const int64_t, const int64_t);
+    ppl::common::RetCode (*pack_W)(const T*, const rnn_direction_t, const int64_t, const int64_t, T*);
+    uint64_t (*get_packed_R_bytes)(const rnn_direction_t, const int64_t);
+    ppl::common::RetCode (*pack_R)(const T*, const rnn_direction_t, const int64_t, T*);
+    uint64_t (*get_buffer_bytes)(const ppl::common::TensorShape*, const rnn_direction_t, const int64_t, const bool, const bool, const bool);
+    ppl::common::RetCode (*execute)(
+        const ppl::common::TensorShape*, const T*, const T*, const T*, const T*, const int32_t*, const T*,
+        const rnn_direction_t, const int64_t, const bool, const bool, const bool, void*, T*, T*);
+};
+
+// weights and optional inputs of one case, the vectors of absent inputs are empty
+struct rnn_test_case_t {
+    bool is_lstm;
+    rnn_direction_t direction;
+    int64_t seq_len;
+    int64_t batch;
+    int64_t input_size;
+    int64_t hidden_size;
+    bool linear_before_reset;
+    bool packed_W;
+    bool packed_R;
+    bool has_Y;
+    bool has_Y_h;
+    bool has_Y_c;
+    std::vector<float> X, W, R, P, bias, initial_h, initial_c;
+    std::vector<int32_t> sequence_lens;
+};
+
+static double sigmoid(const double x)
+{
+    return 1.0 / (1.0 + std::exp(-x));
+}
+
+static std::vector<float> rand_vector(const int64_t len, const float scale, const bool round_fp16)
+{
+    std::vector<float> v(len);
+    for (auto& x : v) {
+        x = rand_float(-scale, scale);
+        x = round_fp16 ? (float)(__fp16)x : x;
+    }
+    return v;
+}
+
+// onnx lstm / gru with gate order iofc / zrh, steps past sequence_lens leave Y zero
+static void rnn_ref(const rnn_test_case_t& tc, std::vector<double>* Y, std::vector<double>* Y_h, std::vector<double>* Y_c)
+{
+    const int64_t num_dir  = tc.direction == rnn_direction::BIDIRECTIONAL ? 2 : 1;
+    const int64_t num_gate = tc.is_lstm ? 4 : 3;
+    const int64_t B        = tc.batch;
+    const int64_t I        = tc.input_size;
+    const int64_t H        = tc.hidden_size;
+    const int64_t GH       = num_gate * H;
+    Y->assign(tc.seq_len * num_dir * B * H, 0.0);
+    Y_h->assign(num_dir * B * H, 0.0);
+    Y_c->assign(num_dir * B * H, 0.0);
+
+    for (int64_t nd = 0; nd < num_dir; nd++) {
+        const bool reverse = nd == 1 || tc.direction == rnn_direction::REVERSE;
+        const float* W     = tc.W.data() + nd * GH * I;
+        const float* R     = tc.R.data() + nd * GH * H;
+        const float* Wb    = tc.bias.empty() ? nullptr : tc.bias.data() + nd * 2 * GH;
+        const float* Rb    = tc.bias.empty() ? nullptr : Wb + GH;
+        const float* P     = tc.P.empty() ? nullptr : tc.P.data() + nd * 3 * H;
+        for (int64_t b = 0; b < B; b++) {
+            const int64_t len = tc.sequence_lens.empty() ? tc.seq_len : tc.sequence_lens[b];
+            std::vector<double> h(H, 0.0), c(H, 0.0), x_gate(GH), h_gate(GH), next_h(H);
+            for (int64_t j = 0; j < H; j++) {
+                h[j] = tc.initial_h.empty() ? 0.0 : tc.initial_h[(nd * B + b) * H + j];
+                c[j] = tc.initial_c.empty() ? 0.0 : tc.initial_c[(nd * B + b) * H + j];
+            }
+            for (int64_t s = 0; s < len; s++) {
+                const int64_t t = reverse ? len - 1 - s : s;
+                for (int64_t g = 0; g < GH; g++) {
+                    x_gate[g] = Wb ? Wb[g] : 0.0;
+                    h_gate[g] = Rb ? Rb[g] : 0.0;
+                    for (int64_t i = 0; i < I; i++) {
+                        x_gate[g] += (double)tc.X[(t * B + b) * I + i] * W[g * I + i];
+                    }
+                    for (int64_t i = 0; i < H; i++) {
+                        h_gate[g] += h[i] * R[g * H + i];
+                    }
+                }
+                for (int64_t j = 0; j < H; j++) {
+                    if (tc.is_lstm) {
+                        const double it = sigmoid(x_gate[j] + h_gate[j] + (P ? P[j] * c[j] : 0.0));
+                        const double ft = sigmoid(x_gate[2 * H + j] + h_gate[2 * H + j] + (P ? P[2 * H + j] * c[j] : 0.0));
+                        const double ct = std::tanh(x_gate[3 * H + j] + h_gate[3 * H + j]);
+                        c[j]            = ft * c[j] + it * ct;
+                        const double ot = sigmoid(x_gate[H + j] + h_gate[H + j] + (P ? P[H + j] * c[j] : 0.0));
+                        next_h[j]       = ot * std::tanh(c[j]);
+                    } else {
+                        const double zt = sigmoid(x_gate[j] + h_gate[j]);
+                        const double rt = sigmoid(x_gate[H + j] + h_gate[H + j]);
+                        double ht       = 0.0;
+                        if (tc.linear_before_reset) {
+                            ht = rt * h_gate[2 * H + j];
+                        } else {
+                            // the recurrence of the hidden gate is applied to r (.) h
+                            ht = Rb ? Rb[2 * H + j] : 0.0;
+                            for (int64_t i = 0; i < H; i++) {
+                                ht += sigmoid(x_gate[H + i] + h_gate[H + i]) * h[i] * R[(2 * H + j) * H + i];
+                            }
+                        }
+                        next_h[j] = (1.0 - zt) * std::tanh(x_gate[2 * H + j] + ht) + zt * h[j];
+                    }
+                }
+                h = next_h;
+                for (int64_t j = 0; j < H; j++) {
+                    (*Y)[((t * num_dir + nd) * B + b) * H + j] = h[j];
+                }
+            }
+            for (int64_t j = 0; j < H; j++) {
+                (*Y_h)[(nd * B + b) * H + j] = h[j];
+                (*Y_c)[(nd * B + b) * H + j] = c[j];
+            }
+        }
+    }
+}
+
+static rnn_test_case_t rand_case(const bool is_lstm, const bool round_fp16)
+{
+    rnn_test_case_t tc;
+    tc.is_lstm             = is_lstm;
+    tc.direction           = rand() % 3;
+    tc.seq_len             = rand() % 5 == 0 ? 0 : 1 + rand() % 6;
+    tc.batch               = 1 + rand() % 5;
+    tc.input_size          = 1 + rand() % 23;
+    tc.hidden_size         = 1 + rand() % 21;
+    tc.linear_before_reset = rand() % 2;
+    tc.packed_W            = rand() % 2;
+    tc.packed_R            = rand() % 2;
+    tc.has_Y               = rand() % 3 != 0;
+    tc.has_Y_h             = rand() % 2;
+    tc.has_Y_c             = rand() % 2;
+
+    const int64_t num_dir = tc.direction == rnn_direction::BIDIRECTIONAL ? 2 : 1;
+    const int64_t GH      = (is_lstm ? 4 : 3) * tc.hidden_size;
+    tc.X                  = rand_vector(tc.seq_len * tc.batch * tc.input_size, 1.0f, round_fp16);
+    tc.W                  = rand_vector(num_dir * GH * tc.input_size, 0.5f, round_fp16);
+    tc.R                  = rand_vector(num_dir * GH * tc.hidden_size, 0.5f, round_fp16);
+    if (rand() % 2) {
+        tc.bias = rand_vector(num_dir * 2 * GH, 0.5f, round_fp16);
+    }
+    if (rand() % 2) {
+        tc.initial_h = rand_vector(num_dir * tc.batch * tc.hidden_size, 1.0f, round_fp16);
+    }
+    if (is_lstm && rand() % 2) {
+        tc.initial_c = rand_vector(num_dir * tc.batch * tc.hidden_size, 1.0f, round_fp16);
+    }
+    if (is_lstm && rand() % 2) {
+        tc.P = rand_vector(num_dir * 3 * tc.hidden_size, 0.5f, round_fp16);
+    }
+    if (rand() % 2) {
+        for (int64_t b = 0; b < tc.batch; b++) {
+            tc.sequence_lens.push_back(rand() % (tc.seq_len + 1));
+        }
+    }
+    return tc;
+}
+
+template <typename T>
+static const T* optional_data(const std::vector<T>& v)
+{
+    return v.empty() ? nullptr : v.data();
+}
+
+template <typename T>
+static void check_outputs(riscv_test_checker& checker, const char* tag, const rnn_test_case_t& tc, const std::vector<T>& Y, const std::vector<T>& Y_h, const std::vector<T>& Y_c, const double tol)
+{
+    std::vector<double> ref_Y, ref_Y_h, ref_Y_c;
+    rnn_ref(tc, &ref_Y, &ref_Y_h, &ref_Y_c);
+    for (size_t i = 0; tc.has_Y && i < ref_Y.size(); i++) {
+        checker.check(tag, Y[i], ref_Y[i], tol);
+    }
+    for (size_t i = 0; tc.has_Y_h && i < ref_Y_h.size(); i++) {
+        checker.check(tag, Y_h[i], ref_Y_h[i], tol);
+    }
+    for (size_t i = 0; tc.is_lstm && tc.has_Y_c && i < ref_Y_c.size(); i++) {
+        checker.check(tag, Y_c[i], ref_Y_c[i], 2 * tol);
+    }
+    checker.check(tag, Y.back(), 7.0, 0);
+    checker.check(tag, Y_h.back(), 7.0, 0);
+}
+
+template <typename T>
+static void test_lstm(riscv_test_checker& checker, const char* tag, const lstm_api_t<T>& api, const rnn_test_case_t& tc, const double tol)
+{
+    const int64_t num_dir = tc.direction == rnn_direction::BIDIRECTIONAL ? 2 : 1;
+    const int64_t H       = tc.hidden_size;
+    ppl::common::TensorShape X_shape;
+    X_shape.Reshape({tc.seq_len, tc.batch, tc.input_size});
+
+    const std::vector<T> X(tc.X.begin(), tc.X.end()), W(tc.W.begin(), tc.W.end()), R(tc.R.begin(), tc.R.end());
+    const std::vector<T> P(tc.P.begin(), tc.P.end()), bias(tc.bias.begin(), tc.bias.end());
+    const std::vector<T> initial_h(tc.initial_h.begin(), tc.initial_h.end()), initial_c(tc.initial_c.begin(), tc.initial_c.end());
+    std::vector<T> packed_W(api.get_packed_W_bytes(tc.direction, H, tc.input_size) / sizeof(T));
+    std::vector<T> packed_R(api.get_packed_R_bytes(tc.direction, H) / sizeof(T));
+    if (tc.packed_W) {
+        api.pack_W(W.data(), tc.direction, H, tc.input_size, packed_W.data());
+    }
+    if (tc.packed_R) {
+        api.pack_R(R.data(), tc.direction, H, packed_R.data());
+    }
+    std::vector<uint8_t> temp(api.get_buffer_bytes(&X_shape, tc.direction, H, tc.has_Y_h, tc.has_Y_c, tc.packed_W, tc.packed_R));
+    std::vector<T> Y(tc.seq_len * num_dir * tc.batch * H + 1, (T)7.0f);
+    std::vector<T> Y_h(num_dir * tc.batch * H + 1, (T)7.0f), Y_c(num_dir * tc.batch * H + 1, (T)7.0f);
+
+    const ppl::common::RetCode rc = api.execute(
+        &X_shape, X.data(), tc.packed_W ? packed_W.data() : W.data(), tc.packed_R ? packed_R.data() : R.data(),
+        optional_data(P), optional_data(bias), optional_data(tc.sequence_lens), optional_data(initial_h), optional_data(initial_c),
+        tc.direction, H, tc.packed_W, tc.packed_R, temp.data(), tc.has_Y ? Y.data() : nullptr, tc.has_Y_h ? Y_h.data() : nullptr, tc.has_Y_c ? Y_c.data() : nullptr);
+    checker.expect(tag, rc == ppl::common::RC_SUCCESS);
+    check_outputs(checker, tag, tc, Y, Y_h, Y_c, tol);
+    checker.check(tag, Y_c.back(), 7.0, 0);
+}
+
+template <typename T>
+static void test_gru(riscv_test_checker& checker, const char* tag, const gru_api_t<T>& api, const rnn_test_case_t& tc, const double tol)
+{
+    const int64_t num_dir = tc.direction == rnn_direction::BIDIRECTIONAL ? 2 : 1;
+    const int64_t H       = tc.hidden_size;
+    ppl::common::TensorShape X_shape;
+    X_shape.Reshape({tc.seq_len, tc.batch, tc.input_size});
+
+    const std::vector<T> X(tc.X.begin(), tc.X.end()), W(tc.W.begin(), tc.W.end()), R(tc.R.begin(), tc.R.end());
+    const std::vector<T> bias(tc.bias.begin(), tc.bias.end()), initial_h(tc.initial_h.begin(), tc.initial_h.end());
+    std::vector<T> packed_W(api.get_packed_W_bytes(tc.direction, H, tc.input_size) / sizeof(T));
+    std::vector<T> packed_R(api.get_packed_R_bytes(tc.direction, H) / sizeof(T));
+    if (tc.packed_W) {
+        api.pack_W(W.data(), tc.direction, H, tc.input_size, packed_W.data());
+    }
+    if (tc.packed_R) {
+        api.pack_R(R.data(), tc.direction, H, packed_R.data());
+    }
+    std::vector<uint8_t> temp(api.get_buffer_bytes(&X_shape, tc.direction, H, tc.has_Y_h, tc.packed_W, tc.packed_R));
+    std::vector<T> Y(tc.seq_len * num_dir * tc.batch * H + 1, (T)7.0f);
+    std::vector<T> Y_h(num_dir * tc.batch * H + 1, (T)7.0f), Y_c(1, (T)7.0f);
+
+    const ppl::common::RetCode rc = api.execute(
+        &X_shape, X.data(), tc.packed_W ? packed_W.data() : W.data(), tc.packed_R ? packed_R.data() : R.data(),
+        optional_data(bias), optional_data(tc.sequence_lens), optional_data(initial_h), tc.direction, H, tc.linear_before_reset,
+        tc.packed_W, tc.packed_R, temp.data(), tc.has_Y ? Y.data() : nullptr, tc.has_Y_h ? Y_h.data() : nullptr);
+    checker.expect(tag, rc == ppl::common::RC_SUCCESS);
+    check_outputs(checker, tag, tc, Y, Y_h, Y_c, tol);
+}
+
+int main()
+{
+    riscv_test_checker checker("rnn");
+    const lstm_api_t<float> lstm_fp32 = {
+        lstm_ndarray_get_packed_W_bytes_fp32, lstm_ndarray_pack_W_fp32, lstm_ndarray_get_packed_R_bytes_fp32,
+        lstm_ndarray_pack_R_fp32, lstm_ndarray_get_buffer_bytes_fp32, lstm_ndarray_fp32};
+    const lstm_api_t<__fp16> lstm_fp16 = {
+        lstm_ndarray_get_packed_W_bytes_fp16, lstm_ndarray_pack_W_fp16, lstm_ndarray_get_packed_R_bytes_fp16,
+        lstm_ndarray_pack_R_fp16, lstm_ndarray_get_buffer_bytes_fp16, lstm_ndarray_fp16};
+    const gru_api_t<float> gru_fp32 = {
+        gru_ndarray_get_packed_W_bytes_fp32, gru_ndarray_pack_W_fp32, gru_ndarray_get_packed_R_bytes_fp32,
+        gru_ndarray_pack_R_fp32, gru_ndarray_get_buffer_bytes_fp32, gru_ndarray_fp32};
+    const gru_api_t<__fp16> gru_fp16 = {
+        gru_ndarray_get_packed_W_bytes_fp16, gru_ndarray_pack_W_fp16, gru_ndarray_get_packed_R_bytes_fp16,
+        gru_ndarray_pack_R_fp16, gru_ndarray_get_buffer_bytes_fp16, gru_ndarray_fp16};
+
+    for (int64_t i = 0; i < 200; i++) {
+        test_lstm(checker, "lstm_ndarray_fp32", lstm_fp32, rand_case(true, false), 2e-5);
+        test_lstm(checker, "lstm_ndarray_fp16", lstm_fp16, rand_case(true, true), 5e-2);
+        test_gru(checker, "gru_ndarray_fp32", gru_fp32, rand_case(false, false), 2e-5);
+        test_gru(checker, "gru_ndarray_fp16", gru_fp16, rand_case(false, true), 5e-2);
+    }
+
+    return checker.finish();
+}
@@ -0,0 +1,251 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include <vector>
+
+#include "ppl/kernel/riscv/fp32/scatter_nd.h"
+#include "ppl/kernel/riscv/fp32/scatter_elements.h"
+#include "ppl/kernel/riscv/fp16/scatter_nd.h"
+#include "ppl/kernel/riscv/fp16/scatter_elements.h"
+#include "ppl/kernel/riscv/int64/scatter_nd.h"
+#include "ppl/kernel/riscv/int64/scatter_elements.h"
+#include "test_utils.h"
+
+using namespace ppl::kernel::riscv;
+
+template <typename T>
+struct scatter_api_t {
+    ppl::common::datatype_t data_type;
+    const char* nd_tag;
+    ppl::common::RetCode (*nd)(const T*, const T*, const int64_t*, const int32_t*, const int64_t, const int64_t, const int64_t, const int64_t, const int32_t, T*);
+    const char* elements_tag;
+    ppl::common::RetCode (*elements)(const ppl::common::TensorShape*, const ppl::common::TensorShape*, const T*, const int64_t*, const T*, const int64_t, const int32_t, T*);
+};
+
+template <typename T>
+static T scatter_reduce_ref(const T old_val, const T update, const int32_t reduction)
+{
+    switch (reduction) {
+        case SCATTER_REDUCTION_ADD:
+            return old_val + update;
+        case SCATTER_REDUCTION_MUL:
+            return old_val * update;
+        case SCATTER_REDUCTION_MAX:
+            return old_val > update ? old_val : update;
+        case SCATTER_REDUCTION_MIN:
+            return old_val < update ? old_val : update;
+        default:
+            return update;
+    }
+}
+
+// small integers stay exact in every type, mul only sees -1, 0 and 1 so that long chains do not grow
+template <typename T>
+static std::vector<T> random_scatter_values(const int64_t len, const int32_t reduction)
+{
+    std::vector<T> values(len + 1);
+    for (auto& x : values) {
+        x = (T)(reduction == SCATTER_REDUCTION_MUL ? rand() % 3 - 1 : rand() % 9 - 4);
+    }
+    return values;
+}
+
+template <typename T>
+static void check_scatter_dst(riscv_test_checker& checker, const char* tag, const std::vector<T>& dst, const std::vector<T>& ref)
+{
+    for (int64_t i = 0; i < (int64_t)ref.size() - 1; i++) {
+        checker.check(tag, dst[i], ref[i], 0);
+    }
+    checker.check(tag, dst[ref.size() - 1], 77, 0);
+}
+
+// the leading indices_dim dims of src are indexed, each index updates an inner_dim slice
+template <typename T>
+static void test_scatter_nd(
+    riscv_test_checker& checker,
+    const scatter_api_t<T>& api,
+    const std::vector<int64_t>& dims,
+    const int64_t indices_dim,
+    const std::vector<int64_t>& indices,
+    const int32_t reduction,
+    const bool in_place)
+{
+    const int64_t num_dims    = dims.size();
+    const int64_t src_len     = dims_product(dims, 0, num_dims);
+    const int64_t inner_dim   = dims_product(dims, indices_dim, num_dims);
+    const int64_t num_indices = indices.size() / indices_dim;
+    std::vector<int32_t> strides(indices_dim);
+    for (int64_t i = indices_dim - 1, stride = inner_dim; i >= 0; i--) {
+        strides[i] = stride;
+        stride *= dims[i];
+    }
+    const std::vector<T> src     = random_scatter_values<T>(src_len, SCATTER_REDUCTION_NONE);
+    const std::vector<T> updates = random_scatter_values<T>(num_indices * inner_dim, reduction);
+
+    std::vector<T> ref(src);
+    ref.back() = (T)77;
+    for (int64_t k = 0; k < num_indices; k++) {
+        int64_t offset = 0;
+        for (int64_t i = 0; i < indices_dim; i++) {
+            offset += indices[k * indices_dim + i] * strides[i];
+        }
+        for (int64_t j = 0; j < inner_dim; j++) {
+            ref[offset + j] = scatter_reduce_ref(ref[offset + j], updates[k * inner_dim + j], reduction);
+        }
+    }
+
+    std::vector<T> dst(src_len + 1, (T)77);
+    if (in_place) {
+        std::copy(src.begin(), src.end() - 1, dst.begin());
+    }
+    const T* src_arg = in_place ? dst.data() : src.data();
+    if (checker.expect(api.nd_tag, api.nd(src_arg, updates.data(), indices.data(), strides.data(), src_len, inner_dim, num_indices, indices_dim, reduction, dst.data()) == ppl::common::RC_SUCCESS)) {
+        check_scatter_dst(checker, api.nd_tag, dst, ref);
+    }
+}
+
+// dst[p with the axis coord replaced by indices[p]] takes updates[p], indices may be smaller than src off the axis
+template <typename T>
+static void test_scatter_elements(
+    riscv_test_checker& checker,
+    const scatter_api_t<T>& api,
+    const std::vector<int64_t>& src_dims,
+    const std::vector<int64_t>& indices_dims,
+    const int32_t axis,
+    const int32_t reduction,
+    const bool in_place)
+{
+    const int64_t num_dims    = src_dims.size();
+    const int64_t src_len     = dims_product(src_dims, 0, num_dims);
+    const int64_t indices_len = dims_product(indices_dims, 0, num_dims);
+    ppl::common::TensorShape src_shape, indices_shape;
+    src_shape.Reshape(src_dims);
+    indices_shape.Reshape(indices_dims);
+    src_shape.SetDataType(api.data_type);
+    indices_shape.SetDataType(ppl::common::DATATYPE_INT64);
+
+    // indices span a few values around the axis dim so that duplicates are common
+    const std::vector<T> src     = random_scatter_values<T>(src_len, SCATTER_REDUCTION_NONE);
+    const std::vector<T> updates = random_scatter_values<T>(indices_len, reduction);
+    std::vector<int64_t> indices(indices_len + 1);
+    for (auto& x : indices) {
+        x = rand() % (2 * src_dims[axis]) - src_dims[axis];
+    }
+
+    std::vector<T> ref(src);
+    ref.back() = (T)77;
+    for (int64_t p = 0; p < indices_len; p++) {
+        int64_t rem = p, offset = 0, stride = 1;
+        for (int64_t i = num_dims - 1; i >= 0; i--) {
+            int64_t coord = rem % indices_dims[i];
+            rem /= indices_dims[i];
+            if (i == axis) {
+                coord = indices[p] < 0 ? indices[p] + src_dims[i] : indices[p];
+            }
+            offset += coord * stride;
+            stride *= src_dims[i];
+        }
+        ref[offset] = scatter_reduce_ref(ref[offset], updates[p], reduction);
+    }
+
+    std::vector<T> dst(src_len + 1, (T)77);
+    if (in_place) {
+        std::copy(src.begin(), src.end() - 1, dst.begin());
+    }
+    const T* src_arg       = in_place ? dst.data() : src.data();
+    const int64_t axis_arg = rand() % 2 ? axis : axis - num_dims;
+    if (checker.expect(api.elements_tag, api.elements(&src_shape, &indices_shape, src_arg, indices.data(), updates.data(), axis_arg, reduction, dst.data()) == ppl::common::RC_SUCCESS)) {
+        check_scatter_dst(checker, api.elements_tag, dst, ref);
+    }
+}
+
+template <typename T>
+static void test_scatter_random(riscv_test_checker& checker, const scatter_api_t<T>& api, const int64_t it)
+{
+    const int32_t reduction = rand() % 5;
+    const bool in_place     = rand() % 3 == 0;
+    {
+        const int64_t rank = 1 + rand() % 4;
+        std::vector<int64_t> dims(rank);
+        for (auto& d : dims) {
+            d = 1 + rand() % 6;
+        }
+        if (it % 4 == 0) {
+            dims.back() = 1 + rand() % 80;
+        }
+        const int64_t indices_dim = 1 + rand() % rank;
+        std::vector<int64_t> indices;
+        if (rand() % 2) {
+            // random indices repeat slots
+            const int64_t num_indices = 1 + rand() % 20;
+            for (int64_t k = 0; k < num_indices; k++) {
+                for (int64_t i = 0; i < indices_dim; i++) {
+                    indices.push_back(rand() % dims[i]);
+                }
+            }
+        } else {
+            // every slot exactly once
+            const int64_t num_slots = dims_product(dims, 0, indices_dim);
+            for (int64_t k = 0; k < num_slots; k++) {
+                const size_t beg = indices.size();
+                indices.resize(beg + indices_dim);
+                for (int64_t i = indices_dim - 1, rem = k; i >= 0; i--) {
+                    indices[beg + i] = rem % dims[i];
+                    rem /= dims[i];
+                }
+            }
+        }
+        test_scatter_nd(checker, api, dims, indices_dim, indices, reduction, in_place);
+    }
+    {
+        const int64_t num_dims = 1 + rand() % 4;
+        std::vector<int64_t> src_dims(num_dims), indices_dims(num_dims);
+        for (int64_t i = 0; i < num_dims; i++) {
+            src_dims[i]     = 1 + rand() % 6;
+            indices_dims[i] = 1 + rand() % src_dims[i];
+        }
+        const int32_t axis = rand() % num_dims;
+        indices_dims[axis] = 1 + rand() % 8;
+        test_scatter_elements(checker, api, src_dims, indices_dims, axis, reduction, in_place);
+    }
+}
+
+int main()
+{
+    riscv_test_checker checker("scatter");
+
+    const scatter_api_t<float> fp32_api = {
+        ppl::common::DATATYPE_FLOAT32, "scatter_nd_ndarray_fp32", scatter_nd_ndarray_fp32, "scatter_elements_ndarray_fp32", scatter_elements_ndarray_fp32};
+    const scatter_api_t<__fp16> fp16_api = {
+        ppl::common::DATATYPE_FLOAT16, "scatter_nd_ndarray_fp16", scatter_nd_ndarray_fp16, "scatter_elements_ndarray_fp16", scatter_elements_ndarray_fp16};
+    const scatter_api_t<int64_t> int64_api = {
+        ppl::common::DATATYPE_INT64, "scatter_nd_ndarray_int64", scatter_nd_ndarray_int64, "scatter_elements_ndarray_int64", scatter_elements_ndarray_int64};
+
+    for (int64_t it = 0; it < 300; it++) {
+        test_scatter_random(checker, fp32_api, it);
+        test_scatter_random(checker, fp16_api, it);
+        test_scatter_random(checker, int64_api, it);
+    }
+
+    // many updates of one slot are applied in index order, for every reduction
+    for (int32_t reduction = SCATTER_REDUCTION_NONE; reduction <= SCATTER_REDUCTION_MIN; reduction++) {
+        test_scatter_nd(checker, fp32_api, {4, 300}, 1, std::vector<int64_t>(50, 2), reduction, false);
+        test_scatter_elements(checker, fp32_api, {6, 3}, {2000, 3}, 0, reduction, false);
+        test_scatter_elements(checker, int64_api, {5}, {3000}, 0, reduction, true);
+    }
+
+    return checker.finish();
+}
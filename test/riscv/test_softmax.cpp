@@ -0,0 +1,115 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <vector>
+
+#include "ppl/kernel/riscv/fp32/softmax.h"
+#include "ppl/kernel/riscv/fp16/softmax.h"
+#include "test_utils.h"
+
+using namespace ppl::kernel::riscv;
+
+// opset 13 softmax of an ndarray along axis
+template <typename T>
+static std::vector<double> softmax_ref(const std::vector<T>& src, const std::vector<int64_t>& dims, const int64_t axis)
+{
+    const int64_t outer = dims_product(dims, 0, axis);
+    const int64_t len   = dims[axis];
+    const int64_t inner = dims_product(dims, axis + 1, dims.size());
+    std::vector<double> dst(src.size());
+    for (int64_t o = 0; o < outer; o++) {
+        for (int64_t i = 0; i < inner; i++) {
+            const int64_t base = o * len * inner + i;
+            double max_val     = -INFINITY;
+            for (int64_t l = 0; l < len; l++) {
+                max_val = std::fmax(max_val, (double)src[base + l * inner]);
+            }
+            double sum = 0;
+            for (int64_t l = 0; l < len; l++) {
+                sum += std::exp((double)src[base + l * inner] - max_val);
+            }
+            for (int64_t l = 0; l < len; l++) {
+                dst[base + l * inner] = std::exp((double)src[base + l * inner] - max_val) / sum;
+            }
+        }
+    }
+    return dst;
+}
+
+int main()
+{
+    riscv_test_checker checker("softmax");
+    const std::vector<std::vector<int64_t>> shapes = {{2, 3, 5, 7}, {1, 17, 3, 2}, {3, 8, 1, 9}, {2, 33, 2, 3}, {1, 4, 40}, {2, 1, 3}, {5, 100}};
+
+    for (auto& dims : shapes) {
+        const int64_t ndims    = dims.size();
+        const int64_t len      = dims_product(dims, 0, ndims);
+        const int64_t channels = dims[1];
+        const int64_t spatial  = dims_product(dims, 2, ndims);
+        ppl::common::TensorShape shape;
+        shape.Reshape(dims);
+
+        std::vector<float> src(len);
+        std::vector<__fp16> src_fp16(len);
+        for (int64_t i = 0; i < len; i++) {
+            src[i]      = rand_float(-15.0f, 15.0f);
+            src_fp16[i] = (__fp16)src[i];
+        }
+        const std::vector<float> src_n4cx  = to_nbcx(src, dims, 4, 0.0f);
+        const std::vector<__fp16> src_n8cx = to_nbcx(src_fp16, dims, 8, (__fp16)0.0f);
+        std::vector<float> dst(len);
+        std::vector<__fp16> dst_fp16(len);
+        std::vector<float> dst_n4cx(src_n4cx.size());
+        std::vector<__fp16> dst_n8cx(src_n8cx.size());
+
+        for (int64_t axis = -1; axis < ndims; axis++) {
+            const int64_t real_axis         = axis < 0 ? axis + ndims : axis;
+            const std::vector<double> ref   = softmax_ref(src, dims, real_axis);
+            const std::vector<double> ref16 = softmax_ref(src_fp16, dims, real_axis);
+
+            checker.expect("softmax13_ndarray_fp32 rc", softmax13_ndarray_fp32(&shape, axis, src.data(), dst.data()) == ppl::common::RC_SUCCESS);
+            checker.expect("softmax13_ndarray_fp16 rc", softmax13_ndarray_fp16(&shape, axis, src_fp16.data(), dst_fp16.data()) == ppl::common::RC_SUCCESS);
+            checker.expect("softmax13_n4cx_fp32 rc", softmax13_n4cx_fp32(&shape, axis, src_n4cx.data(), dst_n4cx.data()) == ppl::common::RC_SUCCESS);
+            checker.expect("softmax13_n8cx_fp16 rc", softmax13_n8cx_fp16(&shape, axis, src_n8cx.data(), dst_n8cx.data()) == ppl::common::RC_SUCCESS);
+            for (int64_t i = 0; i < len; i++) {
+                checker.check("softmax13_ndarray_fp32", dst[i], ref[i], 1e-5);
+                checker.check("softmax13_ndarray_fp16", dst_fp16[i], ref16[i], 2e-3);
+            }
+            for (int64_t n = 0; n < dims[0]; n++) {
+                for (int64_t c = 0; c < channels; c++) {
+                    for (int64_t s = 0; s < spatial; s++) {
+                        const int64_t i = (n * channels + c) * spatial + s;
+                        checker.check("softmax13_n4cx_fp32", dst_n4cx[nbcx_offset(channels, spatial, 4, n, c, s)], ref[i], 1e-5);
+                        checker.check("softmax13_n8cx_fp16", dst_n8cx[nbcx_offset(channels, spatial, 8, n, c, s)], ref16[i], 2e-3);
+                    }
+                }
+            }
+        }
+
+        // before opset 13 the dims from axis on are flattened into one
+        for (int64_t axis = 0; axis < ndims; axis++) {
+            const int64_t outer           = dims_product(dims, 0, axis);
+            const std::vector<double> ref = softmax_ref(src, {outer, len / outer}, 1);
+            checker.expect("softmax_ndarray_fp32 rc", softmax_ndarray_fp32(&shape, axis, src.data(), dst.data()) == ppl::common::RC_SUCCESS);
+            for (int64_t i = 0; i < len; i++) {
+                checker.check("softmax_ndarray_fp32", dst[i], ref[i], 1e-5);
+            }
+        }
+    }
+
+    return checker.finish();
+}
@@ -0,0 +1,137 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "ppl/kernel/riscv/fp32/topk.h"
+#include "ppl/kernel/riscv/fp16/topk.h"
+#include "test_utils.h"
+
+using namespace ppl::kernel::riscv;
+
+typedef std::pair<float, int64_t> topk_entry_t;
+
+// orders by value, ties go to the lower index
+static bool topk_entry_before(const topk_entry_t& a, const topk_entry_t& b, const int32_t largest)
+{
+    if (a.first != b.first) {
+        return largest ? a.first > b.first : a.first < b.first;
+    }
+    return a.second < b.second;
+}
+
+template <typename T>
+static void test_topk(
+    riscv_test_checker& checker,
+    const std::vector<int64_t>& dims,
+    const int32_t axis,
+    const int64_t k,
+    const int32_t largest,
+    const int32_t sorted)
+{
+    const bool is_fp16     = sizeof(T) == 2;
+    const int64_t num_dims = dims.size();
+    const int64_t outer    = dims_product(dims, 0, axis);
+    const int64_t axis_dim = dims[axis];
+    const int64_t inner    = dims_product(dims, axis + 1, num_dims);
+    const int64_t dst_len  = outer * k * inner;
+    ppl::common::TensorShape src_shape;
+    src_shape.Reshape(dims);
+    src_shape.SetDataType(is_fp16 ? ppl::common::DATATYPE_FLOAT16 : ppl::common::DATATYPE_FLOAT32);
+    src_shape.SetDataFormat(ppl::common::DATAFORMAT_NDARRAY);
+
+    // few distinct values so that ties are common
+    std::vector<T> src(outer * axis_dim * inner + 1);
+    for (auto& x : src) {
+        x = (T)((rand() % 200) / 8.0f - 12.0f);
+    }
+    std::vector<T> values(dst_len + 1, (T)77.0f);
+    std::vector<int64_t> indices(dst_len + 1, 777);
+
+    ppl::common::RetCode rc;
+    if (is_fp16) {
+        std::vector<uint8_t> buffer(topk_ndarray_get_buffer_bytes_fp16(&src_shape, axis));
+        rc = topk_ndarray_fp16(&src_shape, &src_shape, &src_shape, (const __fp16*)src.data(), k, axis, largest, sorted, buffer.data(), (__fp16*)values.data(), indices.data());
+    } else {
+        std::vector<uint8_t> buffer(topk_ndarray_get_buffer_bytes_fp32(&src_shape, axis));
+        rc = topk_ndarray_fp32(&src_shape, &src_shape, &src_shape, (const float*)src.data(), k, axis, largest, sorted, buffer.data(), (float*)values.data(), indices.data());
+    }
+    const char* tag = is_fp16 ? "topk_ndarray_fp16" : "topk_ndarray_fp32";
+    if (!checker.expect(tag, rc == ppl::common::RC_SUCCESS)) {
+        return;
+    }
+
+    auto before = [largest](const topk_entry_t& a, const topk_entry_t& b) {
+        return topk_entry_before(a, b, largest);
+    };
+    for (int64_t o = 0; o < outer; o++) {
+        for (int64_t i = 0; i < inner; i++) {
+            std::vector<topk_entry_t> ref(axis_dim);
+            for (int64_t a = 0; a < axis_dim; a++) {
+                ref[a] = topk_entry_t((float)src[(o * axis_dim + a) * inner + i], a);
+            }
+            std::sort(ref.begin(), ref.end(), before);
+            std::vector<topk_entry_t> got(k);
+            for (int64_t j = 0; j < k; j++) {
+                const int64_t offset = (o * k + j) * inner + i;
+                got[j]               = topk_entry_t((float)values[offset], indices[offset]);
+            }
+            // unsorted output only has to hold the same k entries
+            if (!sorted) {
+                std::sort(got.begin(), got.end(), before);
+            }
+            for (int64_t j = 0; j < k; j++) {
+                checker.check(tag, got[j].first, ref[j].first, 0);
+                checker.check(tag, got[j].second, ref[j].second, 0);
+            }
+        }
+    }
+    checker.check(tag, (float)values[dst_len], 77.0, 0);
+    checker.check(tag, indices[dst_len], 777, 0);
+}
+
+int main()
+{
+    riscv_test_checker checker("topk");
+
+    for (int64_t it = 0; it < 400; it++) {
+        const int64_t num_dims = 1 + rand() % 3;
+        std::vector<int64_t> dims(num_dims);
+        for (auto& d : dims) {
+            d = 1 + rand() % 6;
+        }
+        const int32_t axis = rand() % num_dims;
+        dims[axis]         = rand() % 2 ? 1 + rand() % 3000 : 1 + rand() % 20;
+        // small k runs the heap select, large k the partition
+        const int64_t k       = rand() % 3 == 0 ? 1 + rand() % dims[axis] : 1 + rand() % std::max<int64_t>(1, dims[axis] / 8);
+        const int32_t largest = rand() % 2;
+        const int32_t sorted  = rand() % 4 != 0;
+        if (it % 2) {
+            test_topk<float>(checker, dims, axis, k, largest, sorted);
+        } else {
+            test_topk<__fp16>(checker, dims, axis, k, largest, sorted);
+        }
+    }
+
+    // k == 0 and empty outer dims write nothing
+    test_topk<float>(checker, {3, 40}, 1, 0, 1, 1);
+    test_topk<__fp16>(checker, {0, 40}, 1, 5, 0, 1);
+    test_topk<float>(checker, {4, 7, 2}, 1, 7, 1, 1);
+
+    return checker.finish();
+}
@@ -0,0 +1,113 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <vector>
+
+#include "ppl/kernel/riscv/fp32/transpose.h"
+#include "ppl/kernel/riscv/fp16/transpose.h"
+#include "test_utils.h"
+
+using namespace ppl::kernel::riscv;
+
+// dst[..., i_k, ...] = src[..., i_perm[k], ...]
+template <typename T>
+static std::vector<T> transpose_ref(const std::vector<T>& src, const std::vector<int64_t>& src_dims, const std::vector<int32_t>& perm)
+{
+    const int64_t num_dims = src_dims.size();
+    std::vector<int64_t> src_stride(num_dims, 1);
+    for (int64_t i = num_dims - 2; i >= 0; i--) {
+        src_stride[i] = src_stride[i + 1] * src_dims[i + 1];
+    }
+    std::vector<T> dst(src.size());
+    for (int64_t i = 0; i < (int64_t)dst.size(); i++) {
+        int64_t rem        = i;
+        int64_t src_offset = 0;
+        for (int64_t d = num_dims - 1; d >= 0; d--) {
+            const int64_t len = src_dims[perm[d]];
+            src_offset += rem % len * src_stride[perm[d]];
+            rem /= len;
+        }
+        dst[i] = src[src_offset];
+    }
+    return dst;
+}
+
+static void test_transpose(riscv_test_checker& checker, const std::vector<int64_t>& src_dims, const std::vector<int32_t>& perm)
+{
+    const int64_t num_dims = src_dims.size();
+    const int64_t len      = dims_product(src_dims, 0, num_dims);
+    std::vector<int64_t> dst_dims(num_dims);
+    for (int64_t i = 0; i < num_dims; i++) {
+        dst_dims[i] = src_dims[perm[i]];
+    }
+    ppl::common::TensorShape src_shape, dst_shape;
+    src_shape.Reshape(src_dims);
+    dst_shape.Reshape(dst_dims);
+
+    // perm may also be given with negative axes
+    std::vector<int32_t> perm_arg = perm;
+    if (num_dims > 0 && rand() % 3 == 0) {
+        perm_arg[0] -= num_dims;
+    }
+
+    std::vector<float> src(len);
+    for (auto& v : src) {
+        v = float(rand() % 1000);
+    }
+    const std::vector<__fp16> src_fp16(src.begin(), src.end());
+    const std::vector<float> ref       = transpose_ref(src, src_dims, perm);
+    const std::vector<__fp16> ref_fp16 = transpose_ref(src_fp16, src_dims, perm);
+    std::vector<float> dst(len + 1, 777.0f);
+    std::vector<__fp16> dst_fp16(len + 1, (__fp16)77.0f);
+
+    checker.expect("transpose_ndarray_fp32 rc", transpose_ndarray_fp32(src.data(), dst.data(), perm_arg.data(), &src_shape, &dst_shape) == ppl::common::RC_SUCCESS);
+    checker.expect("transpose_ndarray_fp16 rc", transpose_ndarray_fp16(src_fp16.data(), dst_fp16.data(), perm_arg.data(), &src_shape, &dst_shape) == ppl::common::RC_SUCCESS);
+    for (int64_t i = 0; i < len; i++) {
+        checker.check("transpose_ndarray_fp32", dst[i], ref[i], 0);
+        checker.check("transpose_ndarray_fp16", dst_fp16[i], ref_fp16[i], 0);
+    }
+    checker.check("transpose_ndarray_fp32 overrun", dst[len], 777.0f, 0);
+    checker.check("transpose_ndarray_fp16 overrun", dst_fp16[len], 77.0f, 0);
+}
+
+int main()
+{
+    riscv_test_checker checker("transpose");
+
+    for (int64_t i = 0; i < 400; i++) {
+        const int64_t num_dims = 1 + rand() % 6;
+        std::vector<int64_t> dims(num_dims);
+        for (auto& d : dims) {
+            d = rand() % 4 == 0 ? 1 : 1 + rand() % (num_dims <= 2 ? 150 : 9);
+        }
+        std::vector<int32_t> perm(num_dims);
+        for (int64_t d = 0; d < num_dims; d++) {
+            perm[d] = d;
+        }
+        std::random_shuffle(perm.begin(), perm.end());
+        test_transpose(checker, dims, perm);
+    }
+
+    // empty tensors, the innermost dim kept or moved
+    test_transpose(checker, {2, 3, 0}, {1, 0, 2});
+    test_transpose(checker, {2, 3, 0}, {2, 0, 1});
+    test_transpose(checker, {0, 5, 4}, {0, 2, 1});
+    test_transpose(checker, {4, 0}, {1, 0});
+
+    return checker.finish();
+}
@@ -0,0 +1,121 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_PPL_TEST_RISCV_TEST_UTILS_H_
+#define __ST_PPL_TEST_RISCV_TEST_UTILS_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <cmath>
+#include <vector>
+
+// counts mismatches against a reference, only the first few are printed
+class riscv_test_checker {
+public:
+    explicit riscv_test_checker(const char* name)
+        : name_(name), fails_(0) {}
+
+    // |got - ref| <= tol * max(1, |ref|), nan only matches nan
+    bool check(const char* tag, const double got, const double ref, const double tol)
+    {
+        const bool nan_match = std::isnan(got) && std::isnan(ref);
+        if (nan_match || std::fabs(got - ref) <= tol * std::fmax(1.0, std::fabs(ref))) {
+            return true;
+        }
+        if (std::isinf(got) && got == ref) {
+            return true;
+        }
+        if (fails_ < 10) {
+            fprintf(stderr, "%s: %s got %g ref %g\n", name_, tag, got, ref);
+        }
+        fails_++;
+        return false;
+    }
+
+    bool expect(const char* tag, const bool cond)
+    {
+        if (!cond) {
+            if (fails_ < 10) {
+                fprintf(stderr, "%s: %s failed\n", name_, tag);
+            }
+            fails_++;
+        }
+        return cond;
+    }
+
+    int64_t fails() const
+    {
+        return fails_;
+    }
+
+    int finish() const
+    {
+        if (fails_ == 0) {
+            fprintf(stderr, "%s: pass\n", name_);
+            return 0;
+        }
+        fprintf(stderr, "%s: %ld fails\n", name_, (long)fails_);
+        return 1;
+    }
+
+private:
+    const char* name_;
+    int64_t fails_;
+};
+
+inline float rand_float(const float lo, const float hi)
+{
+    return lo + (hi - lo) * (rand() / (float)RAND_MAX);
+}
+
+inline int64_t dims_product(const std::vector<int64_t>& dims, const int64_t beg, const int64_t end)
+{
+    int64_t prod = 1;
+    for (int64_t i = beg; i < end; i++) {
+        prod *= dims[i];
+    }
+    return prod;
+}
+
+// offset of logical (n, c, s) in an [N, C, S] tensor blocked by c_blk, c_blk == 1 is ndarray
+inline int64_t nbcx_offset(const int64_t channels, const int64_t spatial, const int64_t c_blk, const int64_t n, const int64_t c, const int64_t s)
+{
+    const int64_t padded_c = (channels + c_blk - 1) / c_blk * c_blk;
+    return (n * padded_c + c / c_blk * c_blk) * spatial + s * c_blk + c % c_blk;
+}
+
+// packs an ndarray [N, C, S] into nbcx, padding lanes get pad_val
+template <typename T>
+std::vector<T> to_nbcx(const std::vector<T>& src, const std::vector<int64_t>& dims, const int64_t c_blk, const T pad_val)
+{
+    const int64_t batch    = dims[0];
+    const int64_t channels = dims[1];
+    const int64_t spatial  = dims_product(dims, 2, dims.size());
+    const int64_t padded_c = (channels + c_blk - 1) / c_blk * c_blk;
+    std::vector<T> dst(batch * padded_c * spatial, pad_val);
+    for (int64_t n = 0; n < batch; n++) {
+        for (int64_t c = 0; c < channels; c++) {
+            for (int64_t s = 0; s < spatial; s++) {
+                dst[nbcx_offset(channels, spatial, c_blk, n, c, s)] = src[(n * channels + c) * spatial + s];
+            }
+        }
+    }
+    return dst;
+}
+
+#endif // __ST_PPL_TEST_RISCV_TEST_UTILS_H_